@@ -170,13 +170,38 @@
              template <class T, std::size_t Size>
              inline String Array<T, Size>::toString() const {
                  String res;
-                 res.reserve(5 * Size);
-                 res << '[' << data[0];
-                 for (SizeType index = 1; index < Size; index++) {
-                     res << ',' << ' ' << data[index];
-                 }
-                 res << ']';
+                 toString(res);
                  return res;
              }
+
+             template <class T, std::size_t Size>
+             inline void Array<T, Size>::toString(String& out) const {
+                 out.reserve(out.getSize() + estimateStringSize());
+                 StringSink sink(out);
+                 writeTo(sink);
+             }
+
+             template <class T, std::size_t Size>
+             template <class S>
+             inline void Array<T, Size>::writeTo(S& sink) const {
+                 sink.write("[", 1);
+                 if constexpr (Size > 0) {
+                     format(sink, data[0]);
+                     for (SizeType index = 1; index < Size; index++) {
+                         sink.write(", ", 2);
+                         format(sink, data[index]);
+                     }
+                 }
+                 sink.write("]", 1);
+             }
+
+             template <class T, std::size_t Size>
+             inline std::size_t Array<T, Size>::estimateStringSize() const {
+                 std::size_t size = (Size == 0) ? (2) : (2 * Size);
+                 for (SizeType index = 0; index < Size; index++) {
+                     size += Core::estimateStringSize(data[index]);
+                 }
+                 return size;
+             }
          }
      }
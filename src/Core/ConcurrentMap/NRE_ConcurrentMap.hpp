@@ -0,0 +1,212 @@
+
+    /**
+     * @file NRE_ConcurrentMap.hpp
+     * @brief Declaration of Core's API's Container : ConcurrentMap
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+     #pragma once
+
+     #include <shared_mutex>
+     #include <mutex>
+     #include <memory>
+     #include <thread>
+     #include <exception>
+     #include <stdexcept>
+
+     #include <Memory/Allocator/NRE_Allocator.hpp>
+     #include "../Detail/HashTable/NRE_HashTable.hpp"
+     #include "../Interfaces/Uncopyable/NRE_Uncopyable.hpp"
+
+     /**
+     * @namespace NRE
+     * @brief The NearlyRealEngine's global namespace
+     */
+    namespace NRE {
+        /**
+         * @namespace Core
+         * @brief Core's API
+         */
+        namespace Core {
+
+            /**
+             * @class ConcurrentMap
+             * @brief Thread safe unordered map, split in independent HashTable shards
+             *
+             * A key lives in the shard selected by the high bits of its mixed hash, the low bits still pick its bucket inside the shard.
+             * Each shard has its own reader-writer lock, so threads working on different shards never wait on each other.
+             * No iterator is exposed, elements are reached through callbacks run while the shard lock is held.
+             * Whole map queries lock shards one after the other and are not a snapshot under concurrent writes.
+             */
+            template <class Key, class T, class Allocator = Memory::Allocator<Pair<Key, T>>, bool StoreHash = false, class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key>, class Mix = DefaultHashMix<Key, Hash>>
+            class ConcurrentMap : public Uncopyable<ConcurrentMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>> {
+                private :   // Traits
+                    /** The shard table */
+                    using Table             = Detail::HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>;
+
+                public :    // Traits
+                    /** The map key type */
+                    using KeyType           = Key;
+                    /** The map mapped type */
+                    using MappedType        = T;
+                    /** The container's allocated type */
+                    using ValueType         = Pair<KeyType, MappedType>;
+                    /** The object's size type */
+                    using SizeType          = std::size_t;
+                    /** STL compatibility */
+                    using key_type          = KeyType;
+                    /** STL compatibility */
+                    using mapped_type       = MappedType;
+                    /** STL compatibility */
+                    using value_type        = ValueType;
+                    /** STL compatibility */
+                    using size_type         = SizeType;
+
+                private :   // Static
+                    static constexpr SizeType CACHE_LINE_SIZE = 64;    /**< The shard alignment, keeping two shard locks out of the same cache line */
+
+                    /**
+                     * @struct Shard
+                     * @brief A table and the lock protecting it
+                     */
+                    struct alignas(CACHE_LINE_SIZE) Shard {
+                        mutable std::shared_mutex mutex;    /**< Protect the table, shared for lookups, exclusive for modifications */
+                        Table table;                        /**< The shard elements */
+                    };
+
+                private :   // Fields
+                    std::unique_ptr<Shard[]> shards;    /**< The shards */
+                    SizeType shardMask;                 /**< The shard count minus one, the count being a power of two */
+                    Hash hasher;                        /**< The hash function, used to select the shard */
+
+                public :    // Methods
+                    //## Constructor ##//
+                        /**
+                         * Construct an empty map
+                         * @param shardCount the number of shards, rounded up to a power of two
+                         * @param hash       the hash function used in the map
+                         * @param equal      the equal function used in the map
+                         * @param alloc      the shards memory allocator
+                         */
+                        ConcurrentMap(SizeType shardCount = DEFAULT_SHARD_COUNT, Hash const& hash = Hash(), KeyEqual const& equal = KeyEqual(), Allocator const& alloc = Allocator());
+
+                    //## Getter ##//
+                        /**
+                         * @return the number of shards
+                         */
+                        SizeType getShardCount() const;
+                        /**
+                         * @return the number of elements in the map
+                         */
+                        SizeType getSize() const;
+                        /**
+                         * @return if the map is empty
+                         */
+                        bool isEmpty() const;
+                        /**
+                         * Find the number of element with the given key
+                         * @param  k the key to search
+                         * @return   the number of corresponding elements
+                         */
+                        SizeType getCount(KeyType const& k) const;
+                        /**
+                         * Copy the value mapped to the given key
+                         * @param  k the key to search
+                         * @return   a copy of the mapped value
+                         * @throw std::out_of_range if the key is not in the map
+                         */
+                        MappedType get(KeyType const& k) const;
+
+                    //## Methods ##//
+                        /**
+                         * Call f on the value mapped to the given key, under the shard shared lock
+                         * @param  k the key to search
+                         * @param  f the function called with the mapped value as const reference
+                         * @return   if the key has been found
+                         */
+                        template <class F>
+                        bool findAndApply(KeyType const& k, F && f) const;
+                        /**
+                         * Insert the given element if its key is not in the map
+                         * @param  value the element to insert
+                         * @return       if the insertion has been done
+                         */
+                        bool insert(ValueType const& value);
+                        /**
+                         * Insert the given value if the key is not in the map, or assign it to the mapped value
+                         * @param  k     the key to insert or update
+                         * @param  value the new mapped value
+                         * @return       if the insertion has been done
+                         */
+                        template <class V>
+                        bool upsert(KeyType const& k, V && value);
+                        /**
+                         * Insert the given value if the key is not in the map, or call updater on the mapped value, under the shard exclusive lock
+                         * @param  k       the key to insert or update
+                         * @param  value   the mapped value inserted if the key is missing
+                         * @param  updater the function called with the mapped value as reference if the key is present
+                         * @return         if the insertion has been done
+                         */
+                        template <class V, class F>
+                        bool upsert(KeyType const& k, V && value, F && updater);
+                        /**
+                         * Erase the element with the given key
+                         * @param  k the key of the element to erase
+                         * @return   the number of erased elements
+                         */
+                        SizeType erase(KeyType const& k);
+                        /**
+                         * Erase the element with the given key if pred, called with its mapped value, returns true
+                         * @param  k    the key of the element to erase
+                         * @param  pred the predicate, called under the shard exclusive lock
+                         * @return      if the element has been erased
+                         */
+                        template <class Predicate>
+                        bool eraseIf(KeyType const& k, Predicate && pred);
+                        /**
+                         * Erase every element for which pred, called with the element, returns true
+                         * @param  pred the predicate, called under the shard exclusive lock
+                         * @return      the number of erased elements
+                         */
+                        template <class Predicate>
+                        SizeType eraseIf(Predicate && pred);
+                        /**
+                         * Call f on every element, shards being split between threads and visited under their shared lock
+                         * f is called concurrently from several threads and must be thread safe, the first exception thrown by f is rethrown
+                         * @param f           the function called with each element as const reference
+                         * @param threadCount the number of threads, 0 to use the hardware concurrency
+                         */
+                        template <class F>
+                        void forEach(F && f, SizeType threadCount = 0) const;
+                        /**
+                         * Reserve enough bucket to hold count elements, spread evenly across shards
+                         * @param count the number of desired elements
+                         */
+                        void reserve(SizeType count);
+                        /**
+                         * Clear all elements in the map
+                         */
+                        void clear();
+                        /**
+                         * Shrink each shard bucket count to the smallest one holding its elements, shards being locked one after the other
+                         */
+                        void shrinkToFit();
+
+                private :   // Methods
+                    /**
+                     * Select the shard of a key
+                     * @param  hash the key hash, computed with the map hash function
+                     * @return      the key shard
+                     */
+                    Shard& shardFromHash(SizeType hash) const;
+
+                public :    // Static
+                    static constexpr SizeType DEFAULT_SHARD_COUNT = 64;          /**< The default number of shards */
+                    static constexpr SizeType MAX_SHARD_COUNT     = 1 << 16;     /**< The maximum number of shards, selected from the 16 high bits of the mixed hash */
+            };
+        }
+    }
+
+    #include "NRE_ConcurrentMap.tpp"
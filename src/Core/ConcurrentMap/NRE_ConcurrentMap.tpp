@@ -0,0 +1,229 @@
+
+    /**
+     * @file NRE_ConcurrentMap.tpp
+     * @brief Implementation of Core's API's Container : ConcurrentMap
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+     namespace NRE {
+         namespace Core {
+
+             template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+             inline ConcurrentMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConcurrentMap(SizeType shardCount, Hash const& hash, KeyEqual const& equal, Allocator const& alloc) : shardMask(0), hasher(hash) {
+                 SizeType count = 1;
+                 while (count < shardCount && count < MAX_SHARD_COUNT) {
+                     count <<= 1;
+                 }
+                 shards = std::make_unique<Shard[]>(count);
+                 shardMask = count - 1;
+                 for (SizeType i = 0; i < count; ++i) {
+                     shards[i].table = Table(Table::DEFAULT_BUCKET_COUNT, hash, equal, alloc);
+                 }
+             }
+
+             template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+             inline typename ConcurrentMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType ConcurrentMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::getShardCount() const {
+                 return shardMask + 1;
+             }
+
+             template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+             inline typename ConcurrentMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType ConcurrentMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::getSize() const {
+                 SizeType size = 0;
+                 for (SizeType i = 0; i <= shardMask; ++i) {
+                     std::shared_lock<std::shared_mutex> lock(shards[i].mutex);
+                     size += shards[i].table.getSize();
+                 }
+                 return size;
+             }
+
+             template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+             inline bool ConcurrentMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::isEmpty() const {
+                 for (SizeType i = 0; i <= shardMask; ++i) {
+                     std::shared_lock<std::shared_mutex> lock(shards[i].mutex);
+                     if (!shards[i].table.isEmpty()) {
+                         return false;
+                     }
+                 }
+                 return true;
+             }
+
+             template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+             inline typename ConcurrentMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType ConcurrentMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::getCount(KeyType const& k) const {
+                 SizeType hash = hasher(k);
+                 Shard& shard = shardFromHash(hash);
+                 std::shared_lock<std::shared_mutex> lock(shard.mutex);
+                 return shard.table.getCount(k, hash);
+             }
+
+             template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+             inline typename ConcurrentMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::MappedType ConcurrentMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::get(KeyType const& k) const {
+                 SizeType hash = hasher(k);
+                 Shard& shard = shardFromHash(hash);
+                 std::shared_lock<std::shared_mutex> lock(shard.mutex);
+                 auto it = shard.table.find(k, hash);
+                 if (it == shard.table.end()) {
+                     throw std::out_of_range("Accessing non existing element in NRE::Core::ConcurrentMap.");
+                 }
+                 return it->second;
+             }
+
+             template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+             template <class F>
+             inline bool ConcurrentMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::findAndApply(KeyType const& k, F&& f) const {
+                 SizeType hash = hasher(k);
+                 Shard& shard = shardFromHash(hash);
+                 std::shared_lock<std::shared_mutex> lock(shard.mutex);
+                 auto it = static_cast <Table const&> (shard.table).find(k, hash);
+                 if (it == shard.table.cend()) {
+                     return false;
+                 }
+                 f(it->second);
+                 return true;
+             }
+
+             template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+             inline bool ConcurrentMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::insert(ValueType const& value) {
+                 SizeType hash = hasher(value.first);
+                 Shard& shard = shardFromHash(hash);
+                 std::unique_lock<std::shared_mutex> lock(shard.mutex);
+                 return shard.table.emplaceHashed(hash, value).second;
+             }
+
+             template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+             template <class V>
+             inline bool ConcurrentMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::upsert(KeyType const& k, V&& value) {
+                 SizeType hash = hasher(k);
+                 Shard& shard = shardFromHash(hash);
+                 std::unique_lock<std::shared_mutex> lock(shard.mutex);
+                 auto res = shard.table.tryEmplace(HashedKey<KeyType>(k, hash), std::forward<V>(value));
+                 if (!res.second) {
+                     res.first->second = std::forward<V>(value);
+                 }
+                 return res.second;
+             }
+
+             template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+             template <class V, class F>
+             inline bool ConcurrentMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::upsert(KeyType const& k, V&& value, F&& updater) {
+                 SizeType hash = hasher(k);
+                 Shard& shard = shardFromHash(hash);
+                 std::unique_lock<std::shared_mutex> lock(shard.mutex);
+                 auto res = shard.table.tryEmplace(HashedKey<KeyType>(k, hash), std::forward<V>(value));
+                 if (!res.second) {
+                     updater(res.first->second);
+                 }
+                 return res.second;
+             }
+
+             template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+             inline typename ConcurrentMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType ConcurrentMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::erase(KeyType const& k) {
+                 SizeType hash = hasher(k);
+                 Shard& shard = shardFromHash(hash);
+                 std::unique_lock<std::shared_mutex> lock(shard.mutex);
+                 return shard.table.erase(k, hash);
+             }
+
+             template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+             template <class Predicate>
+             inline bool ConcurrentMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::eraseIf(KeyType const& k, Predicate&& pred) {
+                 SizeType hash = hasher(k);
+                 Shard& shard = shardFromHash(hash);
+                 std::unique_lock<std::shared_mutex> lock(shard.mutex);
+                 auto it = shard.table.find(k, hash);
+                 if (it == shard.table.end() || !pred(static_cast <MappedType const&> (it->second))) {
+                     return false;
+                 }
+                 shard.table.erase(it);
+                 return true;
+             }
+
+             template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+             template <class Predicate>
+             inline typename ConcurrentMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType ConcurrentMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::eraseIf(Predicate&& pred) {
+                 SizeType erased = 0;
+                 for (SizeType i = 0; i <= shardMask; ++i) {
+                     std::unique_lock<std::shared_mutex> lock(shards[i].mutex);
+                     auto it = shards[i].table.begin();
+                     while (it != shards[i].table.end()) {
+                         if (pred(static_cast <ValueType const&> (*it))) {
+                             it = shards[i].table.erase(it);
+                             ++erased;
+                         } else {
+                             ++it;
+                         }
+                     }
+                 }
+                 return erased;
+             }
+
+             template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+             template <class F>
+             inline void ConcurrentMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::forEach(F&& f, SizeType threadCount) const {
+                 if (threadCount == 0) {
+                     threadCount = std::max(static_cast <SizeType> (std::thread::hardware_concurrency()), static_cast <SizeType> (1));
+                 }
+                 threadCount = std::min(threadCount, getShardCount());
+
+                 std::unique_ptr<std::exception_ptr[]> errors = std::make_unique<std::exception_ptr[]>(threadCount);
+                 auto visit = [&](SizeType first) {
+                     try {
+                         for (SizeType i = first; i <= shardMask; i += threadCount) {
+                             std::shared_lock<std::shared_mutex> lock(shards[i].mutex);
+                             for (ValueType const& value : static_cast <Table const&> (shards[i].table)) {
+                                 f(value);
+                             }
+                         }
+                     } catch (...) {
+                         errors[first] = std::current_exception();
+                     }
+                 };
+
+                 std::unique_ptr<std::thread[]> workers = std::make_unique<std::thread[]>(threadCount - 1);
+                 for (SizeType t = 1; t < threadCount; ++t) {
+                     workers[t - 1] = std::thread(visit, t);
+                 }
+                 visit(0);
+                 for (SizeType t = 1; t < threadCount; ++t) {
+                     workers[t - 1].join();
+                 }
+
+                 for (SizeType t = 0; t < threadCount; ++t) {
+                     if (errors[t]) {
+                         std::rethrow_exception(errors[t]);
+                     }
+                 }
+             }
+
+             template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+             inline void ConcurrentMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::reserve(SizeType count) {
+                 SizeType perShard = count / getShardCount() + 1;
+                 for (SizeType i = 0; i <= shardMask; ++i) {
+                     std::unique_lock<std::shared_mutex> lock(shards[i].mutex);
+                     shards[i].table.reserve(perShard);
+                 }
+             }
+
+             template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+             inline void ConcurrentMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::clear() {
+                 for (SizeType i = 0; i <= shardMask; ++i) {
+                     std::unique_lock<std::shared_mutex> lock(shards[i].mutex);
+                     shards[i].table.clear();
+                 }
+             }
+
+             template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+             inline void ConcurrentMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::shrinkToFit() {
+                 for (SizeType i = 0; i <= shardMask; ++i) {
+                     std::unique_lock<std::shared_mutex> lock(shards[i].mutex);
+                     shards[i].table.shrinkToFit();
+                 }
+             }
+
+             template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+             inline typename ConcurrentMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Shard& ConcurrentMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::shardFromHash(SizeType hash) const {
+                 return shards[(Mix::mix(hash) >> (std::numeric_limits<SizeType>::digits - 16)) & shardMask];
+             }
+         }
+     }
@@ -598,6 +598,21 @@
                              * @return the converted object
                              */
                             [[nodiscard]] String toString() const;
+                            /**
+                             * Append the object string representation at the end of out, reserving its exact size first
+                             * @param out the string to append into
+                             */
+                            void toString(String& out) const;
+                            /**
+                             * @return the object string representation size, used to format nested objects in one allocation
+                             */
+                            std::size_t estimateStringSize() const;
+                            /**
+                             * Format the object straight into the given sink
+                             * @param sink the sink to write into
+                             */
+                            template <class S>
+                            void writeTo(S& sink) const;
 
                 };
             }
@@ -537,24 +537,44 @@
     
                  template <class T, class Allocator>
                  inline String ForwardList<T, Allocator>::toString() const {
-                     if (isEmpty()) {
-                         String res;
-                         res.reserve(2);
-                         res << '(' << ')';
-                         return res;
-                     } else {
-                         String res;
+                     String res;
+                     toString(res);
+                     return res;
+                 }
+
+                 template <class T, class Allocator>
+                 inline void ForwardList<T, Allocator>::toString(String& out) const {
+                     out.reserve(out.getSize() + estimateStringSize());
+                     StringSink sink(out);
+                     writeTo(sink);
+                 }
+
+                 template <class T, class Allocator>
+                 template <class S>
+                 inline void ForwardList<T, Allocator>::writeTo(S& sink) const {
+                     sink.write("(", 1);
+                     if (!isEmpty()) {
                          Node* current = static_cast <Node*> (front.next);
-                         res << '(' << current->data;
-                         res.reserve((res.getSize() + 2) * length);
+                         Core::format(sink, current->data);
                          current = static_cast <Node*> (current->next);
                          while(current != nullptr) {
-                             res << ',' << ' ' << current->data;
+                             sink.write(", ", 2);
+                             Core::format(sink, current->data);
                              current = static_cast <Node*> (current->next);
                          }
-                         res << ')';
-                         return res;
                      }
+                     sink.write(")", 1);
+                 }
+
+                 template <class T, class Allocator>
+                 inline std::size_t ForwardList<T, Allocator>::estimateStringSize() const {
+                     std::size_t size = (isEmpty()) ? (2) : (2 * length);
+                     Node* current = static_cast <Node*> (front.next);
+                     while(current != nullptr) {
+                         size += Core::estimateStringSize(current->data);
+                         current = static_cast <Node*> (current->next);
+                     }
+                     return size;
                  }
 
             }
@@ -0,0 +1,345 @@
+
+    /**
+     * @file Detail/FrozenMap/NRE_FrozenMap.hpp
+     * @brief Declaration of Core's API's Container : FrozenMap
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+     #pragma once
+
+    #include <algorithm>
+    #include <cstdint>
+    #include <limits>
+    #include <stdexcept>
+    #include <type_traits>
+    #include <vector>
+
+    #include "../../String/NRE_String.hpp"
+    #include "../../Pair/NRE_Pair.hpp"
+    #include "../../Interfaces/Stringable/NRE_Stringable.hpp"
+    #include "../../Hash/NRE_Hash.hpp"
+    #include "../Vector/NRE_Vector.hpp"
+
+    #include <Memory/Traits/NRE_MemoryTraits.hpp>
+
+     /**
+     * @namespace NRE
+     * @brief The NearlyRealEngine's global namespace
+     */
+    namespace NRE {
+        /**
+         * @namespace Core
+         * @brief Core's API
+         */
+        namespace Core {
+
+            namespace Detail {
+
+                namespace FrozenMapInner {
+
+                    constexpr std::size_t KEYS_PER_BUCKET        = 4;                                        /**< The average number of keys sharing a displacement */
+                    constexpr std::size_t MAX_SEED_ATTEMPTS      = 64;                                       /**< The number of global seeds tried before giving up */
+                    constexpr std::size_t NO_SLOT                = std::numeric_limits<std::size_t>::max();  /**< The slot given to a dropped duplicate key */
+
+                    /**
+                     * @struct Layout
+                     * @brief A minimal perfect hash function and the slot it gives to each key
+                     * Built with std::vector so the same code runs in constant expressions
+                     */
+                    struct Layout {
+                        std::uint64_t seed = 0;                         /**< The global seed mixed into each key hash */
+                        std::vector<std::uint32_t> displacements;       /**< The displacement of each bucket */
+                        std::vector<std::size_t> slots;                 /**< The slot of each key, NO_SLOT for dropped duplicates */
+                        std::size_t count = 0;                          /**< The number of distinct keys, and of slots */
+                    };
+
+                    /**
+                     * Mix a hash with a seed, using the splitmix64 finalizer
+                     * @param h    the hash to mix
+                     * @param seed the seed
+                     * @return     the mixed hash
+                     */
+                    constexpr std::uint64_t mix(std::uint64_t h, std::uint64_t seed);
+                    /**
+                     * Map a 32 bits hash in [0, count) with a multiply and a shift
+                     * @param h     the hash to reduce
+                     * @param count the range size
+                     * @return      the reduced value
+                     */
+                    constexpr std::size_t reduce(std::uint32_t h, std::size_t count);
+                    /**
+                     * @param count the number of keys
+                     * @return      the number of displacement buckets used for count keys
+                     */
+                    constexpr std::size_t bucketCountFor(std::size_t count);
+                    /**
+                     * Find the bucket of a seeded key hash
+                     * @param h           the seeded hash
+                     * @param bucketCount the number of buckets
+                     * @return            the bucket index
+                     */
+                    constexpr std::size_t bucketOf(std::uint64_t h, std::size_t bucketCount);
+                    /**
+                     * Find the slot of a seeded key hash
+                     * @param h            the seeded hash
+                     * @param displacement the key bucket displacement
+                     * @param count        the number of slots
+                     * @return             the slot index
+                     */
+                    constexpr std::size_t slotOf(std::uint64_t h, std::uint32_t displacement, std::size_t count);
+                    /**
+                     * Build a minimal perfect hash function, CHD algorithm : keys are split in small buckets, and the largest buckets
+                     * first search a displacement sending all their keys to free slots
+                     * Keys with equal hashes are compared with sameKey, the later one being dropped when equal
+                     * @param  hashes  the key hashes
+                     * @param  sameKey called with two key indices, tell if both keys are equal
+                     * @return         the built layout
+                     * @throw std::invalid_argument if two different keys have the same hash
+                     * @throw std::length_error     if there is more keys than 32 bits slots
+                     */
+                    template <class SameKey>
+                    constexpr Layout buildLayout(std::vector<std::uint64_t> const& hashes, SameKey && sameKey);
+                }
+
+                /**
+                 * @class FrozenMap
+                 * @brief An immutable map built once from its whole content, around a minimal perfect hash function
+                 *
+                 * Each key owns exactly one slot, a lookup hashes the key, reads its bucket displacement and compares a single entry.
+                 * There is no empty slot and no collision handling, the extra memory being a 32 bits displacement per KEYS_PER_BUCKET keys.
+                 * Duplicated keys are dropped, keeping the first one.
+                 */
+                template <class Key, class T, class Allocator, class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key>>
+                class FrozenMap : public Stringable<FrozenMap<Key, T, Allocator, Hash, KeyEqual>>, private Hash, private KeyEqual {
+                    static_assert(Memory::IsAllocatorV<Allocator>);                                /**< Check if the given AllocatorType inherit from NRE::Memory::AllocatorTraits */
+                    static_assert(std::is_same_v<Pair<Key, T>, typename Allocator::ValueType>);    /**< Make sure the allocator is set for the container inner type */
+
+                    public :    // Traits
+                        /** The map key type */
+                        using KeyType               = Key;
+                        /** The map mapped type */
+                        using MappedType            = T;
+                        /** The container's allocated type */
+                        using ValueType             = Pair<KeyType, MappedType>;
+                        /** The object's size type */
+                        using SizeType              = std::size_t;
+                        /** The object's difference type */
+                        using DifferenceType        = std::ptrdiff_t;
+                        /** The container's allocator */
+                        using AllocatorType         = Allocator;
+                        /** The allocated type const reference */
+                        using ConstReference        = ValueType const&;
+                        /** The allocated type const pointer */
+                        using ConstPointer          = typename AllocatorType::ConstPointer;
+                        /** Immuable random access iterator, in slot order */
+                        using ConstIterator         = typename Detail::Vector<ValueType, Allocator>::ConstIterator;
+                        /** The map only hands out immuable iterators */
+                        using Iterator              = ConstIterator;
+                        /** STL compatibility */
+                        using key_type              = KeyType;
+                        /** STL compatibility */
+                        using mapped_type           = MappedType;
+                        /** STL compatibility */
+                        using value_type            = ValueType;
+                        /** STL compatibility */
+                        using allocator_type        = AllocatorType;
+                        /** STL compatibility */
+                        using size_type             = SizeType;
+                        /** STL compatibility */
+                        using difference_type       = DifferenceType;
+                        /** STL compatibility */
+                        using const_reference       = ConstReference;
+                        /** STL compatibility */
+                        using const_pointer         = ConstPointer;
+                        /** STL compatibility */
+                        using iterator              = Iterator;
+                        /** STL compatibility */
+                        using const_iterator        = ConstIterator;
+
+                    private :   // Fields
+                        Detail::Vector<ValueType, Allocator> entries;                                                   /**< The entries, at their slot */
+                        Detail::Vector<std::uint32_t, typename Allocator::template Rebind<std::uint32_t>> displacements; /**< The displacement of each bucket */
+                        std::uint64_t seed;                                                                             /**< The global seed mixed into each key hash */
+
+                    public :    // Methods
+                        //## Constructor ##//
+                            /**
+                             * Construct an empty map
+                             * @param hasher the hash function used in the map
+                             * @param equal  the equal function used in the map
+                             * @param alloc  the entries memory allocator
+                             */
+                            FrozenMap(Hash const& hasher = Hash(), KeyEqual const& equal = KeyEqual(), Allocator const& alloc = Allocator());
+                            /**
+                             * Construct a map holding the elements in the given range
+                             * @param begin  the begin iterator
+                             * @param end    the end iterator
+                             * @param hasher the hash function used in the map
+                             * @param equal  the equal function used in the map
+                             * @param alloc  the entries memory allocator
+                             * @throw std::invalid_argument if two different keys have the same hash
+                             */
+                            template <class InputIterator>
+                            FrozenMap(InputIterator begin, InputIterator end, Hash const& hasher = Hash(), KeyEqual const& equal = KeyEqual(), Allocator const& alloc = Allocator());
+                            /**
+                             * Construct a map holding the elements in the given list
+                             * @param list   the list to fill the map with
+                             * @param hasher the hash function used in the map
+                             * @param equal  the equal function used in the map
+                             * @param alloc  the entries memory allocator
+                             * @throw std::invalid_argument if two different keys have the same hash
+                             */
+                            FrozenMap(std::initializer_list<ValueType> list, Hash const& hasher = Hash(), KeyEqual const& equal = KeyEqual(), Allocator const& alloc = Allocator());
+
+                        //## Copy Constructor ##//
+                            /**
+                             * Copy map into this
+                             * @param map the map to copy
+                             */
+                            FrozenMap(FrozenMap const& map) = default;
+
+                        //## Move Constructor ##//
+                            /**
+                             * Move map into this
+                             * @param map the map to move
+                             */
+                            FrozenMap(FrozenMap && map) = default;
+
+                        //## Getter ##//
+                            /**
+                             * Return the value mapped to the given key
+                             * @param  k the key to search
+                             * @return   the mapped value
+                             * @throw std::out_of_range if the key is not in the map
+                             */
+                            MappedType const& get(KeyType const& k) const;
+                            /**
+                             * @return the number of elements
+                             */
+                            SizeType getSize() const;
+                            /**
+                             * @return if the map is empty
+                             */
+                            bool isEmpty() const;
+                            /**
+                             * Find the number of element with the given key
+                             * @param  k the key to search
+                             * @return   the number of corresponding elements
+                             */
+                            SizeType getCount(KeyType const& k) const;
+                            /**
+                             * @return the number of displacement buckets
+                             */
+                            SizeType getBucketCount() const;
+                            /**
+                             * @return the allocator
+                             */
+                            Allocator getAllocator() const;
+                            /**
+                             * @return the number of bytes owned by the map, entries and displacements
+                             */
+                            SizeType getMemoryUsage() const;
+
+                        //## Iterator Access ##//
+                            /**
+                             * @return an iterator on the first element
+                             */
+                            ConstIterator begin() const;
+                            /**
+                             * @return an iterator on the first element
+                             */
+                            ConstIterator cbegin() const;
+                            /**
+                             * @return an iterator on the end of the container
+                             */
+                            ConstIterator end() const;
+                            /**
+                             * @return an iterator on the end of the container
+                             */
+                            ConstIterator cend() const;
+
+                        //## Methods ##//
+                            /**
+                             * Find the element with the given key, comparing a single entry
+                             * @param  k the key to search
+                             * @return   an iterator on the element, end if not found
+                             */
+                            ConstIterator find(KeyType const& k) const;
+                            /**
+                             * Swap the map with the given one
+                             * @param map the map to swap with
+                             */
+                            void swap(FrozenMap& map);
+                            /**
+                             * @return the hash function
+                             */
+                            Hash getHash() const;
+                            /**
+                             * @return the key equal function
+                             */
+                            KeyEqual getKeyEqual() const;
+
+                        //## Assignment Operator ##//
+                            /**
+                             * Copy map into this
+                             * @param map the map to copy
+                             * @return    the reference of himself
+                             */
+                            FrozenMap& operator =(FrozenMap const& map) = default;
+                            /**
+                             * Move map into this
+                             * @param map the map to move
+                             * @return    the reference of himself
+                             */
+                            FrozenMap& operator =(FrozenMap && map) = default;
+
+                        //## Comparison Operator ##//
+                            /**
+                             * Equality test between this and map
+                             * @param map the other map
+                             * @return    the test result
+                             */
+                            bool operator ==(FrozenMap const& map) const;
+                            /**
+                             * Inequality test between this and map
+                             * @param map the other map
+                             * @return    the test result
+                             */
+                            bool operator !=(FrozenMap const& map) const;
+
+                        //## Stream Operator ##//
+                            /**
+                             * Convert the map into a string
+                             * @return the converted map
+                             */
+                            [[nodiscard]] String toString() const;
+                            /**
+                             * Append the map's textual form to out, reserving the estimated size once
+                             * @param out the string to append to
+                             */
+                            void toString(String& out) const;
+                            /**
+                             * @return an upper bound estimate of the map's textual form size
+                             */
+                            std::size_t estimateStringSize() const;
+                            /**
+                             * Write the map's textual form into the given sink
+                             * @param sink the destination sink
+                             */
+                            template <class S>
+                            void writeTo(S& sink) const;
+
+                    private :   // Methods
+                        /**
+                         * Build the perfect hash function and move the staged elements to their slot
+                         * @param staged the elements, in input order
+                         */
+                        void build(Detail::Vector<ValueType, Allocator>& staged);
+                };
+            }
+        }
+    }
+
+    #include "NRE_FrozenMap.tpp"
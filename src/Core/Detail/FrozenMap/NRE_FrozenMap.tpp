@@ -0,0 +1,358 @@
+
+    /**
+     * @file NRE_FrozenMap.tpp
+     * @brief Implementation of Core's API's Container : FrozenMap
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+     namespace NRE {
+         namespace Core {
+             namespace Detail {
+
+                 namespace FrozenMapInner {
+
+                     constexpr std::uint64_t mix(std::uint64_t h, std::uint64_t seed) {
+                         h ^= seed * 0x9E3779B97F4A7C15ULL;
+                         h ^= h >> 30;
+                         h *= 0xBF58476D1CE4E5B9ULL;
+                         h ^= h >> 27;
+                         h *= 0x94D049BB133111EBULL;
+                         h ^= h >> 31;
+                         return h;
+                     }
+
+                     constexpr std::size_t reduce(std::uint32_t h, std::size_t count) {
+                         return static_cast <std::size_t> ((static_cast <std::uint64_t> (h) * count) >> 32);
+                     }
+
+                     constexpr std::size_t bucketCountFor(std::size_t count) {
+                         return (count == 0) ? (1) : ((count + KEYS_PER_BUCKET - 1) / KEYS_PER_BUCKET);
+                     }
+
+                     constexpr std::size_t bucketOf(std::uint64_t h, std::size_t bucketCount) {
+                         return reduce(static_cast <std::uint32_t> (h >> 32), bucketCount);
+                     }
+
+                     constexpr std::size_t slotOf(std::uint64_t h, std::uint32_t displacement, std::size_t count) {
+                         return reduce(static_cast <std::uint32_t> (mix(h, displacement)), count);
+                     }
+
+                     template <class SameKey>
+                     constexpr Layout buildLayout(std::vector<std::uint64_t> const& hashes, SameKey && sameKey) {
+                         std::size_t total = hashes.size();
+                         if (total > std::numeric_limits<std::uint32_t>::max()) {
+                             throw std::length_error("NRE::Core::FrozenMap can't hold more than 2^32 elements.");
+                         }
+                         std::size_t bucketCount = bucketCountFor(total);
+                         Layout layout;
+                         layout.displacements.assign(bucketCount, 0);
+                         layout.slots.assign(total, NO_SLOT);
+                         if (total == 0) {
+                             return layout;
+                         }
+
+                         std::vector<std::uint64_t> seeded(total, 0);
+                         std::vector<std::size_t> members(total, 0);
+                         std::vector<std::size_t> bucketStart(bucketCount + 1, 0);
+                         std::vector<std::size_t> bucketSize(bucketCount, 0);
+                         std::vector<char> dropped(total, 0);
+                         for (std::size_t attempt = 0; attempt < MAX_SEED_ATTEMPTS; ++attempt) {
+                             layout.seed = attempt;
+                             for (std::size_t bucket = 0; bucket <= bucketCount; ++bucket) {
+                                 bucketStart[bucket] = 0;
+                             }
+                             for (std::size_t index = 0; index < total; ++index) {
+                                 seeded[index] = mix(hashes[index], layout.seed);
+                                 ++bucketStart[bucketOf(seeded[index], bucketCount) + 1];
+                             }
+                             for (std::size_t bucket = 0; bucket < bucketCount; ++bucket) {
+                                 bucketStart[bucket + 1] += bucketStart[bucket];
+                             }
+                             std::vector<std::size_t> fill(bucketStart.begin(), bucketStart.end() - 1);
+                             for (std::size_t index = 0; index < total; ++index) {
+                                 members[fill[bucketOf(seeded[index], bucketCount)]++] = index;
+                             }
+
+                             if (attempt == 0) {
+                                 // Equal keys have equal hashes and share a bucket, members being in input order the first one is kept
+                                 layout.count = total;
+                                 for (std::size_t bucket = 0; bucket < bucketCount; ++bucket) {
+                                     for (std::size_t first = bucketStart[bucket]; first < bucketStart[bucket + 1]; ++first) {
+                                         for (std::size_t second = first + 1; second < bucketStart[bucket + 1]; ++second) {
+                                             std::size_t kept = members[first], other = members[second];
+                                             if (dropped[kept] || dropped[other] || hashes[kept] != hashes[other]) {
+                                                 continue;
+                                             }
+                                             if (!sameKey(kept, other)) {
+                                                 throw std::invalid_argument("NRE::Core::FrozenMap can't separate two different keys with the same hash.");
+                                             }
+                                             dropped[other] = 1;
+                                             --layout.count;
+                                         }
+                                     }
+                                 }
+                             }
+
+                             std::size_t maxSize = 0;
+                             for (std::size_t bucket = 0; bucket < bucketCount; ++bucket) {
+                                 bucketSize[bucket] = 0;
+                                 for (std::size_t member = bucketStart[bucket]; member < bucketStart[bucket + 1]; ++member) {
+                                     bucketSize[bucket] += (dropped[members[member]]) ? (0) : (1);
+                                 }
+                                 maxSize = std::max(maxSize, bucketSize[bucket]);
+                             }
+
+                             std::vector<char> taken(layout.count, 0);
+                             std::vector<std::size_t> candidates(maxSize, 0);
+                             std::uint64_t maxDisplacement = std::min<std::uint64_t>(64 * static_cast <std::uint64_t> (layout.count) + 1024, std::numeric_limits<std::uint32_t>::max());
+                             bool placed = true;
+                             for (std::size_t size = maxSize; size > 0 && placed; --size) {
+                                 for (std::size_t bucket = 0; bucket < bucketCount && placed; ++bucket) {
+                                     if (bucketSize[bucket] != size) {
+                                         continue;
+                                     }
+                                     placed = false;
+                                     for (std::uint64_t displacement = 0; displacement < maxDisplacement && !placed; ++displacement) {
+                                         std::size_t found = 0;
+                                         bool fits = true;
+                                         for (std::size_t member = bucketStart[bucket]; member < bucketStart[bucket + 1] && fits; ++member) {
+                                             std::size_t index = members[member];
+                                             if (dropped[index]) {
+                                                 continue;
+                                             }
+                                             std::size_t slot = slotOf(seeded[index], static_cast <std::uint32_t> (displacement), layout.count);
+                                             fits = !taken[slot];
+                                             for (std::size_t previous = 0; previous < found && fits; ++previous) {
+                                                 fits = candidates[previous] != slot;
+                                             }
+                                             candidates[found++] = slot;
+                                         }
+                                         if (!fits) {
+                                             continue;
+                                         }
+                                         found = 0;
+                                         for (std::size_t member = bucketStart[bucket]; member < bucketStart[bucket + 1]; ++member) {
+                                             std::size_t index = members[member];
+                                             if (!dropped[index]) {
+                                                 layout.slots[index] = candidates[found];
+                                                 taken[candidates[found++]] = 1;
+                                             }
+                                         }
+                                         layout.displacements[bucket] = static_cast <std::uint32_t> (displacement);
+                                         placed = true;
+                                     }
+                                 }
+                             }
+                             if (placed) {
+                                 return layout;
+                             }
+                             for (std::size_t bucket = 0; bucket < bucketCount; ++bucket) {
+                                 layout.displacements[bucket] = 0;
+                             }
+                         }
+                         throw std::runtime_error("NRE::Core::FrozenMap failed to build its perfect hash function.");
+                     }
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual>
+                 inline FrozenMap<Key, T, Allocator, Hash, KeyEqual>::FrozenMap(Hash const& hasher, KeyEqual const& equal, Allocator const& alloc) : Hash(hasher), KeyEqual(equal), entries(alloc), displacements(alloc), seed(0) {
+                     displacements.pushBack(0);
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual>
+                 template <class InputIterator>
+                 inline FrozenMap<Key, T, Allocator, Hash, KeyEqual>::FrozenMap(InputIterator begin, InputIterator end, Hash const& hasher, KeyEqual const& equal, Allocator const& alloc) : Hash(hasher), KeyEqual(equal), entries(alloc), displacements(alloc), seed(0) {
+                     Detail::Vector<ValueType, Allocator> staged(alloc);
+                     for (; begin != end; ++begin) {
+                         staged.pushBack(*begin);
+                     }
+                     build(staged);
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual>
+                 inline FrozenMap<Key, T, Allocator, Hash, KeyEqual>::FrozenMap(std::initializer_list<ValueType> list, Hash const& hasher, KeyEqual const& equal, Allocator const& alloc) : FrozenMap(list.begin(), list.end(), hasher, equal, alloc) {
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual>
+                 inline typename FrozenMap<Key, T, Allocator, Hash, KeyEqual>::MappedType const& FrozenMap<Key, T, Allocator, Hash, KeyEqual>::get(KeyType const& k) const {
+                     ConstIterator it = find(k);
+                     if (it == end()) {
+                         throw std::out_of_range("Accessing non-existing key in NRE::Core::FrozenMap.");
+                     }
+                     return it->second;
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual>
+                 inline typename FrozenMap<Key, T, Allocator, Hash, KeyEqual>::SizeType FrozenMap<Key, T, Allocator, Hash, KeyEqual>::getSize() const {
+                     return entries.getSize();
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual>
+                 inline bool FrozenMap<Key, T, Allocator, Hash, KeyEqual>::isEmpty() const {
+                     return entries.isEmpty();
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual>
+                 inline typename FrozenMap<Key, T, Allocator, Hash, KeyEqual>::SizeType FrozenMap<Key, T, Allocator, Hash, KeyEqual>::getCount(KeyType const& k) const {
+                     return (find(k) == end()) ? (0) : (1);
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual>
+                 inline typename FrozenMap<Key, T, Allocator, Hash, KeyEqual>::SizeType FrozenMap<Key, T, Allocator, Hash, KeyEqual>::getBucketCount() const {
+                     return displacements.getSize();
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual>
+                 inline Allocator FrozenMap<Key, T, Allocator, Hash, KeyEqual>::getAllocator() const {
+                     return entries.getAllocator();
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual>
+                 inline typename FrozenMap<Key, T, Allocator, Hash, KeyEqual>::SizeType FrozenMap<Key, T, Allocator, Hash, KeyEqual>::getMemoryUsage() const {
+                     return entries.getCapacity() * sizeof(ValueType) + displacements.getCapacity() * sizeof(std::uint32_t);
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual>
+                 inline typename FrozenMap<Key, T, Allocator, Hash, KeyEqual>::ConstIterator FrozenMap<Key, T, Allocator, Hash, KeyEqual>::begin() const {
+                     return entries.begin();
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual>
+                 inline typename FrozenMap<Key, T, Allocator, Hash, KeyEqual>::ConstIterator FrozenMap<Key, T, Allocator, Hash, KeyEqual>::cbegin() const {
+                     return begin();
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual>
+                 inline typename FrozenMap<Key, T, Allocator, Hash, KeyEqual>::ConstIterator FrozenMap<Key, T, Allocator, Hash, KeyEqual>::end() const {
+                     return entries.end();
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual>
+                 inline typename FrozenMap<Key, T, Allocator, Hash, KeyEqual>::ConstIterator FrozenMap<Key, T, Allocator, Hash, KeyEqual>::cend() const {
+                     return end();
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual>
+                 inline typename FrozenMap<Key, T, Allocator, Hash, KeyEqual>::ConstIterator FrozenMap<Key, T, Allocator, Hash, KeyEqual>::find(KeyType const& k) const {
+                     if (isEmpty()) {
+                         return end();
+                     }
+                     std::uint64_t h = FrozenMapInner::mix(static_cast <std::uint64_t> (Hash::operator ()(k)), seed);
+                     SizeType slot = FrozenMapInner::slotOf(h, displacements[FrozenMapInner::bucketOf(h, displacements.getSize())], entries.getSize());
+                     if (KeyEqual::operator ()(entries[slot].first, k)) {
+                         return begin() + slot;
+                     }
+                     return end();
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual>
+                 inline void FrozenMap<Key, T, Allocator, Hash, KeyEqual>::swap(FrozenMap& map) {
+                     using std::swap;
+                     swap(static_cast <Hash&> (*this), static_cast <Hash&> (map));
+                     swap(static_cast <KeyEqual&> (*this), static_cast <KeyEqual&> (map));
+                     swap(entries, map.entries);
+                     swap(displacements, map.displacements);
+                     swap(seed, map.seed);
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual>
+                 inline Hash FrozenMap<Key, T, Allocator, Hash, KeyEqual>::getHash() const {
+                     return static_cast <Hash const&> (*this);
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual>
+                 inline KeyEqual FrozenMap<Key, T, Allocator, Hash, KeyEqual>::getKeyEqual() const {
+                     return static_cast <KeyEqual const&> (*this);
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual>
+                 inline bool FrozenMap<Key, T, Allocator, Hash, KeyEqual>::operator ==(FrozenMap const& map) const {
+                     if (getSize() != map.getSize()) {
+                         return false;
+                     }
+                     for (ConstReference entry : entries) {
+                         ConstIterator it = map.find(entry.first);
+                         if (it == map.end() || !(it->second == entry.second)) {
+                             return false;
+                         }
+                     }
+                     return true;
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual>
+                 inline bool FrozenMap<Key, T, Allocator, Hash, KeyEqual>::operator !=(FrozenMap const& map) const {
+                     return !(*this == map);
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual>
+                 inline String FrozenMap<Key, T, Allocator, Hash, KeyEqual>::toString() const {
+                     String res;
+                     toString(res);
+                     return res;
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual>
+                 inline void FrozenMap<Key, T, Allocator, Hash, KeyEqual>::toString(String& out) const {
+                     out.reserve(out.getSize() + estimateStringSize());
+                     StringSink sink(out);
+                     writeTo(sink);
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual>
+                 template <class S>
+                 inline void FrozenMap<Key, T, Allocator, Hash, KeyEqual>::writeTo(S& sink) const {
+                     sink.write("{", 1);
+                     if (!isEmpty()) {
+                         ConstIterator first = begin();
+                         Core::format(sink, *first);
+                         ++first;
+                         while (first != end()) {
+                             sink.write(", ", 2);
+                             Core::format(sink, *first);
+                             ++first;
+                         }
+                     }
+                     sink.write("}", 1);
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual>
+                 inline std::size_t FrozenMap<Key, T, Allocator, Hash, KeyEqual>::estimateStringSize() const {
+                     std::size_t size = (isEmpty()) ? (2) : (2 * getSize());
+                     for (ConstReference entry : entries) {
+                         size += Core::estimateStringSize(entry);
+                     }
+                     return size;
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual>
+                 inline void FrozenMap<Key, T, Allocator, Hash, KeyEqual>::build(Detail::Vector<ValueType, Allocator>& staged) {
+                     std::vector<std::uint64_t> hashes;
+                     hashes.reserve(staged.getSize());
+                     for (ConstReference value : staged) {
+                         hashes.push_back(static_cast <std::uint64_t> (Hash::operator ()(value.first)));
+                     }
+                     FrozenMapInner::Layout layout = FrozenMapInner::buildLayout(hashes, [this, &staged](SizeType first, SizeType second) {
+                         return KeyEqual::operator ()(staged[first].first, staged[second].first);
+                     });
+
+                     std::vector<SizeType> order(layout.count);
+                     for (SizeType index = 0; index < staged.getSize(); ++index) {
+                         if (layout.slots[index] != FrozenMapInner::NO_SLOT) {
+                             order[layout.slots[index]] = index;
+                         }
+                     }
+                     entries.reserve(layout.count);
+                     for (SizeType slot = 0; slot < layout.count; ++slot) {
+                         entries.emplaceBack(std::move(staged[order[slot]]));
+                     }
+                     displacements.reserve(layout.displacements.size());
+                     for (std::uint32_t displacement : layout.displacements) {
+                         displacements.pushBack(displacement);
+                     }
+                     seed = layout.seed;
+                 }
+             }
+         }
+     }
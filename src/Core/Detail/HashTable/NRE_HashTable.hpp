@@ -9,14 +9,29 @@
 
     #pragma once
 
+    #include <bit>
+    #include <algorithm>
     #include <climits>
+    #include <optional>
+    #include <memory>
+    #include <thread>
+    #include <exception>
+    #include <cstring>
+    #include <utility>
 
     #include "../../String/NRE_String.hpp"
     #include "../../Pair/NRE_Pair.hpp"
     #include "../../Interfaces/Stringable/NRE_Stringable.hpp"
     #include "../../Interfaces/Iterator/NRE_IteratorBase.hpp"
+    #include "../../Interfaces/Uncopyable/NRE_Uncopyable.hpp"
     #include "../../Traits/NRE_TypeTraits.hpp"
+    #include "../../Hash/NRE_HashedKey.hpp"
+    #include "../../Hash/NRE_HashMix.hpp"
     #include "../Vector/NRE_Vector.hpp"
+    #include "NRE_HashTableStatistics.hpp"
+    #include "NRE_HashTableSnapshot.hpp"
+
+    #include <Memory/Traits/NRE_MemoryTraits.hpp>
 
     /**
     * @namespace NRE
@@ -30,10 +45,26 @@
         namespace Core {
             
             namespace Detail {
+
+                template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                class HashTable;
     
                 namespace HashTableInner {
                     /** Hide hash type implementation */
                     using TruncatedHash = std::uint_least32_t;
+                    /** The occupancy bitmap word, one bit per bucket */
+                    using OccupancyWord = std::uint64_t;
+
+                    /** The number of buckets tracked by an occupancy word */
+                    constexpr std::size_t OCCUPANCY_WORD_BITS = sizeof(OccupancyWord) * CHAR_BIT;
+
+                    /**
+                     * Find the first occupied bucket starting from the given one, the bitmap must hold a set bit after the last bucket
+                     * @param  occupancy the occupancy bitmap
+                     * @param  index     the first bucket to test
+                     * @return           the occupied bucket index, or the bucket count if none
+                     */
+                    std::size_t findNextOccupied(OccupancyWord const* occupancy, std::size_t index);
     
                     /**
                      * @class BucketEntryHash
@@ -108,12 +139,13 @@
                         public :    // Typedef
                             /** The bucket distance type */
                             using DistanceType  = std::int_least16_t;
+                            /** The bucket packed metadata type, holding the last bucket flag and the distance to the next bucket */
+                            using MetadataType  = std::uint_least16_t;
                             /** The bucket internal storage type */
                             using Storage       = typename std::aligned_storage<sizeof(ValueType), alignof(ValueType)>::type;
             
                         private :   // Fields
-                            DistanceType distanceToNext;    /**< The ideal distance to the next bucket */
-                            bool last;                      /**< Tell if the bucket is the last filled */
+                            MetadataType metadata;          /**< The last bucket flag in the high bit, the distance to the next bucket plus one in the others, 0 if empty */
                             Storage data;                   /**< The bucket entry data */
             
                         public :    // Methods
@@ -195,6 +227,14 @@
                                  * @param newData  the data to set
                                  */
                                 void swapWithData(DistanceType& distance, TruncatedHash& h, ValueType& newData);
+                
+                        private :   // Methods
+                            //## Setter ##//
+                                /**
+                                 * Set the distance to the next bucket, keeping the last bucket flag
+                                 * @param distance the new distance, EMPTY_BUCKET_DISTANCE to mark the bucket as empty
+                                 */
+                                void setDistanceToNext(DistanceType distance);
                     
                             //## Assignment Operator ##//
                                 /**
@@ -211,7 +251,9 @@
                                 BucketEntry& operator =(BucketEntry && bucket);
             
                         public :    // Static
-                            static const DistanceType EMPTY_BUCKET_DISTANCE = -1; /**< The distance used to mark a bucket as empty */
+                            static const DistanceType EMPTY_BUCKET_DISTANCE = -1;        /**< The distance used to mark a bucket as empty */
+                            static const MetadataType LAST_BUCKET_FLAG      = 0x8000;    /**< The metadata bit marking the last bucket */
+                            static const MetadataType DISTANCE_MASK         = 0x7FFF;    /**< The metadata bits holding the distance */
                 
                     };
     
@@ -221,6 +263,9 @@
                      */
                     template <class T, class Category, class Bucket>
                     class ForwardIterator : public IteratorBase<ForwardIterator<T, Category, Bucket>, T, Category> {
+                        template <class, class, class>
+                        friend class ForwardIterator;
+
                         public :    // Traits
                             /** Inherited iterator traits */
                             using Traits = IteratorBase<ForwardIterator<T, Category, Bucket>, T, Category>;
@@ -244,7 +289,10 @@
                             using iterator_category = typename Traits::iterator_category;
         
                         private :   // Fields
-                            Bucket* current;   /**< The current iterator bucket */
+                            Bucket* current;                    /**< The current iterator bucket */
+                            Bucket* following;                  /**< The first bucket of the array iterated after the current one, nullptr if none */
+                            OccupancyWord const* occupancy;     /**< The buckets occupancy bitmap used to skip empty buckets, nullptr to test each bucket */
+                            Bucket* first;                      /**< The first bucket of the array described by the occupancy bitmap */
         
                         public :    // Methods
                             //## Constructor ##//
@@ -254,14 +302,20 @@
                                 ForwardIterator() = default;
                                 /**
                                  * Construct the iterator with the given node
-                                 * @param bucket the iterator bucket
+                                 * @param bucket   the iterator bucket
+                                 * @param next     the first bucket of the array iterated after the bucket's one
+                                 * @param occupied the bucket's array occupancy bitmap, nullptr to test each bucket
+                                 * @param base     the first bucket of the bucket's array, used with the occupancy bitmap
                                  */
-                                ForwardIterator(Bucket* bucket);
+                                ForwardIterator(Bucket* bucket, Bucket* next = nullptr, OccupancyWord const* occupied = nullptr, Bucket* base = nullptr);
                                 /**
                                  * Construct the iterator with the given node
-                                 * @param bucket the iterator bucket
+                                 * @param bucket   the iterator bucket
+                                 * @param next     the first bucket of the array iterated after the bucket's one
+                                 * @param occupied the bucket's array occupancy bitmap, nullptr to test each bucket
+                                 * @param base     the first bucket of the bucket's array, used with the occupancy bitmap
                                  */
-                                ForwardIterator(const Bucket* bucket);
+                                ForwardIterator(const Bucket* bucket, const Bucket* next = nullptr, OccupancyWord const* occupied = nullptr, const Bucket* base = nullptr);
             
                             //## Copy Constructor ##//
                                 /**
@@ -277,6 +331,14 @@
                                  */
                                 ForwardIterator(ForwardIterator && it) = default;
             
+                            //## Convertor ##//
+                                /**
+                                 * Convert an iterator of another category on the same buckets, keeping its position, following array and occupancy bitmap
+                                 * @param it the iterator to convert
+                                 */
+                                template <class OtherCategory>
+                                explicit ForwardIterator(ForwardIterator<T, OtherCategory, Bucket> const& it);
+            
                             //## Deconstructor ##//
                                 /**
                                  * ForwardIterator Deconstructor
@@ -288,6 +350,10 @@
                                  * @return the current bucket
                                  */
                                 Bucket* getCurrent();
+                                /**
+                                 * @return the first bucket of the array iterated after the current one
+                                 */
+                                Bucket* getFollowing() const;
             
                             //## Methods ##//
                                 /**
@@ -299,7 +365,8 @@
                                  */
                                 void increment();
                                 /**
-                                 * Test if the given iterator point to the same position
+                                 * Test if the given iterator point to the same position, the following array is compared too as the new
+                                 * buckets end may be the first bucket of the previous ones
                                  * @param it the other iterator
                                  * @return   the test's result
                                  */
@@ -418,31 +485,187 @@
                                  */
                                 LocalForwardIterator& operator =(LocalForwardIterator && it) = default;
                     };
+    
+                    /**
+                     * @class KeyExtractor
+                     * @brief Key extractor policy, a map stores key-value pairs and extracts the key from the pair
+                     */
+                    template <class Key, class T>
+                    class KeyExtractor {
+                        public :    // Traits
+                            /** The stored value type */
+                            using ValueType     = Pair<Key, T>;
+                            /** The mapped type */
+                            using MappedType    = T;
+            
+                        public :    // Static
+                            /**
+                             * Extract the key from a stored value
+                             * @param  value the stored value
+                             * @return       the value's key
+                             */
+                            static Key const& extract(ValueType const& value) {
+                                return value.first;
+                            }
+                    };
+    
+                    /**
+                     * @class KeyExtractor
+                     * @brief Key extractor policy, a set stores keys only, a key being its own value
+                     */
+                    template <class Key>
+                    class KeyExtractor<Key, void> {
+                        public :    // Traits
+                            /** The stored value type */
+                            using ValueType     = Key;
+                            /** The mapped type, a set maps a key to itself */
+                            using MappedType    = const Key;
+            
+                        public :    // Static
+                            /**
+                             * Extract the key from a stored value
+                             * @param  value the stored value
+                             * @return       the value itself
+                             */
+                            static Key const& extract(ValueType const& value) {
+                                return value;
+                            }
+                    };
+
+                    /**
+                     * @class NodeHandle
+                     * @brief Own an element extracted from a hash table, with the truncated hash stored in its bucket
+                     * A node inserted in a table of the same type and hash seed reuses the stored hash instead of hashing the key again,
+                     * provided the hash function has no state besides its seed
+                     * Trivially copyable elements are relocated by copying their bytes, others are moved
+                     */
+                    template <class Key, class T>
+                    class NodeHandle : public Uncopyable<NodeHandle<Key, T>> {
+                        template <class, class, class, bool, class, class, class>
+                        friend class Detail::HashTable;
+
+                        public :    // Traits
+                            /** The node key type */
+                            using KeyType       = Key;
+                            /** The node mapped type */
+                            using MappedType    = typename KeyExtractor<Key, T>::MappedType;
+                            /** The node element type, a key-value pair or a key alone */
+                            using ValueType     = typename KeyExtractor<Key, T>::ValueType;
+
+                        private :   // Traits
+                            /** The node internal storage type */
+                            using Storage       = typename std::aligned_storage<sizeof(ValueType), alignof(ValueType)>::type;
+
+                        private :   // Fields
+                            Storage data;           /**< The node element */
+                            bool full;              /**< Tell if the node holds an element */
+                            bool hashed;            /**< Tell if hash holds the element stored truncated hash */
+                            TruncatedHash hash;     /**< The element truncated hash, taken from its bucket */
+                            std::uint64_t seed;     /**< The hash function seed of the table the element comes from */
+                            void const* origin;     /**< Identify the type of the table the element comes from */
+
+                        public :    // Methods
+                            //## Constructor ##//
+                                /**
+                                 * Construct an empty node
+                                 */
+                                NodeHandle();
+
+                            //## Move Constructor ##//
+                                /**
+                                 * Move node into this, leaving it empty
+                                 * @param node the node to move
+                                 */
+                                NodeHandle(NodeHandle && node);
+
+                            //## Deconstructor ##//
+                                /**
+                                 * NodeHandle Deconstructor
+                                 */
+                                ~NodeHandle();
+
+                            //## Getter ##//
+                                /**
+                                 * @return if the node holds no element
+                                 */
+                                bool isEmpty() const;
+                                /**
+                                 * @return the element key, the node must not be empty
+                                 */
+                                KeyType const& getKey() const;
+                                /**
+                                 * @return the element, the node must not be empty
+                                 */
+                                ValueType const& getValue() const;
+                                /**
+                                 * @return the element mapped value, the node must not be empty
+                                 */
+                                MappedType& getMapped() requires (!std::is_void_v<T>);
+
+                            //## Assignment Operator ##//
+                                /**
+                                 * Move node into this, leaving it empty
+                                 * @param node the node to move
+                                 * @return     the reference of himself
+                                 */
+                                NodeHandle& operator =(NodeHandle && node);
+
+                        private :   // Methods
+                            /**
+                             * Construct a node from a bucket element, the bucket is left to be cleared by the table
+                             * @param value    the element to relocate
+                             * @param isHashed tell if h is the element stored truncated hash
+                             * @param h        the element truncated hash
+                             * @param hashSeed the hash function seed of the element table
+                             * @param source   the identifier of the element table type
+                             */
+                            NodeHandle(ValueType& value, bool isHashed, TruncatedHash h, std::uint64_t hashSeed, void const* source);
+                            /**
+                             * @return the element, the node must not be empty
+                             */
+                            ValueType& getData();
+                            /**
+                             * Relocate the given element in the node storage, the node must be empty
+                             * @param value the element to relocate, left to be destroyed by its owner
+                             */
+                            void construct(ValueType& value);
+                            /**
+                             * Destroy the element if any, leaving the node empty
+                             */
+                            void reset();
+                    };
                 }
                 
                 /**
                  * @class HashTable
                  * @brief Based on TSL Robin Hash, An hashtable used in map and set, an associative container using linear probing, robin hood and shift back optimisation
+                 * Hashes go through the Mix finalizer policy before being masked, so keys hashed by identity don't pile up in a few buckets
+                 * A void mapped type stores keys only, as used by sets
+                 * The table only grows by default, a minimum load factor makes erasing by key shrink it once the load falls under it
                  */
-                template <class Key, class T, class Allocator, bool StoreHash = false, class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key>>
-                class HashTable : public Stringable<HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>>, private Hash, private KeyEqual {
+                template <class Key, class T, class Allocator, bool StoreHash = false, class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key>, class Mix = DefaultHashMix<Key, Hash>>
+                class HashTable : public Stringable<HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>>, private Hash, private KeyEqual {
                     static_assert(Memory::IsAllocatorV<Allocator>);                                /**< Check if the given AllocatorType inherit from NRE::Memory::AllocatorTraits */
-                    static_assert(std::is_same_v<Pair<Key, T>, typename Allocator::ValueType>);    /**< Make sure the allocator is set for the container inner type */
+                    static_assert(std::is_same_v<typename HashTableInner::KeyExtractor<Key, T>::ValueType, typename Allocator::ValueType>);    /**< Make sure the allocator is set for the container inner type */
                     
                     public :    // Traits
                         /** The table key type */
                         using KeyType               = Key;
                         /** The table mapped type */
-                        using MappedType            = T;
-                        /** The container's allocated type */
-                        using ValueType             = Pair<KeyType, MappedType>;
+                        using MappedType            = typename HashTableInner::KeyExtractor<Key, T>::MappedType;
+                        /** The container's allocated type, a key-value pair or a key alone */
+                        using ValueType             = typename HashTableInner::KeyExtractor<Key, T>::ValueType;
                         
                     private :   // Traits
+                        /** Shortcut to the key extractor policy */
+                        using Extractor = HashTableInner::KeyExtractor<Key, T>;
                         /** Shortcut to bucket entry */
                         template <class K, bool Store>
                         using BucketEntry = HashTableInner::BucketEntry<K, Store>;
                         /** Shortcut to truncated hash */
                         using TruncatedHash = HashTableInner::TruncatedHash;
+                        /** Shortcut to occupancy bitmap word */
+                        using OccupancyWord = HashTableInner::OccupancyWord;
                         
                     private :     // Static
                         static constexpr bool STORE_HASH = StoreHash || ((sizeof(BucketEntry<ValueType, true>) == sizeof(BucketEntry<ValueType, false>)) && (!std::is_arithmetic<KeyType>::value || !std::is_same<Hash, std::hash<KeyType>>::value));    /**< Tell if we store the hash in the bucket with the key */
@@ -498,6 +721,10 @@
                         using local_iterator        = LocalIterator;
                         /** STL compatibility */
                         using const_local_iterator  = ConstLocalIterator;
+                        /** The table statistics snapshot */
+                        using Statistics            = HashTableInner::HashTableStatistics;
+                        /** The extracted element node */
+                        using NodeType              = HashTableInner::NodeHandle<Key, T>;
     
                     private :    // Fields
                         Detail::Vector<ContainerType, AllocatorType> data;   /**< The hash table data */
@@ -505,7 +732,15 @@
                         SizeType mask;                                       /**< The mask used with the power of two policy */
                         SizeType loadThresHold;                              /**< The number of element before growing the table */
                         float maxLoadFactor;                                 /**< The maximum load factor before rehash and grow */
+                        float minLoadFactor;                                 /**< The load factor under which erasing by key shrinks the table, 0 to never shrink */
                         bool growAtNextInsert;                               /**< Used to grow at the next insert call */
+                        Detail::Vector<ContainerType, AllocatorType> oldData;/**< The previous buckets, not empty while an incremental rehash is in progress */
+                        SizeType oldMask;                                    /**< The previous buckets mask */
+                        SizeType migrationStart;                             /**< The first previous bucket moved, starting a cluster */
+                        SizeType migrated;                                   /**< The number of previous buckets already moved */
+                        SizeType rehashStep;                                 /**< The number of previous buckets moved at each insert or erase, 0 to grow in one go */
+                        Detail::Vector<OccupancyWord, typename Allocator::template Rebind<OccupancyWord>> occupancy; /**< One bit per current bucket set when occupied, plus a set bit after the last one */
+                        [[no_unique_address]] HashTableInner::StatisticsCounters<HashTableInner::COLLECT_STATISTICS> counters;    /**< The event counters, empty unless NRE_USE_HASHTABLE_STATISTICS is defined */
         
                     public :     // Methods
                         //## Constructor ##//
@@ -577,6 +812,20 @@
                              * @return   the corresponding element
                              */
                             MappedType const& get(KeyType const& k) const;
+                            /**
+                             * Access a particular element with bound checking, with any key comparable to KeyType when the hash and equal functions are transparent
+                             * @param  k the element key
+                             * @return   the corresponding element
+                             */
+                            template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                            MappedType& get(K const& k);
+                            /**
+                             * Access a particular element with bound checking, with any key comparable to KeyType when the hash and equal functions are transparent
+                             * @param  k the element key
+                             * @return   the corresponding element
+                             */
+                            template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                            MappedType const& get(K const& k) const;
                             /**
                              * @return the number of buckets in the table
                              */
@@ -593,6 +842,10 @@
                              * @return the maximum load factor
                              */
                             float getMaxLoadFactor() const;
+                            /**
+                             * @return the minimum load factor, 0 if the table never shrinks on its own
+                             */
+                            float getMinLoadFactor() const;
                             /**
                              * @return the current load factor
                              */
@@ -615,12 +868,50 @@
                              * @return   the number of corresponding elements
                              */
                             SizeType getCount(KeyType const& k) const;
+                            /**
+                             * Find the number of element with the given key, using its precomputed hash
+                             * @param  k         the key to search
+                             * @param  hashValue the key hash, computed with the table hash function
+                             * @return           the number of corresponding elements
+                             */
+                            SizeType getCount(KeyType const& k, SizeType hashValue) const;
+                            /**
+                             * Find the number of element with the given key, using its precomputed hash
+                             * @param  k the key to search with its hash
+                             * @return   the number of corresponding elements
+                             */
+                            SizeType getCount(HashedKey<KeyType> const& k) const;
+                            /**
+                             * Find the number of element with the given key, with any key comparable to KeyType when the hash and equal functions are transparent
+                             * @param  k the key to search
+                             * @return   the number of corresponding elements
+                             */
+                            template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                            SizeType getCount(K const& k) const;
                             /**
                              * Get the bucket index from a given key
                              * @param  k the key to search
                              * @return   the corresponding bucket
                              */
                             SizeType getBucket(KeyType const& k) const;
+                            /**
+                             * @return the number of bytes used by the table, its buckets included
+                             */
+                            SizeType getMemoryUsage() const;
+                            /**
+                             * Take a snapshot of the table layout, scanning every bucket, and of its event counters
+                             * Events are only counted when NRE_USE_HASHTABLE_STATISTICS is defined, their counters stay at 0 otherwise
+                             * @return the table statistics
+                             */
+                            Statistics getStatistics() const;
+                            /**
+                             * @return if an incremental rehash is in progress, the elements are then split between the previous and the current buckets
+                             */
+                            bool isRehashing() const;
+                            /**
+                             * @return the number of previous buckets moved at each insert or erase during an incremental rehash, 0 if the table grows in one go
+                             */
+                            SizeType getRehashStep() const;
             
                         //## Setter ##//
                             /**
@@ -628,6 +919,20 @@
                              * @param factor the new factor
                              */
                             void setMaxLoadFactor(float factor);
+                            /**
+                             * Set the load factor under which erasing by key shrinks the table, 0 to never shrink
+                             * It must stay under a quarter of the max load factor, a shrunk table being left half loaded so it doesn't grow back right away
+                             * Lowering the max load factor lowers it as well if needed
+                             * @param factor the new factor
+                             */
+                            void setMinLoadFactor(float factor);
+                            /**
+                             * Set the number of previous buckets moved at each insert or erase when the table grows, bounding the insert latency
+                             * A step of 0 disable the incremental rehash, the whole table is then moved in one go
+                             * A too small step is raised so the migration always ends before the table has to grow again
+                             * @param step the new step
+                             */
+                            void setRehashStep(SizeType step);
             
                         //## Iterator Access ##//
                             /**
@@ -712,11 +1017,28 @@
                              */
                             template <class InputIterator>
                             void insert(InputIterator begin, InputIterator end);
+                            /**
+                             * Insert elements in the given range from several threads : keys are hashed in parallel, radix partitioned by home bucket range,
+                             * then each thread places its partitions in its own slice of the bucket array, elements spilling out of a slice being inserted serially in input order at the end
+                             * The resulting table behaves as one filled by insert, the first of duplicated keys being kept
+                             * Falls back to insert if the table isn't empty, or if the range is small or made of other types than ValueType
+                             * @param begin       the begin iterator
+                             * @param end         the end iterator
+                             * @param threadCount the number of threads, 0 to use the hardware concurrency
+                             */
+                            template <class RandomAccessIterator> requires Concept::RandomAccessIterator<RandomAccessIterator>
+                            void insertParallel(RandomAccessIterator begin, RandomAccessIterator end, SizeType threadCount = 0);
                             /**
                              * Insert elements in the given list
                              * @param list the list of value to insert
                              */
                             void insert(std::initializer_list<ValueType> list);
+                            /**
+                             * Insert the element held by a node if its key is not already in the table, reusing the node stored hash when possible
+                             * @param  node the node to insert, left empty if the insertion has been done and untouched otherwise
+                             * @return      a pair containing an iterator on the element with the node key, and a boolean telling if the insertion has been done
+                             */
+                            Pair<Iterator, bool> insert(NodeType && node);
                             /**
                              * Insert the given value in the table using the hint as a suggestion for the search start
                              * @param  hint  the hint used for the search
@@ -747,6 +1069,54 @@
                              */
                             template <class ... Args>
                             Iterator emplaceHint(ConstIterator hint, Args && ... args);
+                            /**
+                             * Emplace an element using the given elements and the precomputed hash of its key
+                             * @param hashValue the hash of the inserted key, computed with the table hash function
+                             * @param args      the parameter pack used to create the inserted pair
+                             * @return          a pair containing an iterator on the inserted element, and a boolean telling if the insertion has been done
+                             */
+                            template <class ... Args>
+                            Pair<Iterator, bool> emplaceHashed(SizeType hashValue, Args && ... args);
+                            /**
+                             * Emplace an element if the key is not in the table, the mapped value is only constructed after a miss
+                             * @param k    the element key, left untouched if already in the table
+                             * @param args the parameter pack used to create the mapped value
+                             * @return     a pair containing an iterator on the inserted or found element, and a boolean telling if the insertion has been done
+                             */
+                            template <class ... Args>
+                            Pair<Iterator, bool> tryEmplace(KeyType const& k, Args && ... args);
+                            /**
+                             * Emplace an element if the key is not in the table, the mapped value is only constructed after a miss
+                             * @param k    the element key, left untouched if already in the table
+                             * @param args the parameter pack used to create the mapped value
+                             * @return     a pair containing an iterator on the inserted or found element, and a boolean telling if the insertion has been done
+                             */
+                            template <class ... Args>
+                            Pair<Iterator, bool> tryEmplace(KeyType && k, Args && ... args);
+                            /**
+                             * Emplace an element if the key is not in the table, using its precomputed hash, the mapped value is only constructed after a miss
+                             * @param k    the element key with its hash, the key being left untouched if already in the table
+                             * @param args the parameter pack used to create the mapped value
+                             * @return     a pair containing an iterator on the inserted or found element, and a boolean telling if the insertion has been done
+                             */
+                            template <class ... Args>
+                            Pair<Iterator, bool> tryEmplace(HashedKey<KeyType> const& k, Args && ... args);
+                            /**
+                             * Insert the value with the given key, or assign it to the existing element
+                             * @param k     the element key
+                             * @param value the value to insert or assign
+                             * @return      a pair containing an iterator on the element, and a boolean telling if the insertion has been done
+                             */
+                            template <class M>
+                            Pair<Iterator, bool> insertOrAssign(KeyType const& k, M && value);
+                            /**
+                             * Insert the value with the given key, or assign it to the existing element
+                             * @param k     the element key
+                             * @param value the value to insert or assign
+                             * @return      a pair containing an iterator on the element, and a boolean telling if the insertion has been done
+                             */
+                            template <class M>
+                            Pair<Iterator, bool> insertOrAssign(KeyType && k, M && value);
                             /**
                              * Clear all buckets
                              */
@@ -756,6 +1126,12 @@
                              * @param table the other hash table
                              */
                             void swap(HashTable& table);
+                            /**
+                             * Move every element of the given table whose key isn't in this table, without hashing keys again when the hash is stored
+                             * Elements with a key already in this table stay in the given one
+                             * @param table the table to take elements from
+                             */
+                            void merge(HashTable& table);
                             /**
                              * Reserve at least count bucket in the table and rehash the table
                              * @param count the number of desired bucket
@@ -766,6 +1142,45 @@
                              * @param count the number of desired bucket
                              */
                             void rehash(SizeType count);
+                            /**
+                             * Move every remaining previous bucket, ending the incremental rehash in progress if any
+                             */
+                            void finishRehash();
+                            /**
+                             * Shrink the bucket count to the smallest one holding the elements under the max load factor
+                             */
+                            void shrinkToFit();
+                            /**
+                             * Move back every displaced element to the closest free bucket after its home, ending the incremental rehash in progress if any
+                             * Robin hood runs are kept packed by erase, this repairs runs broken by a range erase reaching the last bucket
+                             */
+                            void compact();
+                            /**
+                             * Reset the event counters
+                             */
+                            void resetStatistics();
+                            /**
+                             * Write a binary snapshot of the table, a header followed by the raw bucket array, an incremental rehash in progress being finished on a copy
+                             * @param fd the destination file descriptor
+                             * @throw std::system_error if the write fails
+                             */
+                            void save(int fd) const requires Concept::MemCopyable<ValueType>;
+                            /**
+                             * Replace the table content with a snapshot, read in a single bulk read into the bucket array
+                             * The saved layout is adopted as is, elements are only reinserted if the hash seed or the bucket placement version differs
+                             * @param fd the source file descriptor, positioned on the snapshot header
+                             * @throw std::system_error  if the read fails
+                             * @throw std::runtime_error if the snapshot is truncated, corrupted or written for another bucket entry type
+                             */
+                            void load(int fd) requires Concept::MemCopyable<ValueType>;
+                            /**
+                             * Replace the table content with a snapshot file, mapped in memory and copied in a single memcpy into the bucket array
+                             * The saved layout is adopted as is, elements are only reinserted if the hash seed or the bucket placement version differs
+                             * @param path the snapshot file path
+                             * @throw std::system_error  if the file can't be opened or mapped
+                             * @throw std::runtime_error if the snapshot is truncated, corrupted or written for another bucket entry type
+                             */
+                            void mapFrom(const char* path) requires Concept::MemCopyable<ValueType>;
                             /**
                              * Find a range of iterator containing all elements with the given key, both end if not found
                              * @param key the key to search
@@ -778,6 +1193,20 @@
                              * @return    a pair of iterator
                              */
                             Pair<ConstIterator, ConstIterator> equalRange(KeyType const& key) const;
+                            /**
+                             * Find a range of iterator containing all elements with the given key, with any key comparable to KeyType when the hash and equal functions are transparent
+                             * @param key the key to search
+                             * @return    a pair of iterator
+                             */
+                            template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                            Pair<Iterator, Iterator> equalRange(K const& key);
+                            /**
+                             * Find a range of iterator containing all elements with the given key, with any key comparable to KeyType when the hash and equal functions are transparent
+                             * @param key the key to search
+                             * @return    a pair of iterator
+                             */
+                            template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                            Pair<ConstIterator, ConstIterator> equalRange(K const& key) const;
                             /**
                              * Find the element corresponding with the given key
                              * @param  k the key to search
@@ -790,6 +1219,46 @@
                              * @return   the iterator pointing on the element, or end if not found
                              */
                             ConstIterator find(KeyType const& k) const;
+                            /**
+                             * Find the element corresponding with the given key, using its precomputed hash
+                             * @param  k         the key to search
+                             * @param  hashValue the key hash, computed with the table hash function
+                             * @return           the iterator pointing on the element, or end if not found
+                             */
+                            Iterator find(KeyType const& k, SizeType hashValue);
+                            /**
+                             * Find the element corresponding with the given key, using its precomputed hash
+                             * @param  k         the key to search
+                             * @param  hashValue the key hash, computed with the table hash function
+                             * @return           the iterator pointing on the element, or end if not found
+                             */
+                            ConstIterator find(KeyType const& k, SizeType hashValue) const;
+                            /**
+                             * Find the element corresponding with the given key, using its precomputed hash
+                             * @param  k the key to search with its hash
+                             * @return   the iterator pointing on the element, or end if not found
+                             */
+                            Iterator find(HashedKey<KeyType> const& k);
+                            /**
+                             * Find the element corresponding with the given key, using its precomputed hash
+                             * @param  k the key to search with its hash
+                             * @return   the iterator pointing on the element, or end if not found
+                             */
+                            ConstIterator find(HashedKey<KeyType> const& k) const;
+                            /**
+                             * Find the element corresponding with the given key, with any key comparable to KeyType when the hash and equal functions are transparent
+                             * @param  k the key to search
+                             * @return   the iterator pointing on the element, or end if not found
+                             */
+                            template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                            Iterator find(K const& k);
+                            /**
+                             * Find the element corresponding with the given key, with any key comparable to KeyType when the hash and equal functions are transparent
+                             * @param  k the key to search
+                             * @return   the iterator pointing on the element, or end if not found
+                             */
+                            template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                            ConstIterator find(K const& k) const;
                             /**
                              * Erase the element pointed by the iterator
                              * @param  pos the iterator on the erased element
@@ -810,11 +1279,65 @@
                              */
                             Iterator erase(ConstIterator begin, ConstIterator end);
                             /**
-                             * Erase all element with the given key
+                             * Remove the element pointed by the iterator and return it in a node, with its stored hash
+                             * @param  pos the iterator on the extracted element
+                             * @return     the node holding the element
+                             */
+                            NodeType extract(Iterator pos);
+                            /**
+                             * Remove the element pointed by the iterator and return it in a node, with its stored hash
+                             * @param  pos the iterator on the extracted element
+                             * @return     the node holding the element
+                             */
+                            NodeType extract(ConstIterator pos);
+                            /**
+                             * Remove the element with the given key and return it in a node, with its stored hash
+                             * @param  k the key of the extracted element
+                             * @return   the node holding the element, empty if the key isn't in the table
+                             */
+                            NodeType extract(KeyType const& k);
+                            /**
+                             * Erase all element with the given key, the table may shrink if a minimum load factor is set
                              * @param  k the key to search and erase
                              * @return   the number of erased elements
                              */
                             SizeType erase(KeyType const& k);
+                            /**
+                             * Erase all element with the given key, using its precomputed hash, the table may shrink if a minimum load factor is set
+                             * @param  k         the key to search and erase
+                             * @param  hashValue the key hash, computed with the table hash function
+                             * @return           the number of erased elements
+                             */
+                            SizeType erase(KeyType const& k, SizeType hashValue);
+                            /**
+                             * Erase all element with the given key, using its precomputed hash
+                             * @param  k the key to search and erase with its hash
+                             * @return   the number of erased elements
+                             */
+                            SizeType erase(HashedKey<KeyType> const& k);
+                            /**
+                             * Erase all element with the given key, with any key comparable to KeyType when the hash and equal functions are transparent
+                             * @param  k the key to search and erase
+                             * @return   the number of erased elements
+                             */
+                            template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                            SizeType erase(K const& k);
+                            /**
+                             * Find the elements corresponding with a range of keys, hashing and prefetching a whole batch before probing it to overlap the cache misses
+                             * @param keysBegin the begin iterator on the keys, must be a forward iterator
+                             * @param keysEnd   the end iterator on the keys
+                             * @param out       the output iterator receiving, for each key in order, an iterator on the element or end if not found
+                             */
+                            template <class ForwardIterator, class OutputIterator> requires Concept::ForwardIterator<ForwardIterator>
+                            void findBatch(ForwardIterator keysBegin, ForwardIterator keysEnd, OutputIterator out);
+                            /**
+                             * Find the elements corresponding with a range of keys, hashing and prefetching a whole batch before probing it to overlap the cache misses
+                             * @param keysBegin the begin iterator on the keys, must be a forward iterator
+                             * @param keysEnd   the end iterator on the keys
+                             * @param out       the output iterator receiving, for each key in order, an iterator on the element or end if not found
+                             */
+                            template <class ForwardIterator, class OutputIterator> requires Concept::ForwardIterator<ForwardIterator>
+                            void findBatch(ForwardIterator keysBegin, ForwardIterator keysEnd, OutputIterator out) const;
                             /**
                              * @return the hash function
                              */
@@ -858,6 +1381,21 @@
                              * @return the converted object
                              */
                             [[nodiscard]] String toString() const;
+                            /**
+                             * Append the object string representation at the end of out, reserving its exact size first
+                             * @param out the string to append into
+                             */
+                            void toString(String& out) const;
+                            /**
+                             * @return the object string representation size, used to format nested objects in one allocation
+                             */
+                            std::size_t estimateStringSize() const;
+                            /**
+                             * Format the object straight into the given sink
+                             * @param sink the sink to write into
+                             */
+                            template <class S>
+                            void writeTo(S& sink) const;
         
                     private :   // Methods
                         /**
@@ -865,14 +1403,79 @@
                          * @param  k the key to hash
                          * @return   the corresponding hash value
                          */
-                        SizeType hashKey(KeyType const& k) const;
+                        template <class K>
+                        SizeType hashKey(K const& k) const;
                         /**
                          * Compare two key and return if they are equals
                          * @param  k1 the first key
                          * @param  k2 the second key
                          * @return    if both key are equals
                          */
-                        bool compareKey(KeyType const& k1, KeyType const& k2) const;
+                        template <class K>
+                        bool compareKey(KeyType const& k1, K const& k2) const;
+                        /**
+                         * Find the element corresponding with the given key and its hash
+                         * @param  k         the key to search
+                         * @param  hashValue the key finalized hash
+                         * @return           the iterator pointing on the element, or end if not found
+                         */
+                        template <class K>
+                        ConstIterator findHashed(K const& k, SizeType hashValue) const;
+                        /**
+                         * Probe the given buckets for the given key
+                         * @param  buckets    the probed buckets
+                         * @param  bucketMask the buckets mask
+                         * @param  k          the key to search
+                         * @param  hashValue  the key finalized hash
+                         * @return            the bucket index, or the bucket count if not found
+                         */
+                        template <class K>
+                        SizeType probe(Detail::Vector<ContainerType, AllocatorType> const& buckets, SizeType bucketMask, K const& k, SizeType hashValue) const;
+                        /**
+                         * Clear a bucket and shift back the following displaced elements
+                         * @param buckets    the buckets holding the removed element
+                         * @param bucketMask the buckets mask
+                         * @param index      the removed bucket index
+                         */
+                        void removeAt(Detail::Vector<ContainerType, AllocatorType>& buckets, SizeType bucketMask, SizeType index);
+                        /**
+                         * Create an iterator on a current bucket, skipping empty buckets with the occupancy bitmap
+                         * @param  index the bucket index
+                         * @return       the corresponding iterator
+                         */
+                        Iterator iteratorAt(SizeType index);
+                        /**
+                         * Create an iterator on a current bucket, skipping empty buckets with the occupancy bitmap
+                         * @param  index the bucket index
+                         * @return       the corresponding iterator
+                         */
+                        ConstIterator iteratorAt(SizeType index) const;
+                        /**
+                         * Find the first occupied current bucket starting from the given one
+                         * @param  index the first bucket to test
+                         * @return       the occupied bucket index, or the bucket count if none
+                         */
+                        SizeType nextOccupied(SizeType index) const;
+                        /**
+                         * Size the occupancy bitmap for the current buckets and mark them all empty
+                         */
+                        void resetOccupancy();
+                        /**
+                         * Mark a current bucket as occupied
+                         * @param index the bucket index
+                         */
+                        void setOccupied(SizeType index);
+                        /**
+                         * Mark a current bucket as empty
+                         * @param index the bucket index
+                         */
+                        void setVacant(SizeType index);
+                        /**
+                         * Update the occupancy bitmap from the current buckets in the given range
+                         * @param from the first bucket index
+                         * @param to   the bucket index after the last one
+                         */
+                        void refreshOccupancy(SizeType from, SizeType to);
                         /**
                          * Compute the next index using the probing function
                          * @param  index the index to advance
@@ -891,6 +1494,44 @@
                          * @return       the rounded value
                          */
                         SizeType roundUpToPowerOfTwo(SizeType count) const;
+                        /**
+                         * Insert a built value with its key hash if the key is not already in the table
+                         * @param hashValue the inserted key hash, before finalization
+                         * @param toInsert  the value to insert, moved only if inserted
+                         * @return          a pair containing an iterator on the inserted element, and a boolean telling if the insertion has been done
+                         */
+                        Pair<Iterator, bool> insertHashed(SizeType hashValue, ValueType& toInsert);
+                        /**
+                         * Insert a built value with its finalized key hash if the key is not already in the table
+                         * @param hashValue the inserted key hash, after finalization
+                         * @param toInsert  the value to insert, moved only if inserted
+                         * @return          a pair containing an iterator on the inserted element, and a boolean telling if the insertion has been done
+                         */
+                        Pair<Iterator, bool> insertMixed(SizeType hashValue, ValueType& toInsert);
+                        /**
+                         * Tell if a truncated hash stored by a table of this type with the given seed can place an element in this table, even after its next growth
+                         * @param  hashSeed the hash function seed of the table which stored the hash
+                         * @return          the test result
+                         */
+                        bool canReuseStoredHash(std::uint64_t hashSeed) const;
+                        /**
+                         * Emplace an element with its key hash if the key is not already in the table, building the pair only on a miss
+                         * @param hashValue the key hash, before finalization
+                         * @param k         the element key
+                         * @param args      the parameter pack used to create the mapped value
+                         * @return          a pair containing an iterator on the inserted or found element, and a boolean telling if the insertion has been done
+                         */
+                        template <class K, class ... Args>
+                        Pair<Iterator, bool> tryEmplaceHashed(SizeType hashValue, K && k, Args && ... args);
+                        /**
+                         * Insert a value known to be missing, at the end of its probe sequence
+                         * @param hashValue      the inserted key finalized hash
+                         * @param index          the bucket index ending the probe sequence
+                         * @param distanceToNext the distance from the ideal bucket
+                         * @param toInsert       the value to insert
+                         * @return               a pair containing an iterator on the inserted element, and true
+                         */
+                        Pair<Iterator, bool> insertMissing(SizeType hashValue, SizeType index, DistanceType distanceToNext, ValueType& toInsert);
                         /**
                          * Insert a value in a full bucket
                          * @param index          the bucket index
@@ -912,6 +1553,73 @@
                          * @return if the table has been rehashed
                          */
                         bool rehashOnExtremeLoad();
+                        /**
+                         * Shrink the table if its load fell under the minimum load factor, leaving it half loaded
+                         */
+                        void shrinkOnLowLoad();
+                        /**
+                         * Start an incremental rehash, the current buckets become the previous ones
+                         * @param count the new bucket count, a power of two
+                         */
+                        void startRehash(SizeType count);
+                        /**
+                         * Move previous buckets in the current ones, ending the incremental rehash once all are moved
+                         * @param count the maximum number of previous buckets to move
+                         */
+                        void migrate(SizeType count);
+                        /**
+                         * Move the previous buckets due at an insert or erase, at least the rehash step and enough for the migration to end
+                         * before the table reaches its load threshold again
+                         */
+                        void migrateStep();
+                        /**
+                         * Place the elements of a partition in their slice of the bucket array, called concurrently for different slices
+                         * @param begin    the range begin iterator
+                         * @param order    the range indices, grouped by partition
+                         * @param hashes   the range key hashes
+                         * @param sources  the range index of each bucket element, written for the slice buckets
+                         * @param first    the partition first index in order
+                         * @param last     the partition end index in order
+                         * @param sliceEnd the slice end bucket
+                         * @param overflow receive the range index of the elements spilling out of the slice
+                         * @return         the number of placed elements
+                         */
+                        template <class RandomAccessIterator, class IndexVector>
+                        SizeType placeSlice(RandomAccessIterator begin, IndexVector const& order, IndexVector const& hashes, IndexVector& sources, SizeType first, SizeType last, SizeType sliceEnd, IndexVector& overflow);
+                        /**
+                         * Call task with each thread index, the first one running on the calling thread
+                         * @param threadCount the number of threads
+                         * @param task        the task, called with the thread index
+                         */
+                        template <class F>
+                        static void runOnThreads(SizeType threadCount, F && task);
+                        /**
+                         * Move every element in a new bucket array
+                         * @param count           the minimum bucket count of the new array
+                         * @param trustStoredHash tell if the stored truncated hashes are still valid, false to hash every key again
+                         */
+                        void reinsert(SizeType count, bool trustStoredHash);
+                        /**
+                         * @return the hash function seed, 0 if the hash function isn't seeded
+                         */
+                        std::uint64_t getHashSeed() const;
+                        /**
+                         * @return the snapshot header describing the table
+                         */
+                        HashTableInner::SnapshotHeader makeSnapshotHeader() const;
+                        /**
+                         * Check that a snapshot header was written for this table bucket entry type
+                         * @param header the header to check
+                         * @throw std::runtime_error if the header doesn't match
+                         */
+                        void checkSnapshotHeader(HashTableInner::SnapshotHeader const& header) const;
+                        /**
+                         * Validate loaded buckets then adopt them, reinserting the elements if their layout can't be trusted
+                         * @param header  the snapshot header
+                         * @param buckets the loaded buckets
+                         * @throw std::runtime_error if the buckets don't hold the announced number of elements
+                         */
+                        void adoptSnapshot(HashTableInner::SnapshotHeader const& header, Detail::Vector<ContainerType, AllocatorType>&& buckets);
                         /**
                          * @return the next valid size for the table
                          */
@@ -922,6 +1630,12 @@
                         static constexpr float DEFAULT_MAX_LOAD_FACTOR  = 0.9f;         /**< The default max load factor before growing */
                         static constexpr float REHASH_MIN_LOAD_FACTOR   = 0.15f;        /**< The minimum load factor for rehash */
                         static const DistanceType REHASH_HIGH_PROBE     = 128;          /**< The maximum distance between 2 bucket before rehash */
+                        static const SizeType FIND_BATCH_SIZE           = 16;           /**< The number of keys hashed and prefetched ahead in a batched lookup */
+                        static const SizeType SNAPSHOT_CHECKED_COUNT    = 16;           /**< The number of loaded elements whose home bucket is checked before adopting a snapshot layout */
+                        static const SizeType PARALLEL_MIN_SIZE         = 1 << 15;      /**< The minimum range size built from several threads */
+                        static const SizeType PARALLEL_SLICES_PER_THREAD = 4;           /**< The number of bucket slices per thread in a parallel build, balancing uneven slices */
+                        static constexpr bool SEED_DEFINES_HASH         = std::is_empty_v<Hash> || requires (Hash const& hasher) { hasher.getSeed(); };  /**< Tell if two hash functions with the same seed hash alike */
+                        static constexpr char NODE_ORIGIN               = 0;            /**< Its address identifies the table type in extracted nodes */
             
                         /**
                          * Tell if we use the stored hash on rehash
@@ -11,24 +11,33 @@
          namespace Core {
              namespace Detail {
                 namespace HashTableInner {
+
+                     inline std::size_t findNextOccupied(OccupancyWord const* occupancy, std::size_t index) {
+                         std::size_t word = index / OCCUPANCY_WORD_BITS;
+                         OccupancyWord bits = occupancy[word] & (~static_cast <OccupancyWord> (0) << (index % OCCUPANCY_WORD_BITS));
+                         while (bits == 0) {
+                             bits = occupancy[++word];
+                         }
+                         return word * OCCUPANCY_WORD_BITS + static_cast <std::size_t> (std::countr_zero(bits));
+                     }
     
                      template <class ValueType, bool StoreHash>
-                     inline BucketEntry<ValueType, StoreHash>::BucketEntry() : BucketEntryHash<StoreHash>(), distanceToNext(EMPTY_BUCKET_DISTANCE), last(false) {
+                     inline BucketEntry<ValueType, StoreHash>::BucketEntry() : BucketEntryHash<StoreHash>(), metadata(0) {
                      }
         
                      template <class ValueType, bool StoreHash>
-                     inline BucketEntry<ValueType, StoreHash>::BucketEntry(BucketEntry const& bucket) : BucketEntryHash<StoreHash>(bucket), distanceToNext(EMPTY_BUCKET_DISTANCE), last(bucket.last) {
+                     inline BucketEntry<ValueType, StoreHash>::BucketEntry(BucketEntry const& bucket) : BucketEntryHash<StoreHash>(bucket), metadata(static_cast <MetadataType> (bucket.metadata & LAST_BUCKET_FLAG)) {
                          if (!bucket.isEmpty()) {
                              ::new(&data) ValueType(bucket.getData());
-                             distanceToNext = bucket.distanceToNext;
+                             metadata = bucket.metadata;
                          }
                      }
         
                      template <class ValueType, bool StoreHash>
-                     inline BucketEntry<ValueType, StoreHash>::BucketEntry(BucketEntry&& bucket) : BucketEntryHash<StoreHash>(bucket), distanceToNext(EMPTY_BUCKET_DISTANCE), last(bucket.last) {
+                     inline BucketEntry<ValueType, StoreHash>::BucketEntry(BucketEntry&& bucket) : BucketEntryHash<StoreHash>(bucket), metadata(static_cast <MetadataType> (bucket.metadata & LAST_BUCKET_FLAG)) {
                          if (!bucket.isEmpty()) {
                              ::new(&data) ValueType(std::move(bucket.getData()));
-                             distanceToNext = bucket.distanceToNext;
+                             metadata = bucket.metadata;
                          }
                      }
         
@@ -39,17 +48,17 @@
         
                      template <class ValueType, bool StoreHash>
                      inline bool BucketEntry<ValueType, StoreHash>::isEmpty() const {
-                         return distanceToNext == EMPTY_BUCKET_DISTANCE;
+                         return (metadata & DISTANCE_MASK) == 0;
                      }
         
                      template <class ValueType, bool StoreHash>
                      inline bool BucketEntry<ValueType, StoreHash>::isLastBucket() const {
-                         return last;
+                         return (metadata & LAST_BUCKET_FLAG) != 0;
                      }
         
                      template <class ValueType, bool StoreHash>
                      inline typename BucketEntry<ValueType, StoreHash>::DistanceType BucketEntry<ValueType, StoreHash>::getDistanceToNext() const {
-                         return distanceToNext;
+                         return static_cast <DistanceType> ((metadata & DISTANCE_MASK) - 1);
                      }
         
                      template <class ValueType, bool StoreHash>
@@ -64,28 +73,35 @@
         
                      template <class ValueType, bool StoreHash>
                      inline void BucketEntry<ValueType, StoreHash>::setAsLastBucket() {
-                         last = true;
+                         metadata = static_cast <MetadataType> (metadata | LAST_BUCKET_FLAG);
                      }
         
                      template <class ValueType, bool StoreHash>
                      inline void BucketEntry<ValueType, StoreHash>::setData(DistanceType distance, TruncatedHash h,ValueType&& newData) {
                          ::new(&data) ValueType(std::move(newData));
                          this->setHash(h);
-                         distanceToNext = distance;
+                         setDistanceToNext(distance);
+                     }
+
+                     template <class ValueType, bool StoreHash>
+                     inline void BucketEntry<ValueType, StoreHash>::setDistanceToNext(DistanceType distance) {
+                         metadata = static_cast <MetadataType> ((metadata & LAST_BUCKET_FLAG) | (static_cast <MetadataType> (distance + 1) & DISTANCE_MASK));
                      }
         
                      template <class ValueType, bool StoreHash>
                      inline void BucketEntry<ValueType, StoreHash>::clear() {
                          if (!isEmpty()) {
                              getData().~ValueType();
-                             distanceToNext = EMPTY_BUCKET_DISTANCE;
+                             setDistanceToNext(EMPTY_BUCKET_DISTANCE);
                          }
                      }
         
                      template <class ValueType, bool StoreHash>
                      inline void BucketEntry<ValueType, StoreHash>::swapWithData(DistanceType& distance, TruncatedHash& h, ValueType& newData) {
                          using std::swap;
-                         swap(distanceToNext, distance);
+                         DistanceType tmpDistance = getDistanceToNext();
+                         setDistanceToNext(distance);
+                         distance = tmpDistance;
                          swap(getData(), newData);
             
                          (void) h;
@@ -106,8 +122,7 @@
                                  ::new(&data) ValueType(bucket.getData());
                              }
                 
-                             distanceToNext = bucket.distanceToNext;
-                             last = bucket.last;
+                             metadata = bucket.metadata;
                          }
                          return *this;
                      }
@@ -122,24 +137,33 @@
                                  ::new(&data) ValueType(std::move(bucket.getData()));
                              }
                 
-                             distanceToNext = bucket.distanceToNext;
-                             last = bucket.last;
+                             metadata = bucket.metadata;
                          }
                          return *this;
                      }
         
                      template <class T, class Category, class Bucket>
-                     inline ForwardIterator<T, Category, Bucket>::ForwardIterator(Bucket* bucket) : current(bucket) {
+                     inline ForwardIterator<T, Category, Bucket>::ForwardIterator(Bucket* bucket, Bucket* next, OccupancyWord const* occupied, Bucket* base) : current(bucket), following(next), occupancy(occupied), first(base) {
                      }
         
                      template <class T, class Category, class Bucket>
-                     inline ForwardIterator<T, Category, Bucket>::ForwardIterator(const Bucket* bucket) : current(const_cast <Bucket*> (bucket)) {
+                     inline ForwardIterator<T, Category, Bucket>::ForwardIterator(const Bucket* bucket, const Bucket* next, OccupancyWord const* occupied, const Bucket* base) : current(const_cast <Bucket*> (bucket)), following(const_cast <Bucket*> (next)), occupancy(occupied), first(const_cast <Bucket*> (base)) {
+                     }
+
+                     template <class T, class Category, class Bucket>
+                     template <class OtherCategory>
+                     inline ForwardIterator<T, Category, Bucket>::ForwardIterator(ForwardIterator<T, OtherCategory, Bucket> const& it) : current(it.current), following(it.following), occupancy(it.occupancy), first(it.first) {
                      }
     
                      template <class T, class Category, class Bucket>
                      inline Bucket* ForwardIterator<T, Category, Bucket>::getCurrent() {
                          return current;
                      }
+
+                     template <class T, class Category, class Bucket>
+                     inline Bucket* ForwardIterator<T, Category, Bucket>::getFollowing() const {
+                         return following;
+                     }
         
                      template <class T, class Category, class Bucket>
                      inline typename ForwardIterator<T, Category, Bucket>::Reference ForwardIterator<T, Category, Bucket>::dereference() const {
@@ -148,8 +172,20 @@
         
                      template <class T, class Category, class Bucket>
                      inline void ForwardIterator<T, Category, Bucket>::increment() {
+                         if (occupancy != nullptr) {
+                             current = first + findNextOccupied(occupancy, static_cast <std::size_t> (current - first) + 1);
+                             return;
+                         }
                          while (true) {
                              if (current->isLastBucket()) {
+                                 if (following != nullptr) {
+                                     current = following;
+                                     following = nullptr;
+                                     if (!current->isEmpty()) {
+                                         break;
+                                     }
+                                     continue;
+                                 }
                                  ++current;
                                  break;
                              }
@@ -163,7 +199,7 @@
         
                      template <class T, class Category, class Bucket>
                      inline bool ForwardIterator<T, Category, Bucket>::equal(ForwardIterator const& it) const {
-                         return current == it.current;
+                         return current == it.current && following == it.following;
                      }
         
                      template <class T, class Category, class Bucket>
@@ -188,49 +224,133 @@
                      inline bool LocalForwardIterator<T, Category, Bucket>::equal(LocalForwardIterator const& it) const {
                          return current == it.current;
                      }
+
+
+                     template <class Key, class T>
+                     inline NodeHandle<Key, T>::NodeHandle() : full(false), hashed(false), hash(0), seed(0), origin(nullptr) {
+                     }
+
+                     template <class Key, class T>
+                     inline NodeHandle<Key, T>::NodeHandle(ValueType& value, bool isHashed, TruncatedHash h, std::uint64_t hashSeed, void const* source) : full(false), hashed(isHashed), hash(h), seed(hashSeed), origin(source) {
+                         construct(value);
+                     }
+
+                     template <class Key, class T>
+                     inline NodeHandle<Key, T>::NodeHandle(NodeHandle && node) : full(false), hashed(node.hashed), hash(node.hash), seed(node.seed), origin(node.origin) {
+                         if (!node.isEmpty()) {
+                             construct(node.getData());
+                             node.reset();
+                         }
+                     }
+
+                     template <class Key, class T>
+                     inline NodeHandle<Key, T>::~NodeHandle() {
+                         reset();
+                     }
+
+                     template <class Key, class T>
+                     inline bool NodeHandle<Key, T>::isEmpty() const {
+                         return !full;
+                     }
+
+                     template <class Key, class T>
+                     inline typename NodeHandle<Key, T>::KeyType const& NodeHandle<Key, T>::getKey() const {
+                         return KeyExtractor<Key, T>::extract(getValue());
+                     }
+
+                     template <class Key, class T>
+                     inline typename NodeHandle<Key, T>::ValueType const& NodeHandle<Key, T>::getValue() const {
+                         return *std::launder(reinterpret_cast <ValueType const*> (&data));
+                     }
+
+                     template <class Key, class T>
+                     inline typename NodeHandle<Key, T>::MappedType& NodeHandle<Key, T>::getMapped() requires (!std::is_void_v<T>) {
+                         return getData().second;
+                     }
+
+                     template <class Key, class T>
+                     inline NodeHandle<Key, T>& NodeHandle<Key, T>::operator =(NodeHandle && node) {
+                         if (this != &node) {
+                             reset();
+                             hashed = node.hashed;
+                             hash = node.hash;
+                             seed = node.seed;
+                             origin = node.origin;
+                             if (!node.isEmpty()) {
+                                 construct(node.getData());
+                                 node.reset();
+                             }
+                         }
+                         return *this;
+                     }
+
+                     template <class Key, class T>
+                     inline typename NodeHandle<Key, T>::ValueType& NodeHandle<Key, T>::getData() {
+                         return *std::launder(reinterpret_cast <ValueType*> (&data));
+                     }
+
+                     template <class Key, class T>
+                     inline void NodeHandle<Key, T>::construct(ValueType& value) {
+                         if constexpr (std::is_trivially_copyable_v<ValueType>) {
+                             std::memcpy(static_cast <void*> (&data), static_cast <void const*> (&value), sizeof(ValueType));
+                         } else {
+                             ::new(&data) ValueType(std::move(value));
+                         }
+                         full = true;
+                     }
+
+                     template <class Key, class T>
+                     inline void NodeHandle<Key, T>::reset() {
+                         if (full) {
+                             getData().~ValueType();
+                             full = false;
+                         }
+                     }
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::HashTable(SizeType bucketCount, Hash const& hasher, KeyEqual const& equal, Allocator const& alloc) : Hash(hasher), KeyEqual(equal), data(alloc), nbElements(0), maxLoadFactor(DEFAULT_MAX_LOAD_FACTOR), growAtNextInsert(false) {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::HashTable(SizeType bucketCount, Hash const& hasher, KeyEqual const& equal, Allocator const& alloc) : Hash(hasher), KeyEqual(equal), data(alloc), nbElements(0), maxLoadFactor(DEFAULT_MAX_LOAD_FACTOR), minLoadFactor(0.0f), growAtNextInsert(false), oldData(alloc), oldMask(0), migrationStart(0), migrated(0), rehashStep(0), occupancy(alloc) {
                      data.resize(roundUpToPowerOfTwo(bucketCount));
                      data.getLast().setAsLastBucket();
                      mask = data.getSize() - 1;
                      setMaxLoadFactor(maxLoadFactor);
+                     resetOccupancy();
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
                  template <class InputIterator>
-                 inline HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::HashTable(InputIterator begin, InputIterator end, SizeType bucketCount, Hash const& hasher, KeyEqual const& equal, Allocator const& alloc) : HashTable(bucketCount, hasher, equal, alloc) {
+                 inline HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::HashTable(InputIterator begin, InputIterator end, SizeType bucketCount, Hash const& hasher, KeyEqual const& equal, Allocator const& alloc) : HashTable(bucketCount, hasher, equal, alloc) {
                      insert(begin, end);
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::HashTable(std::initializer_list<ValueType> list, SizeType bucketCount, Hash const& hasher, KeyEqual const& equal, Allocator const& alloc) : HashTable(bucketCount, hasher, equal, alloc) {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::HashTable(std::initializer_list<ValueType> list, SizeType bucketCount, Hash const& hasher, KeyEqual const& equal, Allocator const& alloc) : HashTable(bucketCount, hasher, equal, alloc) {
                      insert(list);
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::HashTable(HashTable const& table) : HashTable(table, table.getAllocator()) {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::HashTable(HashTable const& table) : HashTable(table, table.getAllocator()) {
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::HashTable(HashTable const& table, Allocator const& alloc) : Hash(table), KeyEqual(table), data(table.data, alloc), nbElements(table.nbElements), mask(table.mask), loadThresHold(table.loadThresHold), maxLoadFactor(table.maxLoadFactor), growAtNextInsert(table.growAtNextInsert) {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::HashTable(HashTable const& table, Allocator const& alloc) : Hash(table), KeyEqual(table), data(table.data, alloc), nbElements(table.nbElements), mask(table.mask), loadThresHold(table.loadThresHold), maxLoadFactor(table.maxLoadFactor), minLoadFactor(table.minLoadFactor), growAtNextInsert(table.growAtNextInsert), oldData(table.oldData, alloc), oldMask(table.oldMask), migrationStart(table.migrationStart), migrated(table.migrated), rehashStep(table.rehashStep), occupancy(table.occupancy, alloc), counters(table.counters) {
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::HashTable(HashTable && table) : HashTable(std::move(table), table.getAllocator()) {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::HashTable(HashTable && table) : HashTable(std::move(table), table.getAllocator()) {
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::HashTable(HashTable && table, Allocator const& alloc) : Hash(std::move(static_cast <Hash&> (table))), KeyEqual(std::move(static_cast <KeyEqual&> (table))), data(std::move(table.data), alloc), nbElements(table.nbElements), mask(table.mask), loadThresHold(table.loadThresHold), maxLoadFactor(table.maxLoadFactor), growAtNextInsert(table.growAtNextInsert) {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::HashTable(HashTable && table, Allocator const& alloc) : Hash(std::move(static_cast <Hash&> (table))), KeyEqual(std::move(static_cast <KeyEqual&> (table))), data(std::move(table.data), alloc), nbElements(table.nbElements), mask(table.mask), loadThresHold(table.loadThresHold), maxLoadFactor(table.maxLoadFactor), minLoadFactor(table.minLoadFactor), growAtNextInsert(table.growAtNextInsert), oldData(std::move(table.oldData), alloc), oldMask(table.oldMask), migrationStart(table.migrationStart), migrated(table.migrated), rehashStep(table.rehashStep), occupancy(std::move(table.occupancy), alloc), counters(table.counters) {
                      table.data.clear();
                      table.nbElements = 0;
                      table.loadThresHold = 0;
                      table.growAtNextInsert = false;
+                     table.migrated = 0;
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::MappedType& HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::get(KeyType const& k) {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::MappedType& HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::get(KeyType const& k) {
                      auto it = find(k);
                      if (it == end()) {
                          throw std::out_of_range("Accessing non existing element in NRE::Core::HashTable.");
@@ -238,8 +358,28 @@
                      return it->second;
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::MappedType const& HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::get(KeyType const& k) const {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::MappedType const& HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::get(KeyType const& k) const {
+                     auto it = find(k);
+                     if (it == end()) {
+                         throw std::out_of_range("Accessing non existing element in NRE::Core::HashTable.");
+                     }
+                     return it->second;
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::MappedType& HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::get(K const& k) {
+                     auto it = find(k);
+                     if (it == end()) {
+                         throw std::out_of_range("Accessing non existing element in NRE::Core::HashTable.");
+                     }
+                     return it->second;
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::MappedType const& HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::get(K const& k) const {
                      auto it = find(k);
                      if (it == end()) {
                          throw std::out_of_range("Accessing non existing element in NRE::Core::HashTable.");
@@ -247,48 +387,73 @@
                      return it->second;
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::SizeType HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::getBucketCount() const {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::getBucketCount() const {
                      return data.getSize();
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 constexpr typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::SizeType HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::getMaxBucketCount() const {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 constexpr typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::getMaxBucketCount() const {
                      return data.getMaxSize();
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::SizeType HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::getSize() const {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::getSize() const {
                      return nbElements;
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline float HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::getMaxLoadFactor() const {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline float HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::getMaxLoadFactor() const {
                      return maxLoadFactor;
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline float HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::getLoadFactor() const {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline float HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::getMinLoadFactor() const {
+                     return minLoadFactor;
+                 }
+    
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline float HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::getLoadFactor() const {
                      return static_cast <float> (getSize()) / static_cast <float> (getBucketCount());
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline Allocator HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::getAllocator() const {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline Allocator HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::getAllocator() const {
                      return Allocator(data.getAllocator());
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 constexpr typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::SizeType HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::getMaxSize() const {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 constexpr typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::getMaxSize() const {
                      return std::numeric_limits<SizeType>::max();
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline bool HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::isEmpty() const {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline bool HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::isEmpty() const {
                      return nbElements == 0;
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::SizeType HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::getCount(KeyType const& k) const {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::getCount(KeyType const& k) const {
+                     return getCount(k, hashKey(k));
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::getCount(KeyType const& k, SizeType hashValue) const {
+                     if (find(k, hashValue) != end()) {
+                         return 1;
+                     } else {
+                         return 0;
+                     }
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::getCount(HashedKey<KeyType> const& k) const {
+                     return getCount(k.getKey(), k.getHash());
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::getCount(K const& k) const {
                      if (find(k) != end()) {
                          return 1;
                      } else {
@@ -296,104 +461,168 @@
                      }
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::SizeType HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::getBucket(KeyType const& k) const {
-                     return bucketFromHash(hashKey(k));
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::getBucket(KeyType const& k) const {
+                     return bucketFromHash(Mix::mix(hashKey(k)));
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::getMemoryUsage() const {
+                     return sizeof(HashTable) + (data.getCapacity() + oldData.getCapacity()) * sizeof(ContainerType) + occupancy.getCapacity() * sizeof(OccupancyWord);
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Statistics HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::getStatistics() const {
+                     Statistics stats;
+                     stats.size = getSize();
+                     stats.bucketCount = getBucketCount();
+                     stats.loadFactor = getLoadFactor();
+        
+                     SizeType totalDistance = 0;
+                     for (auto const* buckets : {&data, &oldData}) {
+                         for (ContainerType const& bucket : *buckets) {
+                             if (!bucket.isEmpty()) {
+                                 SizeType distance = static_cast <SizeType> (bucket.getDistanceToNext());
+                                 stats.distanceHistogram[std::min(distance, Statistics::HISTOGRAM_SIZE - 1)]++;
+                                 stats.maxDistance = std::max(stats.maxDistance, distance);
+                                 totalDistance += distance;
+                             }
+                         }
+                     }
+                     if (!isEmpty()) {
+                         stats.averageDistance = static_cast <double> (totalDistance) / static_cast <double> (getSize());
+                     }
+        
+                     counters.fill(stats);
+                     return stats;
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline bool HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::isRehashing() const {
+                     return !oldData.isEmpty();
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::getRehashStep() const {
+                     return rehashStep;
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline void HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::setMaxLoadFactor(float factor) {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::setMaxLoadFactor(float factor) {
                      if (factor < 0.0f || factor > 1.0f) {
                          throw std::out_of_range("NRE::Core::HashTable max load factor must be between 0.0 and 1.0.");
                      }
                      maxLoadFactor = factor;
+                     minLoadFactor = std::min(minLoadFactor, maxLoadFactor / 4.0f);
                      loadThresHold = static_cast <SizeType> (static_cast <float> (getBucketCount()) * maxLoadFactor);
                  }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::setMinLoadFactor(float factor) {
+                     if (factor < 0.0f || factor > maxLoadFactor / 4.0f) {
+                         throw std::out_of_range("NRE::Core::HashTable min load factor must be between 0.0 and a quarter of the max load factor.");
+                     }
+                     minLoadFactor = factor;
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::setRehashStep(SizeType step) {
+                     if (step == 0) {
+                         finishRehash();
+                     }
+                     rehashStep = step;
+                 }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::Iterator HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::begin() {
-                     SizeType index = 0;
-                     while (index < getBucketCount() && data[index].isEmpty()) {
-                         ++index;
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::begin() {
+                     if (isRehashing()) {
+                         Iterator it(oldData.getData(), data.getData());
+                         if (oldData[0].isEmpty()) {
+                             ++it;
+                         }
+                         return it;
                      }
-        
-                     return Iterator(data.getData() + index);
+
+                     return iteratorAt(nextOccupied(0));
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::ConstIterator HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::begin() const {
-                     SizeType index = 0;
-                     while (index < getBucketCount() && data[index].isEmpty()) {
-                         ++index;
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConstIterator HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::begin() const {
+                     if (isRehashing()) {
+                         ConstIterator it(oldData.getData(), data.getData());
+                         if (oldData[0].isEmpty()) {
+                             ++it;
+                         }
+                         return it;
                      }
-        
-                     return ConstIterator(data.getData() + index);
+
+                     return iteratorAt(nextOccupied(0));
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::ConstIterator HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::cbegin() const {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConstIterator HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::cbegin() const {
                      return begin();
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::Iterator HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::end() {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::end() {
                      return Iterator(data.getData() + data.getSize());
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::ConstIterator HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::end() const {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConstIterator HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::end() const {
                      return ConstIterator(data.getData() + data.getSize());
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::ConstIterator HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::cend() const {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConstIterator HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::cend() const {
                      return end();
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::LocalIterator HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::begin(SizeType index) {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::LocalIterator HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::begin(SizeType index) {
                      return LocalIterator(&data[index]);
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::ConstLocalIterator HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::begin(SizeType index) const {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConstLocalIterator HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::begin(SizeType index) const {
                      return ConstLocalIterator(&data[index]);
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::ConstLocalIterator HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::cbegin(SizeType index) const {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConstLocalIterator HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::cbegin(SizeType index) const {
                      return begin();
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::LocalIterator HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::end(SizeType index) {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::LocalIterator HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::end(SizeType index) {
                      return LocalIterator(nullptr);
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::ConstLocalIterator HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::end(SizeType index) const {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConstLocalIterator HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::end(SizeType index) const {
                      return ConstLocalIterator(nullptr);
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::ConstLocalIterator HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::cend(SizeType index) const {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConstLocalIterator HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::cend(SizeType index) const {
                      return end();
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline Pair<typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::Iterator, bool> HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::insert(ValueType const& value) {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline Pair<typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator, bool> HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::insert(ValueType const& value) {
                      return emplace(value);
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
                  template <class P>
-                 inline Pair<typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::Iterator, bool> HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::insert(P&& value) {
+                 inline Pair<typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator, bool> HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::insert(P&& value) {
                      return emplace(std::forward<P>(value));
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
                  template <class InputIterator>
-                 inline void HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::insert(InputIterator begin, InputIterator end) {
+                 inline void HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::insert(InputIterator begin, InputIterator end) {
                      SizeType count = std::distance(begin, end);
                      SizeType free = loadThresHold - getSize();
                      if (count > 0 && free < count) {
@@ -404,42 +633,218 @@
                      }
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline void HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::insert(std::initializer_list<ValueType> list) {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class RandomAccessIterator> requires Concept::RandomAccessIterator<RandomAccessIterator>
+                 inline void HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::insertParallel(RandomAccessIterator begin, RandomAccessIterator end, SizeType threadCount) {
+                     SizeType count = static_cast <SizeType> (std::distance(begin, end));
+                     if (threadCount == 0) {
+                         threadCount = std::max(static_cast <SizeType> (std::thread::hardware_concurrency()), static_cast <SizeType> (1));
+                     }
+                     if constexpr (!std::is_same_v<std::remove_cvref_t<decltype(*begin)>, ValueType>) {
+                         insert(begin, end);
+                     } else {
+                         if (!isEmpty() || isRehashing() || threadCount == 1 || count < PARALLEL_MIN_SIZE) {
+                             insert(begin, end);
+                             return;
+                         }
+                         if (loadThresHold < count) {
+                             reserve(count);
+                         }
+
+                         // Slices hold a whole number of occupancy words, so threads never write the same bitmap word
+                         SizeType sliceCount = std::min(roundUpToPowerOfTwo(threadCount * PARALLEL_SLICES_PER_THREAD), std::max(getBucketCount() / HashTableInner::OCCUPANCY_WORD_BITS, static_cast <SizeType> (1)));
+                         SizeType sliceShift = static_cast <SizeType> (std::countr_zero(getBucketCount() / sliceCount));
+                         using IndexVector = Detail::Vector<SizeType, typename Allocator::template Rebind<SizeType>>;
+                         IndexVector hashes(count, static_cast <SizeType> (0)), order(count, static_cast <SizeType> (0)), sources(getBucketCount(), static_cast <SizeType> (0));
+                         IndexVector offsets(threadCount * sliceCount + 1, static_cast <SizeType> (0)), placed(sliceCount, static_cast <SizeType> (0));
+                         std::unique_ptr<IndexVector[]> overflows = std::make_unique<IndexVector[]>(sliceCount);
+
+                         // Hash each chunk and count its elements per slice, offsets being laid out slice by slice then chunk by chunk
+                         runOnThreads(threadCount, [&](SizeType t) {
+                             for (SizeType i = count * t / threadCount; i < count * (t + 1) / threadCount; ++i) {
+                                 hashes[i] = hashKey(Extractor::extract(*(begin + i)));
+                                 ++offsets[(bucketFromHash(Mix::mix(hashes[i])) >> sliceShift) * threadCount + t + 1];
+                             }
+                         });
+                         for (SizeType i = 1; i < offsets.getSize(); ++i) {
+                             offsets[i] += offsets[i - 1];
+                         }
+                         IndexVector partitions(offsets);
+                         runOnThreads(threadCount, [&](SizeType t) {
+                             for (SizeType i = count * t / threadCount; i < count * (t + 1) / threadCount; ++i) {
+                                 order[partitions[(bucketFromHash(Mix::mix(hashes[i])) >> sliceShift) * threadCount + t]++] = i;
+                             }
+                         });
+
+                         try {
+                             runOnThreads(threadCount, [&](SizeType t) {
+                                 for (SizeType slice = t; slice < sliceCount; slice += threadCount) {
+                                     placed[slice] = placeSlice(begin, order, hashes, sources, offsets[slice * threadCount], offsets[(slice + 1) * threadCount], (slice + 1) << sliceShift, overflows[slice]);
+                                 }
+                             });
+                             for (SizeType slice = 0; slice < sliceCount; ++slice) {
+                                 nbElements += placed[slice];
+                             }
+                             // Spilled elements are replayed in input order, so the first occurrence of a key still wins
+                             IndexVector spilled;
+                             for (SizeType slice = 0; slice < sliceCount; ++slice) {
+                                 for (SizeType source : overflows[slice]) {
+                                     spilled.emplaceBack(source);
+                                 }
+                             }
+                             std::sort(spilled.begin(), spilled.end());
+                             for (SizeType source : spilled) {
+                                 ValueType toInsert(*(begin + source));
+                                 insertHashed(hashes[source], toInsert);
+                             }
+                         } catch (...) {
+                             clear();
+                             throw;
+                         }
+                     }
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::insert(std::initializer_list<ValueType> list) {
                      insert(list.begin(), list.end());
                  }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline Pair<typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator, bool> HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::insert(NodeType && node) {
+                     if (node.isEmpty()) {
+                         return Pair<Iterator, bool>(end(), false);
+                     }
+                     SizeType hashValue = (node.hashed && node.origin == &NODE_ORIGIN && canReuseStoredHash(node.seed)) ? (static_cast <SizeType> (node.hash)) : (Mix::mix(hashKey(node.getKey())));
+                     Pair<Iterator, bool> res = insertMixed(hashValue, node.getData());
+                     if (res.second) {
+                         node.reset();
+                     }
+                     return res;
+                 }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::Iterator HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::insertHint(ConstIterator, ValueType const& value) {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::insertHint(ConstIterator, ValueType const& value) {
                      return insert(value).first;
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
                  template <class P>
-                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::Iterator HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::insertHint(ConstIterator, P&& value) {
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::insertHint(ConstIterator, P&& value) {
                      return insert(std::forward<P>(value)).first;
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
                  template <class ... Args>
-                 inline Pair<typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::Iterator, bool> HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::emplace(Args&& ... args) {
+                 inline Pair<typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator, bool> HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::emplace(Args&& ... args) {
                      ValueType toInsert(std::forward<Args>(args)...);
-                     KeyType const& key = toInsert.first;
-        
-                     SizeType hashValue = hashKey(key);
+                     return insertHashed(hashKey(Extractor::extract(toInsert)), toInsert);
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class ... Args>
+                 inline Pair<typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator, bool> HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::emplaceHashed(SizeType hashValue, Args&& ... args) {
+                     ValueType toInsert(std::forward<Args>(args)...);
+                     return insertHashed(hashValue, toInsert);
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline Pair<typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator, bool> HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::insertHashed(SizeType hashValue, ValueType& toInsert) {
+                     return insertMixed(Mix::mix(hashValue), toInsert);
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline Pair<typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator, bool> HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::insertMixed(SizeType hashValue, ValueType& toInsert) {
+                     KeyType const& key = Extractor::extract(toInsert);
+                     migrateStep();
+                     if (isRehashing()) {
+                         SizeType previous = probe(oldData, oldMask, key, hashValue);
+                         if (previous != oldData.getSize()) {
+                             return Pair<Iterator, bool>(Iterator(oldData.getData() + previous, data.getData()), false);
+                         }
+                     }
                      SizeType index = bucketFromHash(hashValue);
                      DistanceType distanceToNext = 0;
         
                      while (distanceToNext <= data[index].getDistanceToNext()) {
                          if ((!USE_STORED_HASH_ON_LOOKUP || data[index].bucketHashEquals(hashValue)) &&
-                             compareKey(data[index].getData().first, key)) {
-                             return Pair<Iterator, bool>(data.getData() + index, false);
+                             compareKey(Extractor::extract(data[index].getData()), key)) {
+                             return Pair<Iterator, bool>(iteratorAt(index), false);
                          }
             
                          index = next(index);
                          ++distanceToNext;
                      }
         
+                     return insertMissing(hashValue, index, distanceToNext, toInsert);
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class ... Args>
+                 inline Pair<typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator, bool> HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::tryEmplace(KeyType const& k, Args&& ... args) {
+                     return tryEmplaceHashed(hashKey(k), k, std::forward<Args>(args)...);
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class ... Args>
+                 inline Pair<typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator, bool> HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::tryEmplace(KeyType&& k, Args&& ... args) {
+                     return tryEmplaceHashed(hashKey(k), std::move(k), std::forward<Args>(args)...);
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class ... Args>
+                 inline Pair<typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator, bool> HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::tryEmplace(HashedKey<KeyType> const& k, Args&& ... args) {
+                     return tryEmplaceHashed(k.getHash(), k.getKey(), std::forward<Args>(args)...);
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class M>
+                 inline Pair<typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator, bool> HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::insertOrAssign(KeyType const& k, M&& value) {
+                     Pair<Iterator, bool> res = tryEmplace(k, std::forward<M>(value));
+                     if (!res.second) {
+                         res.first->second = std::forward<M>(value);
+                     }
+                     return res;
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class M>
+                 inline Pair<typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator, bool> HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::insertOrAssign(KeyType&& k, M&& value) {
+                     Pair<Iterator, bool> res = tryEmplace(std::move(k), std::forward<M>(value));
+                     if (!res.second) {
+                         res.first->second = std::forward<M>(value);
+                     }
+                     return res;
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class K, class ... Args>
+                 inline Pair<typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator, bool> HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::tryEmplaceHashed(SizeType hashValue, K&& k, Args&& ... args) {
+                     hashValue = Mix::mix(hashValue);
+                     migrateStep();
+                     if (isRehashing()) {
+                         SizeType previous = probe(oldData, oldMask, k, hashValue);
+                         if (previous != oldData.getSize()) {
+                             return Pair<Iterator, bool>(Iterator(oldData.getData() + previous, data.getData()), false);
+                         }
+                     }
+                     SizeType index = bucketFromHash(hashValue);
+                     DistanceType distanceToNext = 0;
+
+                     while (distanceToNext <= data[index].getDistanceToNext()) {
+                         if ((!USE_STORED_HASH_ON_LOOKUP || data[index].bucketHashEquals(hashValue)) && compareKey(Extractor::extract(data[index].getData()), k)) {
+                             return Pair<Iterator, bool>(iteratorAt(index), false);
+                         }
+
+                         index = next(index);
+                         ++distanceToNext;
+                     }
+
+                     ValueType toInsert(std::piecewise_construct, std::forward_as_tuple(std::forward<K>(k)), std::forward_as_tuple(std::forward<Args>(args)...));
+                     return insertMissing(hashValue, index, distanceToNext, toInsert);
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline Pair<typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator, bool> HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::insertMissing(SizeType hashValue, SizeType index, DistanceType distanceToNext, ValueType& toInsert) {
                      if (rehashOnExtremeLoad()) {
                          index = bucketFromHash(hashValue);
                          distanceToNext = 0;
@@ -452,32 +857,36 @@
         
                      if (data[index].isEmpty()) {
                          data[index].setData(distanceToNext, TruncatedHash(hashValue), std::move(toInsert));
+                         setOccupied(index);
                      } else {
                          insertValue(index, distanceToNext, TruncatedHash(hashValue), toInsert);
                      }
                      ++nbElements;
         
-                     return Pair<Iterator, bool>(Iterator(data.getData() + index), true);
+                     return Pair<Iterator, bool>(iteratorAt(index), true);
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
                  template <class ... Args>
-                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::Iterator HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::emplaceHint(ConstIterator, Args&& ... args) {
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::emplaceHint(ConstIterator, Args&& ... args) {
                      return emplace(std::forward<Args>(args)...).first;
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline void HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::clear() {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::clear() {
                      for (BucketEntry<ValueType, STORE_HASH>& bucket : data) {
                          bucket.clear();
                      }
+                     resetOccupancy();
+                     oldData = Detail::Vector<ContainerType, AllocatorType>(data.getAllocator());
+                     migrated = 0;
         
                      nbElements = 0;
                      growAtNextInsert = false;
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline void HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::swap(HashTable& table) {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::swap(HashTable& table) {
                      using std::swap;
         
                      swap(static_cast <Hash&> (*this), static_cast <Hash&> (table));
@@ -487,99 +896,410 @@
                      swap(mask, table.mask);
                      swap(loadThresHold, table.loadThresHold);
                      swap(maxLoadFactor, table.maxLoadFactor);
+                     swap(minLoadFactor, table.minLoadFactor);
                      swap(growAtNextInsert, table.growAtNextInsert);
+                     swap(oldData, table.oldData);
+                     swap(oldMask, table.oldMask);
+                     swap(migrationStart, table.migrationStart);
+                     swap(migrated, table.migrated);
+                     swap(rehashStep, table.rehashStep);
+                     swap(occupancy, table.occupancy);
+                     swap(counters, table.counters);
+                 }
+    
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::merge(HashTable& table) {
+                     if (&table == this || table.isEmpty()) {
+                         return;
+                     }
+                     if (getSize() + table.getSize() > loadThresHold) {
+                         reserve(getSize() + table.getSize());
+                     }
+
+                     Iterator it = table.begin();
+                     while (it != table.end()) {
+                         SizeType hashValue = (canReuseStoredHash(table.getHashSeed())) ? (static_cast <SizeType> (it.getCurrent()->getTruncatedHash())) : (Mix::mix(hashKey(Extractor::extract(*it))));
+                         if (insertMixed(hashValue, *it).second) {
+                             it = table.erase(it);
+                         } else {
+                             ++it;
+                         }
+                     }
                  }
-    
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline void HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::reserve(SizeType count) {
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::reserve(SizeType count) {
                      rehash(static_cast <SizeType> (std::ceil(static_cast <float> (count) / getMaxLoadFactor())));
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline void HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::rehash(SizeType count) {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::rehash(SizeType count) {
+                     finishRehash();
+                     reinsert(count, true);
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::reinsert(SizeType count, bool trustStoredHash) {
                      count = std::max(count, static_cast <SizeType> (std::ceil(static_cast <float> (getSize()) / getMaxLoadFactor())));
                      HashTable newTable(count, static_cast <Hash&> (*this), static_cast <KeyEqual&> (*this));
+                     newTable.setMaxLoadFactor(maxLoadFactor);
+                     newTable.minLoadFactor = minLoadFactor;
+                     counters.onRehash();
+                     auto start = counters.startTimer();
         
-                     bool useStoredHash = USE_STORED_HASH_ON_REHASH(newTable.getBucketCount());
+                     bool useStoredHash = trustStoredHash && USE_STORED_HASH_ON_REHASH(newTable.getBucketCount());
         
                      for (auto& bucket : data) {
                          if (!bucket.isEmpty()) {
-                             SizeType hashValue = (useStoredHash) ? (static_cast <SizeType> (bucket.getTruncatedHash())) : (newTable.hashKey(bucket.getData().first));
+                             SizeType hashValue = (useStoredHash) ? (static_cast <SizeType> (bucket.getTruncatedHash())) : (Mix::mix(newTable.hashKey(Extractor::extract(bucket.getData()))));
                              newTable.insertOnRehash(newTable.bucketFromHash(hashValue), 0, TruncatedHash(hashValue), std::move(bucket.getData()));
                          }
                      }
         
                      newTable.nbElements = nbElements;
+                     newTable.rehashStep = rehashStep;
+                     counters.onMove(start);
+                     newTable.counters = counters;
                      newTable.swap(*this);
                  }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::finishRehash() {
+                     migrate(oldData.getSize());
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::resetStatistics() {
+                     counters.reset();
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::save(int fd) const requires Concept::MemCopyable<ValueType> {
+                     if (isRehashing()) {
+                         HashTable copy(*this);
+                         copy.finishRehash();
+                         copy.save(fd);
+                         return;
+                     }
+                     HashTableInner::SnapshotHeader header = makeSnapshotHeader();
+                     HashTableInner::writeAll(fd, &header, sizeof(header));
+                     HashTableInner::writeAll(fd, data.getData(), data.getSize() * sizeof(ContainerType));
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::load(int fd) requires Concept::MemCopyable<ValueType> {
+                     HashTableInner::SnapshotHeader header;
+                     HashTableInner::readAll(fd, &header, sizeof(header));
+                     checkSnapshotHeader(header);
+        
+                     Detail::Vector<ContainerType, AllocatorType> buckets(data.getAllocator());
+                     buckets.resize(static_cast <SizeType> (header.bucketCount));
+                     HashTableInner::readAll(fd, buckets.getData(), buckets.getSize() * sizeof(ContainerType));
+                     adoptSnapshot(header, std::move(buckets));
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::mapFrom(const char* path) requires Concept::MemCopyable<ValueType> {
+                     #ifdef _WIN32
+                         int fd = ::_open(path, _O_RDONLY | _O_BINARY);
+                         if (fd < 0) {
+                             throw std::system_error(errno, std::generic_category(), "Opening NRE::Core::HashTable snapshot.");
+                         }
+                         try {
+                             load(fd);
+                         } catch (...) {
+                             ::_close(fd);
+                             throw;
+                         }
+                         ::_close(fd);
+                     #else
+                         int fd = ::open(path, O_RDONLY);
+                         if (fd < 0) {
+                             throw std::system_error(errno, std::generic_category(), "Opening NRE::Core::HashTable snapshot.");
+                         }
+                         struct stat info;
+                         if (::fstat(fd, &info) < 0) {
+                             int error = errno;
+                             ::close(fd);
+                             throw std::system_error(error, std::generic_category(), "Opening NRE::Core::HashTable snapshot.");
+                         }
+                         std::size_t fileSize = static_cast <std::size_t> (info.st_size);
+                         if (fileSize < sizeof(HashTableInner::SnapshotHeader)) {
+                             ::close(fd);
+                             throw std::runtime_error("Reading truncated NRE::Core::HashTable snapshot.");
+                         }
+                         void* region = ::mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+                         int error = errno;
+                         ::close(fd);
+                         if (region == MAP_FAILED) {
+                             throw std::system_error(error, std::generic_category(), "Mapping NRE::Core::HashTable snapshot.");
+                         }
+        
+                         try {
+                             HashTableInner::SnapshotHeader header;
+                             std::memcpy(&header, region, sizeof(header));
+                             checkSnapshotHeader(header);
+                             if ((fileSize - sizeof(header)) / sizeof(ContainerType) < header.bucketCount) {
+                                 throw std::runtime_error("Reading truncated NRE::Core::HashTable snapshot.");
+                             }
+        
+                             Detail::Vector<ContainerType, AllocatorType> buckets(data.getAllocator());
+                             buckets.resize(static_cast <SizeType> (header.bucketCount));
+                             std::memcpy(static_cast <void*> (buckets.getData()), static_cast <const char*> (region) + sizeof(header), buckets.getSize() * sizeof(ContainerType));
+                             ::munmap(region, fileSize);
+                             region = nullptr;
+                             adoptSnapshot(header, std::move(buckets));
+                         } catch (...) {
+                             if (region != nullptr) {
+                                 ::munmap(region, fileSize);
+                             }
+                             throw;
+                         }
+                     #endif
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::shrinkToFit() {
+                     finishRehash();
+                     SizeType count = roundUpToPowerOfTwo(static_cast <SizeType> (std::ceil(static_cast <float> (getSize()) / getMaxLoadFactor())));
+                     if (count < getBucketCount()) {
+                         rehash(count);
+                     }
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::compact() {
+                     finishRehash();
+                     SizeType start = 0;
+                     while (start < getBucketCount() && !data[start].isEmpty()) {
+                         ++start;
+                     }
+                     if (start == getBucketCount()) {
+                         return;
+                     }
+        
+                     SizeType free = start;
+                     bool hasFree = true;
+                     for (SizeType step = 1; step < getBucketCount(); ++step) {
+                         SizeType index = (start + step) & mask;
+                         if (data[index].isEmpty()) {
+                             if (!hasFree) {
+                                 free = index;
+                                 hasFree = true;
+                             }
+                             continue;
+                         }
+            
+                         SizeType distance = static_cast <SizeType> (data[index].getDistanceToNext());
+                         SizeType home = (index - distance) & mask;
+                         SizeType target = index;
+                         if (hasFree) {
+                             target = (((free - home) & mask) < distance) ? (free) : (home);
+                         }
+                         if (target == index) {
+                             hasFree = false;
+                             continue;
+                         }
+            
+                         data[target].setData(static_cast <DistanceType> ((target - home) & mask), data[index].getTruncatedHash(), std::move(data[index].getData()));
+                         data[index].clear();
+                         setOccupied(target);
+                         setVacant(index);
+                         free = next(target);
+                     }
+                 }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline Pair<typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::Iterator, typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::Iterator> HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::equalRange(KeyType const& k) {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline Pair<typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator, typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator> HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::equalRange(KeyType const& k) {
                      Iterator it = find(k);
                      return Pair<Iterator, Iterator>(it, (it == end()) ? (it) : (std::next(it)));
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline Pair<typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::ConstIterator, typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::ConstIterator> HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::equalRange(KeyType const& k) const {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline Pair<typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConstIterator, typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConstIterator> HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::equalRange(KeyType const& k) const {
+                     ConstIterator it = find(k);
+                     return Pair<ConstIterator, ConstIterator>(it, (it == end()) ? (it) : (std::next(it)));
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                 inline Pair<typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator, typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator> HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::equalRange(K const& k) {
+                     Iterator it = find(k);
+                     return Pair<Iterator, Iterator>(it, (it == end()) ? (it) : (std::next(it)));
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                 inline Pair<typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConstIterator, typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConstIterator> HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::equalRange(K const& k) const {
                      ConstIterator it = find(k);
                      return Pair<ConstIterator, ConstIterator>(it, (it == end()) ? (it) : (std::next(it)));
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::Iterator HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::find(KeyType const& k) {
-                     return Iterator(const_cast <const HashTable&>(*this).find(k).getCurrent());
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::find(KeyType const& k) {
+                     return find(k, hashKey(k));
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::ConstIterator HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::find(KeyType const& k) const {
-                     SizeType hashValue = hashKey(k);
-                     SizeType index = bucketFromHash(hashValue);
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConstIterator HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::find(KeyType const& k) const {
+                     return find(k, hashKey(k));
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::find(KeyType const& k, SizeType hashValue) {
+                     ConstIterator it = const_cast <const HashTable&>(*this).find(k, hashValue);
+                     return Iterator(it);
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::find(HashedKey<KeyType> const& k) {
+                     return find(k.getKey(), k.getHash());
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConstIterator HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::find(HashedKey<KeyType> const& k) const {
+                     return find(k.getKey(), k.getHash());
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConstIterator HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::find(KeyType const& k, SizeType hashValue) const {
+                     return findHashed(k, Mix::mix(hashValue));
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::find(K const& k) {
+                     ConstIterator it = findHashed(k, Mix::mix(hashKey(k)));
+                     return Iterator(it);
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConstIterator HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::find(K const& k) const {
+                     return findHashed(k, Mix::mix(hashKey(k)));
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class K>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConstIterator HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::findHashed(K const& k, SizeType hashValue) const {
+                     SizeType index = probe(data, mask, k, hashValue);
+                     if (index != data.getSize()) {
+                         return iteratorAt(index);
+                     }
+                     if (isRehashing()) {
+                         index = probe(oldData, oldMask, k, hashValue);
+                         if (index != oldData.getSize()) {
+                             return ConstIterator(oldData.getData() + index, data.getData());
+                         }
+                     }
+        
+                     return end();
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class K>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::probe(Detail::Vector<ContainerType, AllocatorType> const& buckets, SizeType bucketMask, K const& k, SizeType hashValue) const {
+                     SizeType index = hashValue & bucketMask;
                      DistanceType distanceToNext = 0;
         
-                     while (distanceToNext <= data[index].getDistanceToNext()) {
-                         if ((!USE_STORED_HASH_ON_LOOKUP || data[index].bucketHashEquals(hashValue)) && compareKey(data[index].getData().first, k)) {
-                             return ConstIterator(data.getData() + index);
+                     while (distanceToNext <= buckets[index].getDistanceToNext()) {
+                         if (!USE_STORED_HASH_ON_LOOKUP || buckets[index].bucketHashEquals(hashValue)) {
+                             if (compareKey(Extractor::extract(buckets[index].getData()), k)) {
+                                 counters.onLookup(true, static_cast <SizeType> (distanceToNext) + 1);
+                                 return index;
+                             }
+                             counters.onCollision();
                          }
             
-                         index = next(index);
+                         index = (index + 1) & bucketMask;
                          ++distanceToNext;
                      }
         
-                     return end();
-                 }
-    
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::Iterator HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::erase(Iterator pos) {
-                     return erase(ConstIterator(pos.getCurrent()));
+                     counters.onLookup(false, static_cast <SizeType> (distanceToNext) + 1);
+                     return buckets.getSize();
                  }
-    
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::Iterator HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::erase(ConstIterator pos) {
-                     pos.getCurrent()->clear();
-                     nbElements--;
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::removeAt(Detail::Vector<ContainerType, AllocatorType>& buckets, SizeType bucketMask, SizeType index) {
+                     buckets[index].clear();
         
-                     SizeType previousIndex = static_cast <SizeType> (pos.getCurrent() - data.getData());
-                     SizeType index = next(previousIndex);
+                     SizeType previousIndex = index;
+                     index = (index + 1) & bucketMask;
         
-                     while (data[index].getDistanceToNext() > 0) {
-                         DistanceType newDistance = static_cast <DistanceType>(data[index].getDistanceToNext() - 1);
-                         data[previousIndex].setData(newDistance, data[index].getTruncatedHash(), std::move(data[index].getData()));
-                         data[index].clear();
+                     while (buckets[index].getDistanceToNext() > 0) {
+                         DistanceType newDistance = static_cast <DistanceType>(buckets[index].getDistanceToNext() - 1);
+                         buckets[previousIndex].setData(newDistance, buckets[index].getTruncatedHash(), std::move(buckets[index].getData()));
+                         buckets[index].clear();
             
                          previousIndex = index;
-                         index = next(index);
+                         index = (index + 1) & bucketMask;
+                     }
+        
+                     if (&buckets == &data) {
+                         setVacant(previousIndex);
+                     }
+                 }
+    
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::erase(Iterator pos) {
+                     return erase(ConstIterator(pos));
+                 }
+    
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::erase(ConstIterator pos) {
+                     nbElements--;
+                     if (pos.getFollowing() != nullptr) {
+                         removeAt(oldData, oldMask, static_cast <SizeType> (pos.getCurrent() - oldData.getData()));
+                     } else {
+                         SizeType index = static_cast <SizeType> (pos.getCurrent() - data.getData());
+                         removeAt(data, mask, index);
+                         if (!isRehashing()) {
+                             return iteratorAt(nextOccupied(index));
+                         }
                      }
         
                      if (pos.getCurrent()->isEmpty()) {
                          ++pos;
                      }
-                     return Iterator(pos.getCurrent());
+                     return Iterator(pos);
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::Iterator HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::erase(ConstIterator begin, ConstIterator end) {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::NodeType HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::extract(Iterator pos) {
+                     return extract(ConstIterator(pos));
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::NodeType HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::extract(ConstIterator pos) {
+                     NodeType node(pos.getCurrent()->getData(), STORE_HASH, pos.getCurrent()->getTruncatedHash(), getHashSeed(), &NODE_ORIGIN);
+                     erase(pos);
+                     return node;
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::NodeType HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::extract(KeyType const& k) {
+                     ConstIterator it = std::as_const(*this).find(k);
+                     if (it == cend()) {
+                         return NodeType();
+                     }
+                     return extract(it);
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::erase(ConstIterator begin, ConstIterator end) {
                      if (begin == end) {
-                         return Iterator(begin.getCurrent());
+                         return Iterator(begin);
+                     }
+                     if (isRehashing()) {
+                         std::optional<KeyType> stop;
+                         if (end != this->cend()) {
+                             stop.emplace(Extractor::extract(*end));
+                         }
+                         Iterator it(begin);
+                         while (it != this->end() && !(stop && compareKey(Extractor::extract(*it), *stop))) {
+                             it = erase(it);
+                         }
+                         return it;
                      }
         
                      Iterator beginIt(begin.getCurrent());
@@ -591,11 +1311,13 @@
                          }
                      }
         
+                     SizeType firstIndex = static_cast <SizeType> (beginIt.getCurrent() - data.getData());
                      if (endIt == this->end()) {
+                         refreshOccupancy(firstIndex, getBucketCount());
                          return this->end();
                      }
         
-                     SizeType closerIndex = static_cast <SizeType> (beginIt.getCurrent() - data.getData());
+                     SizeType closerIndex = firstIndex;
                      SizeType moveCloserIndex = static_cast <SizeType> (endIt.getCurrent() - data.getData());
         
                      SizeType returnIndex = moveCloserIndex - std::min(moveCloserIndex - closerIndex, static_cast <SizeType> (data[moveCloserIndex].getDistanceToNext()));
@@ -610,33 +1332,101 @@
                          ++closerIndex;
                          ++moveCloserIndex;
                      }
+                     refreshOccupancy(firstIndex, moveCloserIndex);
         
-                     return Iterator(data.getData() + returnIndex);
+                     return iteratorAt(returnIndex);
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::SizeType HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::erase(KeyType const& k) {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::erase(KeyType const& k) {
+                     return erase(k, hashKey(k));
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::erase(HashedKey<KeyType> const& k) {
+                     return erase(k.getKey(), k.getHash());
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::erase(K const& k) {
+                     migrateStep();
                      Iterator it = find(k);
                      if (it != end()) {
                          erase(it);
+                         shrinkOnLowLoad();
+                         return 1;
+                     } else {
+                         return 0;
+                     }
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::erase(KeyType const& k, SizeType hashValue) {
+                     migrateStep();
+                     Iterator it = find(k, hashValue);
+                     if (it != end()) {
+                         erase(it);
+                         shrinkOnLowLoad();
                          return 1;
                      } else {
                          return 0;
                      }
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline Hash HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::getHash() const {
-                     return static_cast <Hash&> (*this);
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class ForwardIterator, class OutputIterator> requires Concept::ForwardIterator<ForwardIterator>
+                 inline void HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::findBatch(ForwardIterator keysBegin, ForwardIterator keysEnd, OutputIterator out) {
+                     SizeType hashes[FIND_BATCH_SIZE];
+                     while (keysBegin != keysEnd) {
+                         ForwardIterator current = keysBegin;
+                         SizeType count = 0;
+                         for (; count < FIND_BATCH_SIZE && keysBegin != keysEnd; ++count, ++keysBegin) {
+                             hashes[count] = Mix::mix(hashKey(*keysBegin));
+                             Memory::prefetch(data.getData() + bucketFromHash(hashes[count]));
+                             if (isRehashing()) {
+                                 Memory::prefetch(oldData.getData() + (hashes[count] & oldMask));
+                             }
+                         }
+                         for (SizeType i = 0; i < count; ++i, ++current, ++out) {
+                             ConstIterator it = findHashed(*current, hashes[i]);
+                             *out = Iterator(it);
+                         }
+                     }
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class ForwardIterator, class OutputIterator> requires Concept::ForwardIterator<ForwardIterator>
+                 inline void HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::findBatch(ForwardIterator keysBegin, ForwardIterator keysEnd, OutputIterator out) const {
+                     SizeType hashes[FIND_BATCH_SIZE];
+                     while (keysBegin != keysEnd) {
+                         ForwardIterator current = keysBegin;
+                         SizeType count = 0;
+                         for (; count < FIND_BATCH_SIZE && keysBegin != keysEnd; ++count, ++keysBegin) {
+                             hashes[count] = Mix::mix(hashKey(*keysBegin));
+                             Memory::prefetch(data.getData() + bucketFromHash(hashes[count]));
+                             if (isRehashing()) {
+                                 Memory::prefetch(oldData.getData() + (hashes[count] & oldMask));
+                             }
+                         }
+                         for (SizeType i = 0; i < count; ++i, ++current, ++out) {
+                             *out = findHashed(*current, hashes[i]);
+                         }
+                     }
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline Hash HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::getHash() const {
+                     return static_cast <Hash const&> (*this);
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline KeyEqual HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::getKeyEqual() const {
-                     return static_cast <KeyEqual&> (*this);
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline KeyEqual HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::getKeyEqual() const {
+                     return static_cast <KeyEqual const&> (*this);
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>& HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::operator =(HashTable const& table) {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>& HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::operator =(HashTable const& table) {
                      if (this != &table) {
                          Hash::operator =(table);
                          KeyEqual::operator =(table);
@@ -646,13 +1436,21 @@
                          mask = table.mask;
                          loadThresHold = table.loadThresHold;
                          maxLoadFactor = table.maxLoadFactor;
+                         minLoadFactor = table.minLoadFactor;
                          growAtNextInsert = table.growAtNextInsert;
+                         oldData = table.oldData;
+                         oldMask = table.oldMask;
+                         migrationStart = table.migrationStart;
+                         migrated = table.migrated;
+                         rehashStep = table.rehashStep;
+                         occupancy = table.occupancy;
+                         counters = table.counters;
                      }
                      return *this;
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>& HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::operator =(HashTable&& table) {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>& HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::operator =(HashTable&& table) {
                      if (this != &table) {
                          swap(table);
                          table.clear();
@@ -660,57 +1458,80 @@
                      return *this;
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::MappedType& HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::operator [](KeyType const& k) {
-                     return (insert(ValueType(k, T())).first)->second;
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::MappedType& HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::operator [](KeyType const& k) {
+                     return (tryEmplace(k).first)->second;
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::MappedType& HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::operator [](KeyType && k) {
-                     return (insert(ValueType(std::move(k), T())).first)->second;
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::MappedType& HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::operator [](KeyType && k) {
+                     return (tryEmplace(std::move(k)).first)->second;
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline String HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::toString() const {
-                     if (isEmpty()) {
-                         return String("{}");
-                     } else {
-                         String res;
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline String HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::toString() const {
+                     String res;
+                     toString(res);
+                     return res;
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::toString(String& out) const {
+                     out.reserve(out.getSize() + estimateStringSize());
+                     StringSink sink(out);
+                     writeTo(sink);
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class S>
+                 inline void HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::writeTo(S& sink) const {
+                     sink.write("{", 1);
+                     if (!isEmpty()) {
                          ConstIterator first = begin();
-                         res << '{' << (*first);
-                         res.reserve((res.getSize() + 2) * nbElements);
+                         Core::format(sink, *first);
                          ++first;
                          while (first != end()) {
-                             res << ',' << ' ' << (*first);
+                             sink.write(", ", 2);
+                             Core::format(sink, *first);
                              ++first;
                          }
-                         res << '}';
-                         return res;
                      }
+                     sink.write("}", 1);
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline std::size_t HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::estimateStringSize() const {
+                     std::size_t size = (isEmpty()) ? (2) : (2 * nbElements);
+                     for (ConstIterator it = begin(); it != end(); ++it) {
+                         size += Core::estimateStringSize(*it);
+                     }
+                     return size;
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::SizeType HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::hashKey(KeyType const& k) const {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class K>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::hashKey(K const& k) const {
                      return Hash::operator ()(k);
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline bool HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::compareKey(KeyType const& k1, KeyType const& k2) const {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class K>
+                 inline bool HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::compareKey(KeyType const& k1, K const& k2) const {
                      return KeyEqual::operator ()(k1, k2);
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::SizeType HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::next(SizeType index) const {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::next(SizeType index) const {
                      return (index + 1) & mask;
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::SizeType HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::bucketFromHash(SizeType hashValue) const {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::bucketFromHash(SizeType hashValue) const {
                      return hashValue & mask;
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::SizeType HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::roundUpToPowerOfTwo(SizeType count) const {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::roundUpToPowerOfTwo(SizeType count) const {
                      if (count == 0) {
                          return 1;
                      }
@@ -726,8 +1547,8 @@
                      return count + 1;
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline void HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::insertValue(SizeType index, DistanceType distanceToNext, TruncatedHash h, ValueType& pair) {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::insertValue(SizeType index, DistanceType distanceToNext, TruncatedHash h, ValueType& pair) {
                      data[index].swapWithData(distanceToNext, h, pair);
                      index = next(index);
                      ++distanceToNext;
@@ -735,6 +1556,7 @@
                      while (!data[index].isEmpty()) {
                          if (distanceToNext > data[index].getDistanceToNext()) {
                              if (distanceToNext >= REHASH_HIGH_PROBE && getLoadFactor() >= REHASH_MIN_LOAD_FACTOR) {
+                                 counters.onHighProbe();
                                  growAtNextInsert = true;
                              }
                              data[index].swapWithData(distanceToNext, h, pair);
@@ -745,15 +1567,17 @@
                      }
         
                      data[index].setData(distanceToNext, h, std::move(pair));
+                     setOccupied(index);
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline void HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::insertOnRehash(SizeType index, DistanceType distanceToNext, TruncatedHash h, ValueType&& pair) {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::insertOnRehash(SizeType index, DistanceType distanceToNext, TruncatedHash h, ValueType&& pair) {
                      bool done = false;
                      while (!done) {
                          if (distanceToNext > data[index].getDistanceToNext()) {
                              if (data[index].isEmpty()) {
                                  data[index].setData(distanceToNext, h, std::move(pair));
+                                 setOccupied(index);
                                  done = true;
                              } else {
                                  data[index].swapWithData(distanceToNext, h, pair);
@@ -765,18 +1589,308 @@
                      }
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline bool HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::rehashOnExtremeLoad() {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline bool HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::rehashOnExtremeLoad() {
                      if (growAtNextInsert || getSize() >= loadThresHold) {
-                         rehash(getNewSize());
+                         if (rehashStep > 0) {
+                             startRehash(getNewSize());
+                         } else {
+                             rehash(getNewSize());
+                         }
                          growAtNextInsert = false;
                          return true;
                      }
                      return false;
                  }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::shrinkOnLowLoad() {
+                     if (minLoadFactor <= 0.0f || isRehashing() || getLoadFactor() >= minLoadFactor) {
+                         return;
+                     }
+                     SizeType count = roundUpToPowerOfTwo(static_cast <SizeType> (std::ceil(2.0f * static_cast <float> (getSize()) / getMaxLoadFactor())));
+                     if (count < getBucketCount()) {
+                         rehash(count);
+                     }
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::startRehash(SizeType count) {
+                     finishRehash();
+                     counters.onRehash();
+                     oldData = std::move(data);
+                     oldMask = mask;
+        
+                     data.resize(count);
+                     data.getLast().setAsLastBucket();
+                     mask = count - 1;
+                     setMaxLoadFactor(maxLoadFactor);
+                     resetOccupancy();
+        
+                     migrationStart = 0;
+                     while (migrationStart < oldMask && oldData[migrationStart].getDistanceToNext() > 0) {
+                         ++migrationStart;
+                     }
+                     migrated = 0;
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::migrate(SizeType count) {
+                     if (!isRehashing()) {
+                         return;
+                     }
+        
+                     auto start = counters.startTimer();
+                     bool useStoredHash = USE_STORED_HASH_ON_REHASH(data.getSize());
+                     for (; count > 0 && migrated <= oldMask; --count, ++migrated) {
+                         SizeType index = (migrationStart + migrated) & oldMask;
+                         while (!oldData[index].isEmpty()) {
+                             SizeType hashValue = (useStoredHash) ? (static_cast <SizeType> (oldData[index].getTruncatedHash())) : (Mix::mix(hashKey(Extractor::extract(oldData[index].getData()))));
+                             insertOnRehash(bucketFromHash(hashValue), 0, TruncatedHash(hashValue), std::move(oldData[index].getData()));
+                             removeAt(oldData, oldMask, index);
+                         }
+                     }
+        
+                     if (migrated > oldMask) {
+                         oldData = Detail::Vector<ContainerType, AllocatorType>(data.getAllocator());
+                         migrated = 0;
+                     }
+                     counters.onMove(start);
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::migrateStep() {
+                     if (!isRehashing()) {
+                         return;
+                     }
+        
+                     SizeType remaining = oldMask + 1 - migrated;
+                     SizeType headroom = (loadThresHold > getSize()) ? (loadThresHold - getSize()) : (1);
+                     migrate(std::max(rehashStep, (remaining + headroom - 1) / headroom));
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class RandomAccessIterator, class IndexVector>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::placeSlice(RandomAccessIterator begin, IndexVector const& order, IndexVector const& hashes, IndexVector& sources, SizeType first, SizeType last, SizeType sliceEnd, IndexVector& overflow) {
+                     // Once an element spilled, later elements homed at or after it also spill, so a later duplicate never sits in the slice
+                     // while its first occurrence waits in the overflow
+                     SizeType spillHome = sliceEnd;
+                     SizeType count = 0;
+                     for (SizeType position = first; position < last; ++position) {
+                         SizeType source = order[position];
+                         ValueType const& element = *(begin + source);
+                         SizeType hashValue = Mix::mix(hashes[source]);
+                         SizeType index = bucketFromHash(hashValue);
+                         DistanceType distanceToNext = 0;
+                         if (index >= spillHome) {
+                             overflow.emplaceBack(source);
+                             continue;
+                         }
+
+                         bool found = false;
+                         while (index < sliceEnd && distanceToNext < REHASH_HIGH_PROBE && distanceToNext <= data[index].getDistanceToNext()) {
+                             if ((!USE_STORED_HASH_ON_LOOKUP || data[index].bucketHashEquals(hashValue)) && compareKey(Extractor::extract(data[index].getData()), Extractor::extract(element))) {
+                                 found = true;
+                                 break;
+                             }
+                             ++index;
+                             ++distanceToNext;
+                         }
+                         if (found) {
+                             continue;
+                         }
+                         if (index == sliceEnd || distanceToNext >= REHASH_HIGH_PROBE) {
+                             spillHome = std::min(spillHome, bucketFromHash(hashValue));
+                             overflow.emplaceBack(source);
+                             continue;
+                         }
+
+                         ValueType toInsert(element);
+                         TruncatedHash h = TruncatedHash(hashValue);
+                         while (true) {
+                             if (data[index].isEmpty()) {
+                                 data[index].setData(distanceToNext, h, std::move(toInsert));
+                                 sources[index] = source;
+                                 setOccupied(index);
+                                 ++count;
+                                 break;
+                             }
+                             if (distanceToNext > data[index].getDistanceToNext()) {
+                                 data[index].swapWithData(distanceToNext, h, toInsert);
+                                 std::swap(sources[index], source);
+                             }
+                             ++index;
+                             ++distanceToNext;
+                             if (index == sliceEnd || distanceToNext >= REHASH_HIGH_PROBE) {
+                                 // The displaced element is dropped, its input copy being replayed from its position
+                                 spillHome = std::min(spillHome, index - static_cast <SizeType> (distanceToNext));
+                                 overflow.emplaceBack(source);
+                                 break;
+                             }
+                         }
+                     }
+                     return count;
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class F>
+                 inline void HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::runOnThreads(SizeType threadCount, F && task) {
+                     std::unique_ptr<std::exception_ptr[]> errors = std::make_unique<std::exception_ptr[]>(threadCount);
+                     auto run = [&](SizeType t) {
+                         try {
+                             task(t);
+                         } catch (...) {
+                             errors[t] = std::current_exception();
+                         }
+                     };
+
+                     std::unique_ptr<std::thread[]> workers = std::make_unique<std::thread[]>(threadCount - 1);
+                     for (SizeType t = 1; t < threadCount; ++t) {
+                         workers[t - 1] = std::thread(run, t);
+                     }
+                     run(0);
+                     for (SizeType t = 1; t < threadCount; ++t) {
+                         workers[t - 1].join();
+                     }
+
+                     for (SizeType t = 0; t < threadCount; ++t) {
+                         if (errors[t]) {
+                             std::rethrow_exception(errors[t]);
+                         }
+                     }
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline bool HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::canReuseStoredHash(std::uint64_t hashSeed) const {
+                     return STORE_HASH && SEED_DEFINES_HASH && hashSeed == getHashSeed() && USE_STORED_HASH_ON_REHASH(getNewSize());
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline std::uint64_t HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::getHashSeed() const {
+                     if constexpr (requires (Hash const& hasher) { hasher.getSeed(); }) {
+                         return static_cast <std::uint64_t> (static_cast <Hash const&> (*this).getSeed());
+                     } else {
+                         return 0;
+                     }
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline HashTableInner::SnapshotHeader HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::makeSnapshotHeader() const {
+                     HashTableInner::SnapshotHeader header;
+                     header.magic = HashTableInner::SNAPSHOT_MAGIC;
+                     header.version = HashTableInner::SNAPSHOT_VERSION;
+                     header.entrySize = sizeof(ContainerType);
+                     header.entryAlign = alignof(ContainerType);
+                     header.storeHash = STORE_HASH;
+                     header.bucketCount = getBucketCount();
+                     header.size = getSize();
+                     header.maxLoadFactor = maxLoadFactor;
+                     header.minLoadFactor = minLoadFactor;
+                     header.hashSeed = getHashSeed();
+                     return header;
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::checkSnapshotHeader(HashTableInner::SnapshotHeader const& header) const {
+                     if (header.magic != HashTableInner::SNAPSHOT_MAGIC) {
+                         throw std::runtime_error("Reading corrupted NRE::Core::HashTable snapshot : wrong signature.");
+                     }
+                     if (header.entrySize != sizeof(ContainerType) || header.entryAlign != alignof(ContainerType) || header.storeHash != STORE_HASH) {
+                         throw std::runtime_error("Reading NRE::Core::HashTable snapshot written for another bucket entry type.");
+                     }
+                     if (header.bucketCount == 0 || (header.bucketCount & (header.bucketCount - 1)) != 0 || header.size > header.bucketCount) {
+                         throw std::runtime_error("Reading corrupted NRE::Core::HashTable snapshot : invalid bucket count.");
+                     }
+                     if (!(header.maxLoadFactor > 0.0f && header.maxLoadFactor <= 1.0f) || !(header.minLoadFactor >= 0.0f && header.minLoadFactor <= header.maxLoadFactor / 4.0f)) {
+                         throw std::runtime_error("Reading corrupted NRE::Core::HashTable snapshot : invalid load factor.");
+                     }
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::adoptSnapshot(HashTableInner::SnapshotHeader const& header, Detail::Vector<ContainerType, AllocatorType>&& buckets) {
+                     SizeType bucketMask = buckets.getSize() - 1;
+                     bool trustLayout = header.version == HashTableInner::SNAPSHOT_VERSION && header.hashSeed == getHashSeed();
+                     SizeType count = 0;
+                     for (SizeType index = 0; index < buckets.getSize(); ++index) {
+                         if (buckets[index].isEmpty()) {
+                             continue;
+                         }
+                         if (trustLayout && count < SNAPSHOT_CHECKED_COUNT) {
+                             SizeType home = (index - static_cast <SizeType> (buckets[index].getDistanceToNext())) & bucketMask;
+                             trustLayout = home == (Mix::mix(hashKey(Extractor::extract(buckets[index].getData()))) & bucketMask);
+                         }
+                         ++count;
+                     }
+                     if (count != header.size) {
+                         throw std::runtime_error("Reading corrupted NRE::Core::HashTable snapshot : wrong element count.");
+                     }
+                     buckets.getLast().setAsLastBucket();
+        
+                     data = std::move(buckets);
+                     mask = bucketMask;
+                     nbElements = count;
+                     minLoadFactor = header.minLoadFactor;
+                     setMaxLoadFactor(header.maxLoadFactor);
+                     growAtNextInsert = false;
+                     oldData = Detail::Vector<ContainerType, AllocatorType>(data.getAllocator());
+                     oldMask = 0;
+                     migrationStart = 0;
+                     migrated = 0;
+                     resetOccupancy();
+                     refreshOccupancy(0, data.getSize());
+                     if (!trustLayout) {
+                         reinsert(getBucketCount(), false);
+                     }
+                 }
+    
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::iteratorAt(SizeType index) {
+                     return Iterator(data.getData() + index, nullptr, occupancy.getData(), data.getData());
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConstIterator HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::iteratorAt(SizeType index) const {
+                     return ConstIterator(data.getData() + index, nullptr, occupancy.getData(), data.getData());
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::nextOccupied(SizeType index) const {
+                     if (isEmpty() || occupancy.isEmpty()) {
+                         return getBucketCount();
+                     }
+                     return HashTableInner::findNextOccupied(occupancy.getData(), index);
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::resetOccupancy() {
+                     occupancy.clear();
+                     occupancy.resize(data.getSize() / HashTableInner::OCCUPANCY_WORD_BITS + 1, 0);
+                     setOccupied(data.getSize());
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::setOccupied(SizeType index) {
+                     occupancy[index / HashTableInner::OCCUPANCY_WORD_BITS] |= static_cast <OccupancyWord> (1) << (index % HashTableInner::OCCUPANCY_WORD_BITS);
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::setVacant(SizeType index) {
+                     occupancy[index / HashTableInner::OCCUPANCY_WORD_BITS] &= ~(static_cast <OccupancyWord> (1) << (index % HashTableInner::OCCUPANCY_WORD_BITS));
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::refreshOccupancy(SizeType from, SizeType to) {
+                     for (SizeType index = from; index < to; ++index) {
+                         if (data[index].isEmpty()) {
+                             setVacant(index);
+                         } else {
+                             setOccupied(index);
+                         }
+                     }
+                 }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::SizeType HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::getNewSize() const {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::getNewSize() const {
                      return data.getSize() * 2;
                  }
     
@@ -0,0 +1,124 @@
+
+    /**
+     * @file NRE_HashTableSnapshot.hpp
+     * @brief Declaration of Core's API's Object : HashTableSnapshot
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+    #pragma once
+
+    #include <cerrno>
+    #include <cstdint>
+    #include <cstddef>
+    #include <cstring>
+    #include <stdexcept>
+    #include <system_error>
+
+    #ifdef _WIN32
+        #include <io.h>
+        #include <fcntl.h>
+    #else
+        #include <unistd.h>
+        #include <fcntl.h>
+        #include <sys/mman.h>
+        #include <sys/stat.h>
+    #endif
+
+    /**
+    * @namespace NRE
+    * @brief The NearlyRealEngine's global namespace
+    */
+    namespace NRE {
+        /**
+         * @namespace Core
+         * @brief Core's API
+         */
+        namespace Core {
+
+            namespace Detail {
+
+                namespace HashTableInner {
+
+                    constexpr std::uint32_t SNAPSHOT_MAGIC   = 0x5448524E;    /**< The snapshot file signature, "NRHT" read as little endian, changed with the bucket entry encoding */
+                    constexpr std::uint32_t SNAPSHOT_VERSION = 1;             /**< The bucket placement version, changed with the probing or the hash mixing */
+
+                    /**
+                     * @struct SnapshotHeader
+                     * @brief The fixed size header written before the raw bucket array
+                     */
+                    struct SnapshotHeader {
+                        std::uint32_t magic;        /**< The snapshot signature */
+                        std::uint32_t version;      /**< The bucket placement version */
+                        std::uint64_t entrySize;    /**< The size of a bucket entry */
+                        std::uint64_t entryAlign;   /**< The alignment of a bucket entry */
+                        std::uint64_t storeHash;    /**< Tell if bucket entries hold a truncated hash */
+                        std::uint64_t bucketCount;  /**< The number of buckets */
+                        std::uint64_t size;         /**< The number of elements */
+                        float maxLoadFactor;        /**< The maximum load factor */
+                        float minLoadFactor;        /**< The minimum load factor */
+                        std::uint64_t hashSeed;     /**< The hash function seed, 0 if unseeded */
+                    };
+
+                    static_assert(sizeof(SnapshotHeader) == 64);    /**< Keep the header size independent of the platform */
+
+                    /**
+                     * Write the whole given buffer into a file descriptor
+                     * @param fd    the destination file descriptor
+                     * @param data  the buffer to write
+                     * @param count the number of bytes to write
+                     * @throw std::system_error if the write fails
+                     */
+                    inline void writeAll(int fd, void const* data, std::size_t count) {
+                        char const* bytes = static_cast <char const*> (data);
+                        while (count > 0) {
+                            #ifdef _WIN32
+                                int written = ::_write(fd, bytes, static_cast <unsigned int> (count));
+                            #else
+                                ssize_t written = ::write(fd, bytes, count);
+                            #endif
+                            if (written < 0) {
+                                if (errno == EINTR) {
+                                    continue;
+                                }
+                                throw std::system_error(errno, std::generic_category(), "Writing NRE::Core::HashTable snapshot.");
+                            }
+                            bytes += written;
+                            count -= static_cast <std::size_t> (written);
+                        }
+                    }
+
+                    /**
+                     * Fill the whole given buffer from a file descriptor
+                     * @param fd    the source file descriptor
+                     * @param data  the buffer to fill
+                     * @param count the number of bytes to read
+                     * @throw std::system_error  if the read fails
+                     * @throw std::runtime_error if the file ends before count bytes
+                     */
+                    inline void readAll(int fd, void* data, std::size_t count) {
+                        char* bytes = static_cast <char*> (data);
+                        while (count > 0) {
+                            #ifdef _WIN32
+                                int nbRead = ::_read(fd, bytes, static_cast <unsigned int> (count));
+                            #else
+                                ssize_t nbRead = ::read(fd, bytes, count);
+                            #endif
+                            if (nbRead < 0) {
+                                if (errno == EINTR) {
+                                    continue;
+                                }
+                                throw std::system_error(errno, std::generic_category(), "Reading NRE::Core::HashTable snapshot.");
+                            }
+                            if (nbRead == 0) {
+                                throw std::runtime_error("Reading truncated NRE::Core::HashTable snapshot.");
+                            }
+                            bytes += nbRead;
+                            count -= static_cast <std::size_t> (nbRead);
+                        }
+                    }
+                }
+            }
+        }
+    }
@@ -0,0 +1,254 @@
+
+    /**
+     * @file NRE_HashTableStatistics.hpp
+     * @brief Declaration of Core's API's Object : HashTableStatistics
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+    #pragma once
+
+    #include <atomic>
+    #include <chrono>
+    #include <cstddef>
+
+    #include "../../Array/NRE_Array.hpp"
+
+    /**
+    * @namespace NRE
+    * @brief The NearlyRealEngine's global namespace
+    */
+    namespace NRE {
+        /**
+         * @namespace Core
+         * @brief Core's API
+         */
+        namespace Core {
+
+            namespace Detail {
+
+                namespace HashTableInner {
+
+                    #ifdef NRE_USE_HASHTABLE_STATISTICS
+                        constexpr bool COLLECT_STATISTICS = true;     /**< Tell if the tables count their events, enabled by defining NRE_USE_HASHTABLE_STATISTICS */
+                    #else
+                        constexpr bool COLLECT_STATISTICS = false;    /**< Tell if the tables count their events, enabled by defining NRE_USE_HASHTABLE_STATISTICS */
+                    #endif
+
+                    /**
+                     * @struct HashTableStatistics
+                     * @brief A snapshot of a table layout and events
+                     *
+                     * The layout part is computed from the buckets when the snapshot is taken, the events part stays at 0 unless the statistics are collected.
+                     */
+                    struct HashTableStatistics {
+                        static constexpr std::size_t HISTOGRAM_SIZE = 16;    /**< The number of histogram entries, the last one counting every longer distance */
+
+                        std::size_t size = 0;                                   /**< The number of elements */
+                        std::size_t bucketCount = 0;                            /**< The number of buckets */
+                        float loadFactor = 0.0f;                                /**< The load factor */
+                        Array<std::size_t, HISTOGRAM_SIZE> distanceHistogram{}; /**< The number of elements at each distance from their home bucket */
+                        double averageDistance = 0.0;                           /**< The average distance from the home bucket */
+                        std::size_t maxDistance = 0;                            /**< The longest distance from the home bucket */
+                        std::size_t lookupCount = 0;                            /**< The number of key searches in a bucket array, made by find and by insertions while rehashing */
+                        std::size_t hitCount = 0;                               /**< The number of lookups finding their key */
+                        std::size_t probeCount = 0;                             /**< The number of buckets visited by lookups */
+                        std::size_t collisionCount = 0;                         /**< The number of key comparisons failing during lookups */
+                        std::size_t rehashCount = 0;                            /**< The number of rehashes, incremental ones included */
+                        std::chrono::nanoseconds rehashTime{0};                 /**< The time spent moving elements while rehashing */
+                        std::size_t highProbeCount = 0;                         /**< The number of insertions displacing an element too far, scheduling a growth */
+
+                        /**
+                         * @return the ratio of lookups finding their key, 0 if none
+                         */
+                        double getHitRatio() const {
+                            return (lookupCount == 0) ? (0.0) : (static_cast <double> (hitCount) / static_cast <double> (lookupCount));
+                        }
+                        /**
+                         * @return the average number of buckets visited by a lookup, 0 if none
+                         */
+                        double getAverageProbeLength() const {
+                            return (lookupCount == 0) ? (0.0) : (static_cast <double> (probeCount) / static_cast <double> (lookupCount));
+                        }
+                    };
+
+                    /**
+                     * @class StatisticsCounters
+                     * @brief Count the table events, or nothing depending on the template value
+                     */
+                    template <bool Enabled>
+                    class StatisticsCounters {
+                        public :    // Traits
+                            /** The rehash timer start */
+                            using TimePoint = std::chrono::steady_clock::time_point;
+
+                        public :    // Methods
+                            /**
+                             * @return the rehash timer start
+                             */
+                            TimePoint startTimer() const {
+                                return TimePoint();
+                            }
+                            /**
+                             * Count a lookup
+                             * @param hit    if the key has been found
+                             * @param probes the number of visited buckets
+                             */
+                            void onLookup(bool, std::size_t) const {
+                            }
+                            /**
+                             * Count a failed key comparison
+                             */
+                            void onCollision() const {
+                            }
+                            /**
+                             * Count a rehash
+                             */
+                            void onRehash() {
+                            }
+                            /**
+                             * Count the time spent moving elements
+                             * @param start the timer start
+                             */
+                            void onMove(TimePoint) {
+                            }
+                            /**
+                             * Count an insertion displacing an element too far
+                             */
+                            void onHighProbe() {
+                            }
+                            /**
+                             * Reset all counters
+                             */
+                            void reset() {
+                            }
+                            /**
+                             * Copy the counters into a snapshot
+                             * @param stats the snapshot to fill
+                             */
+                            void fill(HashTableStatistics&) const {
+                            }
+                    };
+
+                    /**
+                     * @class StatisticsCounters
+                     * @brief Count the table events, or nothing depending on the template value
+                     * Counters are relaxed atomics, as lookups may run concurrently under a shared lock
+                     */
+                    template <>
+                    class StatisticsCounters<true> {
+                        public :    // Traits
+                            /** The rehash timer start */
+                            using TimePoint = std::chrono::steady_clock::time_point;
+
+                        private :   // Fields
+                            mutable std::atomic<std::size_t> lookups;       /**< The number of lookups */
+                            mutable std::atomic<std::size_t> hits;          /**< The number of lookups finding their key */
+                            mutable std::atomic<std::size_t> probes;        /**< The number of buckets visited by lookups */
+                            mutable std::atomic<std::size_t> collisions;    /**< The number of failed key comparisons */
+                            std::size_t rehashes;                           /**< The number of rehashes */
+                            std::chrono::nanoseconds moveTime;              /**< The time spent moving elements */
+                            std::size_t highProbes;                         /**< The number of insertions displacing an element too far */
+
+                        public :    // Methods
+                            //## Constructor ##//
+                                /**
+                                 * Construct zeroed counters
+                                 */
+                                StatisticsCounters() : lookups(0), hits(0), probes(0), collisions(0), rehashes(0), moveTime(0), highProbes(0) {
+                                }
+
+                            //## Copy Constructor ##//
+                                /**
+                                 * Copy counters into this
+                                 * @param counters the counters to copy
+                                 */
+                                StatisticsCounters(StatisticsCounters const& counters) : lookups(counters.lookups.load(std::memory_order_relaxed)), hits(counters.hits.load(std::memory_order_relaxed)), probes(counters.probes.load(std::memory_order_relaxed)), collisions(counters.collisions.load(std::memory_order_relaxed)), rehashes(counters.rehashes), moveTime(counters.moveTime), highProbes(counters.highProbes) {
+                                }
+
+                            //## Methods ##//
+                                /**
+                                 * @return the rehash timer start
+                                 */
+                                TimePoint startTimer() const {
+                                    return std::chrono::steady_clock::now();
+                                }
+                                /**
+                                 * Count a lookup
+                                 * @param hit    if the key has been found
+                                 * @param count  the number of visited buckets
+                                 */
+                                void onLookup(bool hit, std::size_t count) const {
+                                    lookups.fetch_add(1, std::memory_order_relaxed);
+                                    probes.fetch_add(count, std::memory_order_relaxed);
+                                    if (hit) {
+                                        hits.fetch_add(1, std::memory_order_relaxed);
+                                    }
+                                }
+                                /**
+                                 * Count a failed key comparison
+                                 */
+                                void onCollision() const {
+                                    collisions.fetch_add(1, std::memory_order_relaxed);
+                                }
+                                /**
+                                 * Count a rehash
+                                 */
+                                void onRehash() {
+                                    ++rehashes;
+                                }
+                                /**
+                                 * Count the time spent moving elements
+                                 * @param start the timer start
+                                 */
+                                void onMove(TimePoint start) {
+                                    moveTime += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+                                }
+                                /**
+                                 * Count an insertion displacing an element too far
+                                 */
+                                void onHighProbe() {
+                                    ++highProbes;
+                                }
+                                /**
+                                 * Reset all counters
+                                 */
+                                void reset() {
+                                    *this = StatisticsCounters();
+                                }
+                                /**
+                                 * Copy the counters into a snapshot
+                                 * @param stats the snapshot to fill
+                                 */
+                                void fill(HashTableStatistics& stats) const {
+                                    stats.lookupCount = lookups.load(std::memory_order_relaxed);
+                                    stats.hitCount = hits.load(std::memory_order_relaxed);
+                                    stats.probeCount = probes.load(std::memory_order_relaxed);
+                                    stats.collisionCount = collisions.load(std::memory_order_relaxed);
+                                    stats.rehashCount = rehashes;
+                                    stats.rehashTime = moveTime;
+                                    stats.highProbeCount = highProbes;
+                                }
+
+                            //## Assignment Operator ##//
+                                /**
+                                 * Copy counters into this
+                                 * @param counters the counters to copy
+                                 * @return         the reference of himself
+                                 */
+                                StatisticsCounters& operator =(StatisticsCounters const& counters) {
+                                    lookups.store(counters.lookups.load(std::memory_order_relaxed), std::memory_order_relaxed);
+                                    hits.store(counters.hits.load(std::memory_order_relaxed), std::memory_order_relaxed);
+                                    probes.store(counters.probes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+                                    collisions.store(counters.collisions.load(std::memory_order_relaxed), std::memory_order_relaxed);
+                                    rehashes = counters.rehashes;
+                                    moveTime = counters.moveTime;
+                                    highProbes = counters.highProbes;
+                                    return *this;
+                                }
+                    };
+                }
+            }
+        }
+    }
@@ -0,0 +1,466 @@
+
+    /**
+     * @file Detail/IndexMap/NRE_IndexMap.hpp
+     * @brief Declaration of Core's API's Container : IndexMap
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+     #pragma once
+
+    #include <cstdint>
+    #include <limits>
+    #include <stdexcept>
+    #include <tuple>
+
+    #include "../../String/NRE_String.hpp"
+    #include "../../Pair/NRE_Pair.hpp"
+    #include "../../Interfaces/Stringable/NRE_Stringable.hpp"
+    #include "../../Traits/NRE_TypeTraits.hpp"
+    #include "../../Hash/NRE_HashMix.hpp"
+    #include "../Vector/NRE_Vector.hpp"
+
+    #include <Memory/Traits/NRE_MemoryTraits.hpp>
+
+     /**
+     * @namespace NRE
+     * @brief The NearlyRealEngine's global namespace
+     */
+    namespace NRE {
+        /**
+         * @namespace Core
+         * @brief Core's API
+         */
+        namespace Core {
+
+            namespace Detail {
+
+                /**
+                 * @class IndexMap
+                 * @brief An insertion ordered map, entries are stored contiguously and found through a compact index table
+                 *
+                 * The index table only holds 32 bits entry offsets and is probed linearly, each entry keeping its mixed hash so growing never rehash keys.
+                 * Iteration is a linear scan of the entries in insertion order, whatever the table capacity.
+                 * erase moves the last entry in the erased place, shiftErase keeps the order at a linear cost.
+                 */
+                template <class Key, class T, class Allocator, class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key>, class Mix = DefaultHashMix<Key, Hash>>
+                class IndexMap : public Stringable<IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>>, private Hash, private KeyEqual {
+                    static_assert(Memory::IsAllocatorV<Allocator>);                                /**< Check if the given AllocatorType inherit from NRE::Memory::AllocatorTraits */
+                    static_assert(std::is_same_v<Pair<Key, T>, typename Allocator::ValueType>);    /**< Make sure the allocator is set for the container inner type */
+
+                    public :    // Traits
+                        /** The map key type */
+                        using KeyType               = Key;
+                        /** The map mapped type */
+                        using MappedType            = T;
+                        /** The container's allocated type */
+                        using ValueType             = Pair<KeyType, MappedType>;
+                        /** The entry offset stored in the index table */
+                        using IndexType             = std::uint32_t;
+                        /** The object's size type */
+                        using SizeType              = std::size_t;
+                        /** The object's difference type */
+                        using DifferenceType        = std::ptrdiff_t;
+                        /** The container's allocator */
+                        using AllocatorType         = Allocator;
+                        /** The allocated type reference */
+                        using Reference             = ValueType&;
+                        /** The allocated type const reference */
+                        using ConstReference        = ValueType const&;
+                        /** The allocated type pointer */
+                        using Pointer               = typename AllocatorType::Pointer;
+                        /** The allocated type const pointer */
+                        using ConstPointer          = typename AllocatorType::ConstPointer;
+                        /** Mutable random access iterator, in insertion order */
+                        using Iterator              = typename Detail::Vector<ValueType, Allocator>::Iterator;
+                        /** Immuable random access iterator, in insertion order */
+                        using ConstIterator         = typename Detail::Vector<ValueType, Allocator>::ConstIterator;
+                        /** STL compatibility */
+                        using key_type              = KeyType;
+                        /** STL compatibility */
+                        using mapped_type           = MappedType;
+                        /** STL compatibility */
+                        using value_type            = ValueType;
+                        /** STL compatibility */
+                        using allocator_type        = AllocatorType;
+                        /** STL compatibility */
+                        using size_type             = SizeType;
+                        /** STL compatibility */
+                        using difference_type       = DifferenceType;
+                        /** STL compatibility */
+                        using reference             = Reference;
+                        /** STL compatibility */
+                        using const_reference       = ConstReference;
+                        /** STL compatibility */
+                        using pointer               = Pointer;
+                        /** STL compatibility */
+                        using const_pointer         = ConstPointer;
+                        /** STL compatibility */
+                        using iterator              = Iterator;
+                        /** STL compatibility */
+                        using const_iterator        = ConstIterator;
+
+                    private :   // Fields
+                        Detail::Vector<ValueType, Allocator> entries;                                               /**< The entries, in insertion order */
+                        Detail::Vector<SizeType, typename Allocator::template Rebind<SizeType>> hashes;             /**< The mixed hash of each entry */
+                        Detail::Vector<IndexType, typename Allocator::template Rebind<IndexType>> indices;          /**< The index table, entry offsets or EMPTY_INDEX */
+                        SizeType mask;                                                                             /**< The index table mask */
+
+                    public :    // Methods
+                        //## Constructor ##//
+                            /**
+                             * Construct an empty map able to hold count elements without growing
+                             * @param count  the number of elements to reserve
+                             * @param hasher the hash function used in the map
+                             * @param equal  the equal function used in the map
+                             * @param alloc  the entries memory allocator
+                             */
+                            IndexMap(SizeType count = 0, Hash const& hasher = Hash(), KeyEqual const& equal = KeyEqual(), Allocator const& alloc = Allocator());
+                            /**
+                             * Construct a map filled with elements in the given range, in order
+                             * @param begin  the begin iterator
+                             * @param end    the end iterator
+                             * @param hasher the hash function used in the map
+                             * @param equal  the equal function used in the map
+                             * @param alloc  the entries memory allocator
+                             */
+                            template <class InputIterator>
+                            IndexMap(InputIterator begin, InputIterator end, Hash const& hasher = Hash(), KeyEqual const& equal = KeyEqual(), Allocator const& alloc = Allocator());
+                            /**
+                             * Construct a map filled with elements in the given list, in order
+                             * @param list   the list to fill the map with
+                             * @param hasher the hash function used in the map
+                             * @param equal  the equal function used in the map
+                             * @param alloc  the entries memory allocator
+                             */
+                            IndexMap(std::initializer_list<ValueType> list, Hash const& hasher = Hash(), KeyEqual const& equal = KeyEqual(), Allocator const& alloc = Allocator());
+
+                        //## Copy Constructor ##//
+                            /**
+                             * Copy map into this
+                             * @param map the map to copy
+                             */
+                            IndexMap(IndexMap const& map) = default;
+
+                        //## Move Constructor ##//
+                            /**
+                             * Move map into this
+                             * @param map the map to move
+                             */
+                            IndexMap(IndexMap && map);
+
+                        //## Getter ##//
+                            /**
+                             * Return the value mapped to the given key
+                             * @param  k the key to search
+                             * @return   the mapped value
+                             * @throw std::out_of_range if the key is not in the map
+                             */
+                            MappedType& get(KeyType const& k);
+                            /**
+                             * Return the value mapped to the given key
+                             * @param  k the key to search
+                             * @return   the mapped value
+                             * @throw std::out_of_range if the key is not in the map
+                             */
+                            MappedType const& get(KeyType const& k) const;
+                            /**
+                             * @return the number of elements in the map
+                             */
+                            SizeType getSize() const;
+                            /**
+                             * @return the number of slots in the index table
+                             */
+                            SizeType getIndexCapacity() const;
+                            /**
+                             * @return the maximum map size
+                             */
+                            constexpr SizeType getMaxSize() const;
+                            /**
+                             * @return the map's memory allocator
+                             */
+                            Allocator getAllocator() const;
+                            /**
+                             * @return if the map is empty
+                             */
+                            bool isEmpty() const;
+                            /**
+                             * Find the number of element with the given key
+                             * @param  k the key to search
+                             * @return   the number of corresponding elements
+                             */
+                            SizeType getCount(KeyType const& k) const;
+                            /**
+                             * Find the insertion rank of the given key
+                             * @param  k the key to search
+                             * @return   the entry position, or the map size if not found
+                             */
+                            SizeType getIndex(KeyType const& k) const;
+                            /**
+                             * Return the entry at the given position
+                             * @param  index the entry position, in insertion order
+                             * @return       the entry
+                             */
+                            Reference getEntry(SizeType index);
+                            /**
+                             * Return the entry at the given position
+                             * @param  index the entry position, in insertion order
+                             * @return       the entry
+                             */
+                            ConstReference getEntry(SizeType index) const;
+                            /**
+                             * @return the number of bytes used by the map, its entries and index table included
+                             */
+                            SizeType getMemoryUsage() const;
+
+                        //## Iterator Access ##//
+                            /**
+                             * @return an iterator on the first inserted element
+                             */
+                            Iterator begin();
+                            /**
+                             * @return a const iterator on the first inserted element
+                             */
+                            ConstIterator begin() const;
+                            /**
+                             * @return a const iterator on the first inserted element
+                             */
+                            ConstIterator cbegin() const;
+                            /**
+                             * @return an iterator on the end of the container
+                             */
+                            Iterator end();
+                            /**
+                             * @return a const iterator on the end of the container
+                             */
+                            ConstIterator end() const;
+                            /**
+                             * @return a const iterator on the end of the container
+                             */
+                            ConstIterator cend() const;
+
+                        //## Methods ##//
+                            /**
+                             * Insert an element at the end of the map if its key is not already in
+                             * @param  value the element to insert
+                             * @return       an iterator on the element with the same key and if the insertion has been done
+                             */
+                            Pair<Iterator, bool> insert(ValueType const& value);
+                            /**
+                             * Insert an element at the end of the map if its key is not already in
+                             * @param  value the element to insert
+                             * @return       an iterator on the element with the same key and if the insertion has been done
+                             */
+                            Pair<Iterator, bool> insert(ValueType && value);
+                            /**
+                             * Insert all elements in the given range, in order
+                             * @param begin the range begin
+                             * @param end   the range end
+                             */
+                            template <class InputIterator>
+                            void insert(InputIterator begin, InputIterator end);
+                            /**
+                             * Insert all elements in the given list, in order
+                             * @param list the list of elements to insert
+                             */
+                            void insert(std::initializer_list<ValueType> list);
+                            /**
+                             * Emplace an element at the end of the map if its key is not already in
+                             * @param  args the parameter pack used to create the inserted pair
+                             * @return      an iterator on the element with the same key and if the insertion has been done
+                             */
+                            template <class ... Args>
+                            Pair<Iterator, bool> emplace(Args && ... args);
+                            /**
+                             * Build the mapped value from args and insert it at the end of the map, only if the key is not already in
+                             * @param  k    the key to insert
+                             * @param  args the mapped value construction arguments
+                             * @return      an iterator on the element with the same key and if the insertion has been done
+                             */
+                            template <class ... Args>
+                            Pair<Iterator, bool> tryEmplace(KeyType const& k, Args && ... args);
+                            /**
+                             * Insert the given value at the end of the map, or assign it to the already mapped value
+                             * @param  k     the key to insert or update
+                             * @param  value the mapped value
+                             * @return       an iterator on the element with the same key and if the insertion has been done
+                             */
+                            template <class M>
+                            Pair<Iterator, bool> insertOrAssign(KeyType const& k, M && value);
+                            /**
+                             * Clear all elements in the map
+                             */
+                            void clear();
+                            /**
+                             * Swap the map with the given one
+                             * @param map the other map
+                             */
+                            void swap(IndexMap& map);
+                            /**
+                             * Reserve enough room to hold count elements without growing
+                             * @param count the number of desired elements
+                             */
+                            void reserve(SizeType count);
+                            /**
+                             * Find the element with the given key
+                             * @param  k the key to search
+                             * @return   the corresponding iterator or end if not found
+                             */
+                            Iterator find(KeyType const& k);
+                            /**
+                             * Find the element with the given key
+                             * @param  k the key to search
+                             * @return   the corresponding iterator or end if not found
+                             */
+                            ConstIterator find(KeyType const& k) const;
+                            /**
+                             * Erase an element, the last element takes its place
+                             * @param  pos the element position
+                             * @return     an iterator on the element now at the erased position
+                             */
+                            Iterator erase(ConstIterator pos);
+                            /**
+                             * Erase the element with the given key, the last element takes its place
+                             * @param  k the key of the element to erase
+                             * @return   the number of erased elements
+                             */
+                            SizeType erase(KeyType const& k);
+                            /**
+                             * Erase the element with the given key, the following elements are shifted to keep the insertion order
+                             * @param  k the key of the element to erase
+                             * @return   the number of erased elements
+                             */
+                            SizeType shiftErase(KeyType const& k);
+                            /**
+                             * @return the map's hash function
+                             */
+                            Hash getHash() const;
+                            /**
+                             * @return the map's key equal function
+                             */
+                            KeyEqual getKeyEqual() const;
+
+                        //## Assignment Operator ##//
+                            /**
+                             * Copy map into this
+                             * @param map the map to copy into this
+                             * @return    the reference of himself
+                             */
+                            IndexMap& operator =(IndexMap const& map) = default;
+                            /**
+                             * Move map into this
+                             * @param map the map to move into this
+                             * @return    the reference of himself
+                             */
+                            IndexMap& operator =(IndexMap && map);
+
+                        //## Access Operator ##//
+                            /**
+                             * Return the value mapped to the given key, inserting a default one at the end if not found
+                             * @param  k the key to search
+                             * @return   the mapped value
+                             */
+                            MappedType& operator [](KeyType const& k);
+
+                        //## Comparison Operator ##//
+                            /**
+                             * Equality test between this and map, regardless of the insertion order
+                             * @param map the other map
+                             * @return    the test's result
+                             */
+                            bool operator ==(IndexMap const& map) const;
+                            /**
+                             * Inequality test between this and map, regardless of the insertion order
+                             * @param map the other map
+                             * @return    the test's result
+                             */
+                            bool operator !=(IndexMap const& map) const;
+
+                        //## Stream Operator ##//
+                            /**
+                             * Convert the map into a string, in insertion order
+                             * @return the converted map
+                             */
+                            [[nodiscard]] String toString() const;
+                            /**
+                             * Append the map's textual form to out, reserving the estimated size once
+                             * @param out the string to append to
+                             */
+                            void toString(String& out) const;
+                            /**
+                             * @return an upper estimate of the textual form size
+                             */
+                            std::size_t estimateStringSize() const;
+                            /**
+                             * Write the map's textual form into the given sink
+                             * @param sink the destination sink
+                             */
+                            template <class S>
+                            void writeTo(S& sink) const;
+
+                    private :   // Methods
+                        /**
+                         * Hash a key
+                         * @param  k the key to hash
+                         * @return   the key mixed hash
+                         */
+                        SizeType hashKey(KeyType const& k) const;
+                        /**
+                         * Probe the index table for the given key
+                         * @param  k         the key to search
+                         * @param  hashValue the key mixed hash
+                         * @return           the slot holding the key, or the empty slot ending the probe
+                         */
+                        SizeType findSlot(KeyType const& k, SizeType hashValue) const;
+                        /**
+                         * Find the slot referencing the given entry
+                         * @param  index the entry position
+                         * @return       the slot holding the entry offset
+                         */
+                        SizeType findSlotOf(SizeType index) const;
+                        /**
+                         * Append an entry built from args, the key must be missing
+                         * @param  slot      the empty slot ending the key probe
+                         * @param  hashValue the key mixed hash
+                         * @param  args      the entry construction arguments
+                         * @return           an iterator on the inserted entry
+                         */
+                        template <class ... Args>
+                        Iterator append(SizeType slot, SizeType hashValue, Args && ... args);
+                        /**
+                         * Empty a slot and shift back the following slots of its cluster
+                         * @param slot the slot to empty
+                         */
+                        void eraseSlot(SizeType slot);
+                        /**
+                         * Erase the entry at the given position, moving the last one in its place
+                         * @param index the entry position
+                         */
+                        void swapErase(SizeType index);
+                        /**
+                         * Rebuild the index table with the given capacity, from the stored hashes
+                         * @param capacity the new slot count, a power of two
+                         */
+                        void rebuildIndex(SizeType capacity);
+                        /**
+                         * Grow the index table if one more element would exceed the maximum load factor
+                         * @return if the index table has been rebuilt
+                         */
+                        bool growIfNeeded();
+
+                    private :   // Static
+                        static constexpr IndexType EMPTY_INDEX     = std::numeric_limits<IndexType>::max();    /**< The offset marking an empty slot */
+                        static constexpr SizeType MIN_INDEX_CAPACITY = 8;                                     /**< The minimum index table capacity */
+                        /**
+                         * Compute the index table capacity holding count elements under the maximum load factor, three quarters of the slots
+                         * @param  count the number of elements
+                         * @return       the index table capacity, a power of two
+                         */
+                        static SizeType capacityFor(SizeType count);
+                };
+            }
+        }
+    }
+
+    #include "NRE_IndexMap.tpp"
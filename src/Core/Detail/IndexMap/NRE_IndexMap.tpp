@@ -0,0 +1,476 @@
+
+    /**
+     * @file NRE_IndexMap.tpp
+     * @brief Implementation of Core's API's Container : IndexMap
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+     namespace NRE {
+         namespace Core {
+             namespace Detail {
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 inline IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::IndexMap(SizeType count, Hash const& hasher, KeyEqual const& equal, Allocator const& alloc) : Hash(hasher), KeyEqual(equal), entries(alloc), hashes(alloc), indices(alloc), mask(0) {
+                     reserve(count);
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 template <class InputIterator>
+                 inline IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::IndexMap(InputIterator begin, InputIterator end, Hash const& hasher, KeyEqual const& equal, Allocator const& alloc) : IndexMap(0, hasher, equal, alloc) {
+                     insert(begin, end);
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 inline IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::IndexMap(std::initializer_list<ValueType> list, Hash const& hasher, KeyEqual const& equal, Allocator const& alloc) : IndexMap(list.size(), hasher, equal, alloc) {
+                     insert(list);
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 inline IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::IndexMap(IndexMap && map) : Hash(std::move(static_cast <Hash&> (map))), KeyEqual(std::move(static_cast <KeyEqual&> (map))), entries(std::move(map.entries)), hashes(std::move(map.hashes)), indices(std::move(map.indices)), mask(map.mask) {
+                     map.rebuildIndex(MIN_INDEX_CAPACITY);
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 inline typename IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::MappedType& IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::get(KeyType const& k) {
+                     Iterator it = find(k);
+                     if (it == end()) {
+                         throw std::out_of_range("Accessing non-existing key in NRE::Core::IndexMap.");
+                     }
+                     return it->second;
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 inline typename IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::MappedType const& IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::get(KeyType const& k) const {
+                     ConstIterator it = find(k);
+                     if (it == end()) {
+                         throw std::out_of_range("Accessing non-existing key in NRE::Core::IndexMap.");
+                     }
+                     return it->second;
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 inline typename IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::SizeType IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::getSize() const {
+                     return entries.getSize();
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 inline typename IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::SizeType IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::getIndexCapacity() const {
+                     return indices.getSize();
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 constexpr typename IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::SizeType IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::getMaxSize() const {
+                     return static_cast <SizeType> (EMPTY_INDEX);
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 inline Allocator IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::getAllocator() const {
+                     return entries.getAllocator();
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 inline bool IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::isEmpty() const {
+                     return entries.isEmpty();
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 inline typename IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::SizeType IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::getCount(KeyType const& k) const {
+                     return (find(k) == end()) ? (0) : (1);
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 inline typename IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::SizeType IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::getIndex(KeyType const& k) const {
+                     IndexType index = indices[findSlot(k, hashKey(k))];
+                     return (index == EMPTY_INDEX) ? (getSize()) : (static_cast <SizeType> (index));
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 inline typename IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::Reference IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::getEntry(SizeType index) {
+                     return entries[index];
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 inline typename IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::ConstReference IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::getEntry(SizeType index) const {
+                     return entries[index];
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 inline typename IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::SizeType IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::getMemoryUsage() const {
+                     return sizeof(*this) + entries.getCapacity() * sizeof(ValueType) + hashes.getCapacity() * sizeof(SizeType) + indices.getCapacity() * sizeof(IndexType);
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 inline typename IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::Iterator IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::begin() {
+                     return entries.begin();
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 inline typename IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::ConstIterator IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::begin() const {
+                     return entries.begin();
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 inline typename IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::ConstIterator IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::cbegin() const {
+                     return entries.cbegin();
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 inline typename IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::Iterator IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::end() {
+                     return entries.end();
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 inline typename IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::ConstIterator IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::end() const {
+                     return entries.end();
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 inline typename IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::ConstIterator IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::cend() const {
+                     return entries.cend();
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 inline Pair<typename IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::Iterator, bool> IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::insert(ValueType const& value) {
+                     SizeType hashValue = hashKey(value.first);
+                     SizeType slot = findSlot(value.first, hashValue);
+                     if (indices[slot] != EMPTY_INDEX) {
+                         return Pair<Iterator, bool>(begin() + indices[slot], false);
+                     }
+                     return Pair<Iterator, bool>(append(slot, hashValue, value), true);
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 inline Pair<typename IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::Iterator, bool> IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::insert(ValueType && value) {
+                     SizeType hashValue = hashKey(value.first);
+                     SizeType slot = findSlot(value.first, hashValue);
+                     if (indices[slot] != EMPTY_INDEX) {
+                         return Pair<Iterator, bool>(begin() + indices[slot], false);
+                     }
+                     return Pair<Iterator, bool>(append(slot, hashValue, std::move(value)), true);
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 template <class InputIterator>
+                 inline void IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::insert(InputIterator begin, InputIterator end) {
+                     if constexpr (std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<InputIterator>::iterator_category>) {
+                         reserve(getSize() + static_cast <SizeType> (std::distance(begin, end)));
+                     }
+                     for ( ; begin != end; ++begin) {
+                         insert(*begin);
+                     }
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 inline void IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::insert(std::initializer_list<ValueType> list) {
+                     insert(list.begin(), list.end());
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 template <class ... Args>
+                 inline Pair<typename IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::Iterator, bool> IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::emplace(Args && ... args) {
+                     return insert(ValueType(std::forward<Args>(args)...));
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 template <class ... Args>
+                 inline Pair<typename IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::Iterator, bool> IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::tryEmplace(KeyType const& k, Args && ... args) {
+                     SizeType hashValue = hashKey(k);
+                     SizeType slot = findSlot(k, hashValue);
+                     if (indices[slot] != EMPTY_INDEX) {
+                         return Pair<Iterator, bool>(begin() + indices[slot], false);
+                     }
+                     return Pair<Iterator, bool>(append(slot, hashValue, std::piecewise_construct, std::forward_as_tuple(k), std::forward_as_tuple(std::forward<Args>(args)...)), true);
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 template <class M>
+                 inline Pair<typename IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::Iterator, bool> IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::insertOrAssign(KeyType const& k, M && value) {
+                     Pair<Iterator, bool> res = tryEmplace(k, std::forward<M>(value));
+                     if (!res.second) {
+                         res.first->second = std::forward<M>(value);
+                     }
+                     return res;
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 inline void IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::clear() {
+                     entries.clear();
+                     hashes.clear();
+                     for (IndexType& index : indices) {
+                         index = EMPTY_INDEX;
+                     }
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 inline void IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::swap(IndexMap& map) {
+                     using std::swap;
+                     swap(static_cast <Hash&> (*this), static_cast <Hash&> (map));
+                     swap(static_cast <KeyEqual&> (*this), static_cast <KeyEqual&> (map));
+                     entries.swap(map.entries);
+                     hashes.swap(map.hashes);
+                     indices.swap(map.indices);
+                     swap(mask, map.mask);
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 inline void IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::reserve(SizeType count) {
+                     if (count > getMaxSize()) {
+                         throw std::length_error("NRE::Core::IndexMap : Reserving more elements than an entry offset can address.");
+                     }
+                     SizeType capacity = capacityFor(count);
+                     if (capacity > indices.getSize()) {
+                         rebuildIndex(capacity);
+                     }
+                     entries.reserve(count);
+                     hashes.reserve(count);
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 inline typename IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::Iterator IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::find(KeyType const& k) {
+                     IndexType index = indices[findSlot(k, hashKey(k))];
+                     return (index == EMPTY_INDEX) ? (end()) : (begin() + index);
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 inline typename IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::ConstIterator IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::find(KeyType const& k) const {
+                     IndexType index = indices[findSlot(k, hashKey(k))];
+                     return (index == EMPTY_INDEX) ? (end()) : (begin() + index);
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 inline typename IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::Iterator IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::erase(ConstIterator pos) {
+                     SizeType index = static_cast <SizeType> (pos - cbegin());
+                     swapErase(index);
+                     return begin() + index;
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 inline typename IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::SizeType IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::erase(KeyType const& k) {
+                     SizeType slot = findSlot(k, hashKey(k));
+                     if (indices[slot] == EMPTY_INDEX) {
+                         return 0;
+                     }
+                     swapErase(indices[slot]);
+                     return 1;
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 inline typename IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::SizeType IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::shiftErase(KeyType const& k) {
+                     SizeType slot = findSlot(k, hashKey(k));
+                     IndexType index = indices[slot];
+                     if (index == EMPTY_INDEX) {
+                         return 0;
+                     }
+                     eraseSlot(slot);
+                     for (SizeType i = index; i + 1 < getSize(); i++) {
+                         entries[i] = std::move(entries[i + 1]);
+                         hashes[i] = hashes[i + 1];
+                     }
+                     entries.popBack();
+                     hashes.popBack();
+                     for (IndexType& other : indices) {
+                         if (other != EMPTY_INDEX && other > index) {
+                             other--;
+                         }
+                     }
+                     return 1;
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 inline Hash IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::getHash() const {
+                     return static_cast <Hash const&> (*this);
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 inline KeyEqual IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::getKeyEqual() const {
+                     return static_cast <KeyEqual const&> (*this);
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 inline IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>& IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::operator =(IndexMap && map) {
+                     if (this != &map) {
+                         swap(map);
+                     }
+                     return *this;
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 inline typename IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::MappedType& IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::operator [](KeyType const& k) {
+                     return tryEmplace(k).first->second;
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 inline bool IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::operator ==(IndexMap const& map) const {
+                     if (getSize() != map.getSize()) {
+                         return false;
+                     }
+                     for (ConstReference entry : entries) {
+                         ConstIterator it = map.find(entry.first);
+                         if (it == map.end() || !(it->second == entry.second)) {
+                             return false;
+                         }
+                     }
+                     return true;
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 inline bool IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::operator !=(IndexMap const& map) const {
+                     return !(*this == map);
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 inline String IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::toString() const {
+                     String res;
+                     toString(res);
+                     return res;
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 inline void IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::toString(String& out) const {
+                     out.reserve(out.getSize() + estimateStringSize());
+                     StringSink sink(out);
+                     writeTo(sink);
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 template <class S>
+                 inline void IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::writeTo(S& sink) const {
+                     sink.write("{", 1);
+                     if (!isEmpty()) {
+                         ConstIterator first = begin();
+                         Core::format(sink, *first);
+                         ++first;
+                         while (first != end()) {
+                             sink.write(", ", 2);
+                             Core::format(sink, *first);
+                             ++first;
+                         }
+                     }
+                     sink.write("}", 1);
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 inline std::size_t IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::estimateStringSize() const {
+                     std::size_t size = (isEmpty()) ? (2) : (2 * getSize());
+                     for (ConstReference entry : entries) {
+                         size += Core::estimateStringSize(entry);
+                     }
+                     return size;
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 inline typename IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::SizeType IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::hashKey(KeyType const& k) const {
+                     return Mix::mix(Hash::operator ()(k));
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 inline typename IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::SizeType IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::findSlot(KeyType const& k, SizeType hashValue) const {
+                     SizeType slot = hashValue & mask;
+                     while (indices[slot] != EMPTY_INDEX) {
+                         IndexType index = indices[slot];
+                         if (hashes[index] == hashValue && KeyEqual::operator ()(entries[index].first, k)) {
+                             return slot;
+                         }
+                         slot = (slot + 1) & mask;
+                     }
+                     return slot;
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 inline typename IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::SizeType IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::findSlotOf(SizeType index) const {
+                     SizeType slot = hashes[index] & mask;
+                     while (indices[slot] != index) {
+                         slot = (slot + 1) & mask;
+                     }
+                     return slot;
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 template <class ... Args>
+                 inline typename IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::Iterator IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::append(SizeType slot, SizeType hashValue, Args && ... args) {
+                     if (getSize() >= getMaxSize()) {
+                         throw std::length_error("NRE::Core::IndexMap : Inserting more elements than an entry offset can address.");
+                     }
+                     if (growIfNeeded()) {
+                         slot = hashValue & mask;
+                         while (indices[slot] != EMPTY_INDEX) {
+                             slot = (slot + 1) & mask;
+                         }
+                     }
+                     hashes.pushBack(hashValue);
+                     try {
+                         entries.emplaceBack(std::forward<Args>(args)...);
+                     } catch (...) {
+                         hashes.popBack();
+                         throw;
+                     }
+                     indices[slot] = static_cast <IndexType> (getSize() - 1);
+                     return end() - 1;
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 inline void IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::eraseSlot(SizeType slot) {
+                     SizeType hole = slot;
+                     SizeType current = (hole + 1) & mask;
+                     while (indices[current] != EMPTY_INDEX) {
+                         SizeType home = hashes[indices[current]] & mask;
+                         if (((current - home) & mask) >= ((current - hole) & mask)) {
+                             indices[hole] = indices[current];
+                             hole = current;
+                         }
+                         current = (current + 1) & mask;
+                     }
+                     indices[hole] = EMPTY_INDEX;
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 inline void IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::swapErase(SizeType index) {
+                     eraseSlot(findSlotOf(index));
+                     SizeType last = getSize() - 1;
+                     if (index != last) {
+                         indices[findSlotOf(last)] = static_cast <IndexType> (index);
+                         entries[index] = std::move(entries[last]);
+                         hashes[index] = hashes[last];
+                     }
+                     entries.popBack();
+                     hashes.popBack();
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 inline void IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::rebuildIndex(SizeType capacity) {
+                     Detail::Vector<IndexType, typename Allocator::template Rebind<IndexType>> rebuilt(capacity, EMPTY_INDEX, indices.getAllocator());
+                     mask = capacity - 1;
+                     for (SizeType i = 0; i < hashes.getSize(); i++) {
+                         SizeType slot = hashes[i] & mask;
+                         while (rebuilt[slot] != EMPTY_INDEX) {
+                             slot = (slot + 1) & mask;
+                         }
+                         rebuilt[slot] = static_cast <IndexType> (i);
+                     }
+                     indices = std::move(rebuilt);
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 inline bool IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::growIfNeeded() {
+                     SizeType capacity = capacityFor(getSize() + 1);
+                     if (capacity > indices.getSize()) {
+                         rebuildIndex(capacity);
+                         return true;
+                     }
+                     return false;
+                 }
+
+                 template <class Key, class T, class Allocator, class Hash, class KeyEqual, class Mix>
+                 inline typename IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::SizeType IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>::capacityFor(SizeType count) {
+                     SizeType capacity = MIN_INDEX_CAPACITY;
+                     while (count * 4 > capacity * 3) {
+                         capacity <<= 1;
+                     }
+                     return capacity;
+                 }
+
+             }
+         }
+     }
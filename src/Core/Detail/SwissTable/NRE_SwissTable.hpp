@@ -0,0 +1,1005 @@
+
+    /**
+     * @file NRE_SwissTable.hpp
+     * @brief Declaration of Core's API's Object : SwissTable
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+    #pragma once
+
+    #include <bit>
+    #include <cstdint>
+    #include <cstring>
+    #include <climits>
+    #include <new>
+    #include <tuple>
+    #include <cmath>
+    #include <limits>
+    #include <algorithm>
+
+    #if defined(__SSE2__)
+        #include <emmintrin.h>
+    #endif
+
+    #include "../../String/NRE_String.hpp"
+    #include "../../Pair/NRE_Pair.hpp"
+    #include "../../Interfaces/Stringable/NRE_Stringable.hpp"
+    #include "../../Interfaces/Iterator/NRE_IteratorBase.hpp"
+    #include "../../Traits/NRE_TypeTraits.hpp"
+    #include "../../Hash/NRE_HashedKey.hpp"
+    #include "../../Hash/NRE_HashMix.hpp"
+
+    #include <Memory/Traits/NRE_MemoryTraits.hpp>
+
+    /**
+    * @namespace NRE
+    * @brief The NearlyRealEngine's global namespace
+    */
+    namespace NRE {
+        /**
+         * @namespace Core
+         * @brief Core's API
+         */
+        namespace Core {
+
+            namespace Detail {
+
+                namespace SwissTableInner {
+                    /** A control byte : a 7 bits hash fragment for a full slot, or one of the special markers */
+                    using ControlType = std::int8_t;
+
+                    constexpr ControlType EMPTY     = -128; /**< Mark a never used slot, stop the probing */
+                    constexpr ControlType DELETED   = -2;   /**< Mark an erased slot, the probing continue after it */
+                    constexpr ControlType SENTINEL  = -1;   /**< Mark the end of the control bytes, stop the iteration */
+
+                    /**
+                     * @class Group
+                     * @brief A group of control bytes matched at once, using SSE2 if available
+                     */
+                    class Group {
+                        public :    // Traits
+                            /** A bit mask, bit i is set if the i-th control byte of the group matched */
+                            using MaskType = std::uint32_t;
+
+                        private :   // Fields
+                            #if defined(__SSE2__)
+                                __m128i ctrl;               /**< The loaded control bytes */
+                            #else
+                                ControlType ctrl[16];       /**< The loaded control bytes */
+                            #endif
+
+                        public :    // Methods
+                            //## Constructor ##//
+                                /**
+                                 * Load a group of control bytes, no alignment needed
+                                 * @param pos the first control byte
+                                 */
+                                explicit Group(const ControlType* pos);
+
+                            //## Methods ##//
+                                /**
+                                 * Match the control bytes equal to the given hash fragment
+                                 * @param h2 the hash fragment
+                                 * @return   the matching bit mask
+                                 */
+                                MaskType match(ControlType h2) const;
+                                /**
+                                 * @return the bit mask of empty slots
+                                 */
+                                MaskType matchEmpty() const;
+                                /**
+                                 * @return the bit mask of empty or deleted slots
+                                 */
+                                MaskType matchEmptyOrDeleted() const;
+
+                        public :    // Static
+                            static constexpr std::size_t WIDTH = 16;  /**< The number of control bytes in a group */
+                    };
+
+                    /**
+                     * @class ForwardIterator
+                     * @brief Swiss table forward iterator, walk the control bytes to skip non full slots
+                     */
+                    template <class T, class Category, class Slot>
+                    class ForwardIterator : public IteratorBase<ForwardIterator<T, Category, Slot>, T, Category> {
+                        public :    // Traits
+                            /** Inherited iterator traits */
+                            using Traits = IteratorBase<ForwardIterator<T, Category, Slot>, T, Category>;
+                            /** The iterated object */
+                            using ValueType         = typename Traits::ValueType;
+                            /** The pointer on iterated object */
+                            using Pointer           = typename Traits::Pointer;
+                            /** The reference on iterated object */
+                            using Reference         = typename Traits::Reference;
+                            /** The iterator difference type */
+                            using DifferenceType    = typename Traits::DifferenceType;
+                            /** STL compatibility */
+                            using value_type        = ValueType;
+                            /** STL compatibility */
+                            using pointer           = Pointer;
+                            /** STL compatibility */
+                            using reference         = Reference;
+                            /** STL compatibility */
+                            using difference_type   = DifferenceType;
+                            /** STL compatibility */
+                            using iterator_category = typename Traits::iterator_category;
+
+                        private :   // Fields
+                            const ControlType* ctrl;    /**< The current control byte */
+                            Slot* slot;                 /**< The current slot */
+
+                        public :    // Methods
+                            //## Constructor ##//
+                                /**
+                                 * Default constructor with nullptr slot
+                                 */
+                                ForwardIterator() = default;
+                                /**
+                                 * Construct the iterator on the given slot
+                                 * @param c the slot control byte
+                                 * @param s the iterator slot
+                                 */
+                                ForwardIterator(const ControlType* c, Slot* s);
+                                /**
+                                 * Construct the iterator on the given slot
+                                 * @param c the slot control byte
+                                 * @param s the iterator slot
+                                 */
+                                ForwardIterator(const ControlType* c, const Slot* s);
+
+                            //## Getter ##//
+                                /**
+                                 * @return the current control byte
+                                 */
+                                const ControlType* getControl() const;
+                                /**
+                                 * @return the current slot
+                                 */
+                                Slot* getSlot() const;
+
+                            //## Methods ##//
+                                /**
+                                 * @return a reference on the iterated data
+                                 */
+                                Reference dereference() const;
+                                /**
+                                 * Increment the iterator position to the next full slot
+                                 */
+                                void increment();
+                                /**
+                                 * Test if the given iterator point to the same position
+                                 * @param it the other iterator
+                                 * @return   the test's result
+                                 */
+                                bool equal(ForwardIterator const& it) const;
+                    };
+
+                    /**
+                     * @class LocalForwardIterator
+                     * @brief Swiss table local forward iterator, a bucket is a single slot
+                     */
+                    template <class T, class Category, class Slot>
+                    class LocalForwardIterator : public IteratorBase<LocalForwardIterator<T, Category, Slot>, T, Category> {
+                        public :    // Traits
+                            /** Inherited iterator traits */
+                            using Traits = IteratorBase<LocalForwardIterator<T, Category, Slot>, T, Category>;
+                            /** The iterated object */
+                            using ValueType         = typename Traits::ValueType;
+                            /** The pointer on iterated object */
+                            using Pointer           = typename Traits::Pointer;
+                            /** The reference on iterated object */
+                            using Reference         = typename Traits::Reference;
+                            /** The iterator difference type */
+                            using DifferenceType    = typename Traits::DifferenceType;
+                            /** STL compatibility */
+                            using value_type        = ValueType;
+                            /** STL compatibility */
+                            using pointer           = Pointer;
+                            /** STL compatibility */
+                            using reference         = Reference;
+                            /** STL compatibility */
+                            using difference_type   = DifferenceType;
+                            /** STL compatibility */
+                            using iterator_category = typename Traits::iterator_category;
+
+                        private :   // Fields
+                            Slot* current;  /**< The current slot */
+
+                        public :    // Methods
+                            //## Constructor ##//
+                                /**
+                                 * Default constructor with nullptr slot
+                                 */
+                                LocalForwardIterator() = default;
+                                /**
+                                 * Construct the iterator on the given slot
+                                 * @param s the iterator slot
+                                 */
+                                LocalForwardIterator(Slot* s);
+                                /**
+                                 * Construct the iterator on the given slot
+                                 * @param s the iterator slot
+                                 */
+                                LocalForwardIterator(const Slot* s);
+
+                            //## Methods ##//
+                                /**
+                                 * @return a reference on the iterated data
+                                 */
+                                Reference dereference() const;
+                                /**
+                                 * Increment the iterator position by one
+                                 */
+                                void increment();
+                                /**
+                                 * Test if the given iterator point to the same position
+                                 * @param it the other iterator
+                                 * @return   the test's result
+                                 */
+                                bool equal(LocalForwardIterator const& it) const;
+                    };
+
+                    /** An empty table control bytes, allow an empty table to not allocate anything */
+                    alignas(16) inline constexpr ControlType EMPTY_GROUP[Group::WIDTH] = {SENTINEL, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY,
+                                                                                             EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY};
+                }
+
+                /**
+                 * @class SwissTable
+                 * @brief An open addressing hash table keeping a separate control byte per slot, probing 16 slots at once on 7 bits hash fragments
+                 * Same interface as HashTable, used as an alternative UnorderedMap backend, erased slots become tombstones only if a probe sequence may have crossed them
+                 * The StoreHash parameter is ignored, the control bytes always keep a hash fragment
+                 */
+                template <class Key, class T, class Allocator, bool StoreHash = false, class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key>, class Mix = DefaultHashMix<Key, Hash>>
+                class SwissTable : public Stringable<SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>>, private Hash, private KeyEqual {
+                    static_assert(Memory::IsAllocatorV<Allocator>);                                /**< Check if the given AllocatorType inherit from NRE::Memory::AllocatorTraits */
+                    static_assert(std::is_same_v<Pair<Key, T>, typename Allocator::ValueType>);    /**< Make sure the allocator is set for the container inner type */
+
+                    public :    // Traits
+                        /** The table key type */
+                        using KeyType               = Key;
+                        /** The table mapped type */
+                        using MappedType            = T;
+                        /** The container's allocated type */
+                        using ValueType             = Pair<KeyType, MappedType>;
+                        /** The container's internal allocated type */
+                        using ContainerType         = std::aligned_storage_t<sizeof(ValueType), alignof(ValueType)>;
+                        /** The container's allocator */
+                        using AllocatorType         = typename Allocator::template Rebind<ContainerType>;
+                        /** The object's size type */
+                        using SizeType              = std::size_t;
+                        /** The object's difference type */
+                        using DifferenceType        = std::ptrdiff_t;
+                        /** The allocated type reference */
+                        using Reference             = ValueType&;
+                        /** The allocated type const reference */
+                        using ConstReference        = ValueType const&;
+                        /** The allocated type pointer */
+                        using Pointer               = ValueType*;
+                        /** The allocated type const pointer */
+                        using ConstPointer          = const ValueType*;
+                        /** Mutable forward access iterator */
+                        using Iterator              = SwissTableInner::ForwardIterator<ValueType, InOutForwardIterator, ContainerType>;
+                        /** Immuable forward access iterator */
+                        using ConstIterator         = SwissTableInner::ForwardIterator<ValueType, Core::ForwardIterator, ContainerType>;
+                        /** Mutable local forward access iterator */
+                        using LocalIterator         = SwissTableInner::LocalForwardIterator<ValueType, InOutForwardIterator, ContainerType>;
+                        /** Immuable local forward access iterator */
+                        using ConstLocalIterator    = SwissTableInner::LocalForwardIterator<ValueType, Core::ForwardIterator, ContainerType>;
+                        /** STL compatibility */
+                        using value_type            = ValueType;
+                        /** STL compatibility */
+                        using allocator_type        = AllocatorType;
+                        /** STL compatibility */
+                        using size_type             = SizeType;
+                        /** STL compatibility */
+                        using difference_type       = DifferenceType;
+                        /** STL compatibility */
+                        using reference             = Reference;
+                        /** STL compatibility */
+                        using const_reference       = ConstReference;
+                        /** STL compatibility */
+                        using pointer               = Pointer;
+                        /** STL compatibility */
+                        using const_pointer         = ConstPointer;
+                        /** STL compatibility */
+                        using iterator              = Iterator;
+                        /** STL compatibility */
+                        using const_iterator        = ConstIterator;
+                        /** STL compatibility */
+                        using local_iterator        = LocalIterator;
+                        /** STL compatibility */
+                        using const_local_iterator  = ConstLocalIterator;
+
+                    private :   // Traits
+                        /** Shortcut to control byte */
+                        using ControlType           = SwissTableInner::ControlType;
+                        /** Shortcut to control group */
+                        using Group                 = SwissTableInner::Group;
+                        /** The control bytes allocator */
+                        using ControlAllocatorType  = typename Allocator::template Rebind<ControlType>;
+
+                    private :    // Fields
+                        ControlType* ctrl;          /**< The control bytes, followed by the sentinel and a copy of the first group */
+                        ContainerType* slots;       /**< The table slots */
+                        SizeType capacity;          /**< The number of slots, 0 or a power of two minus one */
+                        SizeType nbElements;        /**< The number of element in the table */
+                        SizeType nbDeleted;         /**< The number of tombstones in the table */
+                        float maxLoadFactor;        /**< The maximum load factor, tombstones included, before rehash and grow */
+                        AllocatorType allocator;    /**< The slots allocator */
+
+                    public :     // Methods
+                        //## Constructor ##//
+                            /**
+                             * Construct an empty table with a number of bucket
+                             * @param bucketCount the base bucket count
+                             * @param hasher      the hash function used in the table
+                             * @param equal       the equal function used in the table
+                             * @param alloc       the table's memory allocator
+                             */
+                            SwissTable(SizeType bucketCount = DEFAULT_BUCKET_COUNT, Hash const& hasher = Hash(), KeyEqual const& equal = KeyEqual(), Allocator const& alloc = Allocator());
+                            /**
+                             * Construct a table with a number of bucket and filled with elements in the given range
+                             * @param begin       the begin iterator
+                             * @param end         the end iterator
+                             * @param bucketCount the base bucket count
+                             * @param hasher      the hash function used in the table
+                             * @param equal       the equal function used in the table
+                             * @param alloc       the table's memory allocator
+                             */
+                            template <class InputIterator>
+                            SwissTable(InputIterator begin, InputIterator end, SizeType bucketCount = DEFAULT_BUCKET_COUNT, Hash const& hasher = Hash(), KeyEqual const& equal = KeyEqual(), Allocator const& alloc = Allocator());
+                            /**
+                             * Construct a table with a number of bucket and filled with elements in the given list
+                             * @param list        the list to fill the table with
+                             * @param bucketCount the base bucket count
+                             * @param hasher      the hash function used in the table
+                             * @param equal       the equal function used in the table
+                             * @param alloc       the table's memory allocator
+                             */
+                            SwissTable(std::initializer_list<ValueType> list, SizeType bucketCount = DEFAULT_BUCKET_COUNT, Hash const& hasher = Hash(), KeyEqual const& equal = KeyEqual(), Allocator const& alloc = Allocator());
+
+                        //## Copy Constructor ##//
+                            /**
+                             * Copy table into this
+                             * @param table the table to copy
+                             */
+                            SwissTable(SwissTable const& table);
+                            /**
+                             * Copy table into this
+                             * @param table the table to copy
+                             * @param alloc the table's memory allocator
+                             */
+                            SwissTable(SwissTable const& table, Allocator const& alloc);
+
+                        //## Move Constructor ##//
+                            /**
+                             * Move table into this
+                             * @param table the table to move
+                             */
+                            SwissTable(SwissTable && table);
+                            /**
+                             * Move table into this
+                             * @param table the table to move
+                             * @param alloc the table's memory allocator
+                             */
+                            SwissTable(SwissTable && table, Allocator const& alloc);
+
+                        //## Deconstructor ##//
+                            /**
+                             * SwissTable Deconstructor
+                             */
+                            ~SwissTable();
+
+                        //## Getter ##//
+                            /**
+                             * Access a particular element with bound checking
+                             * @param  k the element key
+                             * @return   the corresponding element
+                             */
+                            MappedType& get(KeyType const& k);
+                            /**
+                             * Access a particular element with bound checking
+                             * @param  k the element key
+                             * @return   the corresponding element
+                             */
+                            MappedType const& get(KeyType const& k) const;
+                            /**
+                             * Access a particular element with bound checking, with any key comparable to KeyType when the hash and equal functions are transparent
+                             * @param  k the element key
+                             * @return   the corresponding element
+                             */
+                            template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                            MappedType& get(K const& k);
+                            /**
+                             * Access a particular element with bound checking, with any key comparable to KeyType when the hash and equal functions are transparent
+                             * @param  k the element key
+                             * @return   the corresponding element
+                             */
+                            template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                            MappedType const& get(K const& k) const;
+                            /**
+                             * @return the number of slots in the table
+                             */
+                            SizeType getBucketCount() const;
+                            /**
+                             * @return the maximum number of slots in the table
+                             */
+                            constexpr SizeType getMaxBucketCount() const;
+                            /**
+                             * @return the number of elements in the table
+                             */
+                            SizeType getSize() const;
+                            /**
+                             * @return the maximum load factor
+                             */
+                            float getMaxLoadFactor() const;
+                            /**
+                             * @return the current load factor
+                             */
+                            float getLoadFactor() const;
+                            /**
+                             * @return the maximum table size
+                             */
+                            constexpr SizeType getMaxSize() const;
+                            /**
+                             * @return the table's memory allocator
+                             */
+                            Allocator getAllocator() const;
+                            /**
+                             * @return if the table is empty
+                             */
+                            bool isEmpty() const;
+                            /**
+                             * Find the number of element with the given key
+                             * @param  k the key to search
+                             * @return   the number of corresponding elements
+                             */
+                            SizeType getCount(KeyType const& k) const;
+                            /**
+                             * Find the number of element with the given key, using its precomputed hash
+                             * @param  k         the key to search
+                             * @param  hashValue the key hash, computed with the table hash function
+                             * @return           the number of corresponding elements
+                             */
+                            SizeType getCount(KeyType const& k, SizeType hashValue) const;
+                            /**
+                             * Find the number of element with the given key, using its precomputed hash
+                             * @param  k the key to search with its hash
+                             * @return   the number of corresponding elements
+                             */
+                            SizeType getCount(HashedKey<KeyType> const& k) const;
+                            /**
+                             * Find the number of element with the given key, with any key comparable to KeyType when the hash and equal functions are transparent
+                             * @param  k the key to search
+                             * @return   the number of corresponding elements
+                             */
+                            template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                            SizeType getCount(K const& k) const;
+                            /**
+                             * Get the slot where the probing of the given key start
+                             * @param  k the key to search
+                             * @return   the corresponding slot
+                             */
+                            SizeType getBucket(KeyType const& k) const;
+                            /**
+                             * @return the number of bytes used by the table, its buckets included
+                             */
+                            SizeType getMemoryUsage() const;
+
+                        //## Setter ##//
+                            /**
+                             * Set the new max load factor, must be between 0.0 and 1.0
+                             * @param factor the new factor
+                             */
+                            void setMaxLoadFactor(float factor);
+
+                        //## Iterator Access ##//
+                            /**
+                             * @return an iterator on the first element
+                             */
+                            Iterator begin();
+                            /**
+                             * @return a const iterator on the first element
+                             */
+                            ConstIterator begin() const;
+                            /**
+                             * @return a const iterator on the first element
+                             */
+                            ConstIterator cbegin() const;
+                            /**
+                             * @return an iterator on the end of the container
+                             */
+                            Iterator end();
+                            /**
+                             * @return a const iterator on the end of the container
+                             */
+                            ConstIterator end() const;
+                            /**
+                             * @return a const iterator on the end of the container
+                             */
+                            ConstIterator cend() const;
+                            /**
+                             * Grab an iterator on a given slot
+                             * @param index the slot index
+                             * @return the iterator on the slot
+                             */
+                            LocalIterator begin(SizeType index);
+                            /**
+                             * Grab a const iterator on a given slot
+                             * @param index the slot index
+                             * @return the iterator on the slot
+                             */
+                            ConstLocalIterator begin(SizeType index) const;
+                            /**
+                             * Grab a const iterator on a given slot
+                             * @param index the slot index
+                             * @return the iterator on the slot
+                             */
+                            ConstLocalIterator cbegin(SizeType index) const;
+                            /**
+                             * Grab an iterator on a given slot end
+                             * @param index the slot index
+                             * @return the iterator on the slot end
+                             */
+                            LocalIterator end(SizeType index);
+                            /**
+                             * Grab a const iterator on a given slot end
+                             * @param index the slot index
+                             * @return the iterator on the slot end
+                             */
+                            ConstLocalIterator end(SizeType index) const;
+                            /**
+                             * Grab a const iterator on a given slot end
+                             * @param index the slot index
+                             * @return the iterator on the slot end
+                             */
+                            ConstLocalIterator cend(SizeType index) const;
+
+                        //## Methods ##//
+                            /**
+                             * Insert the given value in the table
+                             * @param value the pair with the key and the corresponding element
+                             * @return      a pair containing an iterator on the inserted element, and a boolean telling if the insertion has been done
+                             */
+                            Pair<Iterator, bool> insert(ValueType const& value);
+                            /**
+                             * Insert the given value in the table
+                             * @param value the pair with the key and the corresponding element
+                             * @return      a pair containing an iterator on the inserted element, and a boolean telling if the insertion has been done
+                             */
+                            template <class P>
+                            Pair<Iterator, bool> insert(P && value);
+                            /**
+                             * Insert elements in the given range
+                             * @param begin the begin iterator
+                             * @param end   the end iterator
+                             */
+                            template <class InputIterator>
+                            void insert(InputIterator begin, InputIterator end);
+                            /**
+                             * Insert elements in the given list
+                             * @param list the list of value to insert
+                             */
+                            void insert(std::initializer_list<ValueType> list);
+                            /**
+                             * Insert the given value in the table, the hint is ignored
+                             * @param  hint  the hint used for the search
+                             * @param  value the value to insert
+                             * @return       an iterator on the inserted element
+                             */
+                            Iterator insertHint(ConstIterator hint, ValueType const& value);
+                            /**
+                             * Insert the given value in the table, the hint is ignored
+                             * @param  hint  the hint used for the search
+                             * @param  value the value to insert
+                             * @return       an iterator on the inserted element
+                             */
+                            template <class P>
+                            Iterator insertHint(ConstIterator hint, P && value);
+                            /**
+                             * Emplace an element using the given elements
+                             * @param args the parameter pack used to create the inserted pair
+                             * @return     a pair containing an iterator on the inserted element, and a boolean telling if the insertion has been done
+                             */
+                            template <class ... Args>
+                            Pair<Iterator, bool> emplace(Args && ... args);
+                            /**
+                             * Emplace an element using the given elements, the hint is ignored
+                             * @param hint the iterator used as a hint to emplace the element
+                             * @param args the parameter pack used to create the inserted pair
+                             * @return     an iterator on the inserted element
+                             */
+                            template <class ... Args>
+                            Iterator emplaceHint(ConstIterator hint, Args && ... args);
+                            /**
+                             * Emplace an element using the given elements and the precomputed hash of its key
+                             * @param hashValue the hash of the inserted key, computed with the table hash function
+                             * @param args      the parameter pack used to create the inserted pair
+                             * @return          a pair containing an iterator on the inserted element, and a boolean telling if the insertion has been done
+                             */
+                            template <class ... Args>
+                            Pair<Iterator, bool> emplaceHashed(SizeType hashValue, Args && ... args);
+                            /**
+                             * Emplace an element if the key is not in the table, the mapped value is only constructed after a miss
+                             * @param k    the element key, left untouched if already in the table
+                             * @param args the parameter pack used to create the mapped value
+                             * @return     a pair containing an iterator on the inserted or found element, and a boolean telling if the insertion has been done
+                             */
+                            template <class ... Args>
+                            Pair<Iterator, bool> tryEmplace(KeyType const& k, Args && ... args);
+                            /**
+                             * Emplace an element if the key is not in the table, the mapped value is only constructed after a miss
+                             * @param k    the element key, left untouched if already in the table
+                             * @param args the parameter pack used to create the mapped value
+                             * @return     a pair containing an iterator on the inserted or found element, and a boolean telling if the insertion has been done
+                             */
+                            template <class ... Args>
+                            Pair<Iterator, bool> tryEmplace(KeyType && k, Args && ... args);
+                            /**
+                             * Insert the value with the given key, or assign it to the existing element
+                             * @param k     the element key
+                             * @param value the value to insert or assign
+                             * @return      a pair containing an iterator on the element, and a boolean telling if the insertion has been done
+                             */
+                            template <class M>
+                            Pair<Iterator, bool> insertOrAssign(KeyType const& k, M && value);
+                            /**
+                             * Insert the value with the given key, or assign it to the existing element
+                             * @param k     the element key
+                             * @param value the value to insert or assign
+                             * @return      a pair containing an iterator on the element, and a boolean telling if the insertion has been done
+                             */
+                            template <class M>
+                            Pair<Iterator, bool> insertOrAssign(KeyType && k, M && value);
+                            /**
+                             * Clear all slots, keep the capacity
+                             */
+                            void clear();
+                            /**
+                             * Swap the table with another table
+                             * @param table the other table
+                             */
+                            void swap(SwissTable& table);
+                            /**
+                             * Reserve enough slots to hold count elements without rehash
+                             * @param count the number of desired elements
+                             */
+                            void reserve(SizeType count);
+                            /**
+                             * Rehash the table with at least count slots, dropping every tombstone
+                             * @param count the number of desired slots
+                             */
+                            void rehash(SizeType count);
+                            /**
+                             * Find a range of iterator containing all elements with the given key, both end if not found
+                             * @param key the key to search
+                             * @return    a pair of iterator
+                             */
+                            Pair<Iterator, Iterator> equalRange(KeyType const& key);
+                            /**
+                             * Find a range of iterator containing all elements with the given key, both end if not found
+                             * @param key the key to search
+                             * @return    a pair of iterator
+                             */
+                            Pair<ConstIterator, ConstIterator> equalRange(KeyType const& key) const;
+                            /**
+                             * Find a range of iterator containing all elements with the given key, with any key comparable to KeyType when the hash and equal functions are transparent
+                             * @param key the key to search
+                             * @return    a pair of iterator
+                             */
+                            template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                            Pair<Iterator, Iterator> equalRange(K const& key);
+                            /**
+                             * Find a range of iterator containing all elements with the given key, with any key comparable to KeyType when the hash and equal functions are transparent
+                             * @param key the key to search
+                             * @return    a pair of iterator
+                             */
+                            template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                            Pair<ConstIterator, ConstIterator> equalRange(K const& key) const;
+                            /**
+                             * Find the element corresponding with the given key
+                             * @param  k the key to search
+                             * @return   the iterator pointing on the element, or end if not found
+                             */
+                            Iterator find(KeyType const& k);
+                            /**
+                             * Find the element corresponding with the given key
+                             * @param  k the key to search
+                             * @return   the iterator pointing on the element, or end if not found
+                             */
+                            ConstIterator find(KeyType const& k) const;
+                            /**
+                             * Find the element corresponding with the given key, using its precomputed hash
+                             * @param  k         the key to search
+                             * @param  hashValue the key hash, computed with the table hash function
+                             * @return           the iterator pointing on the element, or end if not found
+                             */
+                            Iterator find(KeyType const& k, SizeType hashValue);
+                            /**
+                             * Find the element corresponding with the given key, using its precomputed hash
+                             * @param  k         the key to search
+                             * @param  hashValue the key hash, computed with the table hash function
+                             * @return           the iterator pointing on the element, or end if not found
+                             */
+                            ConstIterator find(KeyType const& k, SizeType hashValue) const;
+                            /**
+                             * Find the element corresponding with the given key, using its precomputed hash
+                             * @param  k the key to search with its hash
+                             * @return   the iterator pointing on the element, or end if not found
+                             */
+                            Iterator find(HashedKey<KeyType> const& k);
+                            /**
+                             * Find the element corresponding with the given key, using its precomputed hash
+                             * @param  k the key to search with its hash
+                             * @return   the iterator pointing on the element, or end if not found
+                             */
+                            ConstIterator find(HashedKey<KeyType> const& k) const;
+                            /**
+                             * Find the element corresponding with the given key, with any key comparable to KeyType when the hash and equal functions are transparent
+                             * @param  k the key to search
+                             * @return   the iterator pointing on the element, or end if not found
+                             */
+                            template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                            Iterator find(K const& k);
+                            /**
+                             * Find the element corresponding with the given key, with any key comparable to KeyType when the hash and equal functions are transparent
+                             * @param  k the key to search
+                             * @return   the iterator pointing on the element, or end if not found
+                             */
+                            template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                            ConstIterator find(K const& k) const;
+                            /**
+                             * Erase the element pointed by the iterator
+                             * @param  pos the iterator on the erased element
+                             * @return      an iterator after the erased element
+                             */
+                            Iterator erase(Iterator pos);
+                            /**
+                             * Erase the element pointed by the iterator
+                             * @param  pos the iterator on the erased element
+                             * @return      an iterator after the erased element
+                             */
+                            Iterator erase(ConstIterator pos);
+                            /**
+                             * Erase the element in the given range
+                             * @param  begin the begin iterator for erasing
+                             * @param  end   the end iterator for erasing
+                             * @return       an iterator after the last erased element
+                             */
+                            Iterator erase(ConstIterator begin, ConstIterator end);
+                            /**
+                             * Erase all element with the given key
+                             * @param  k the key to search and erase
+                             * @return   the number of erased elements
+                             */
+                            SizeType erase(KeyType const& k);
+                            /**
+                             * Erase all element with the given key, using its precomputed hash
+                             * @param  k         the key to search and erase
+                             * @param  hashValue the key hash, computed with the table hash function
+                             * @return           the number of erased elements
+                             */
+                            SizeType erase(KeyType const& k, SizeType hashValue);
+                            /**
+                             * Erase all element with the given key, using its precomputed hash
+                             * @param  k the key to search and erase with its hash
+                             * @return   the number of erased elements
+                             */
+                            SizeType erase(HashedKey<KeyType> const& k);
+                            /**
+                             * Erase all element with the given key, with any key comparable to KeyType when the hash and equal functions are transparent
+                             * @param  k the key to search and erase
+                             * @return   the number of erased elements
+                             */
+                            template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                            SizeType erase(K const& k);
+                            /**
+                             * Find the elements corresponding with a range of keys, hashing and prefetching a whole batch before probing it to overlap the cache misses
+                             * @param keysBegin the begin iterator on the keys, must be a forward iterator
+                             * @param keysEnd   the end iterator on the keys
+                             * @param out       the output iterator receiving, for each key in order, an iterator on the element or end if not found
+                             */
+                            template <class ForwardIterator, class OutputIterator> requires Concept::ForwardIterator<ForwardIterator>
+                            void findBatch(ForwardIterator keysBegin, ForwardIterator keysEnd, OutputIterator out);
+                            /**
+                             * Find the elements corresponding with a range of keys, hashing and prefetching a whole batch before probing it to overlap the cache misses
+                             * @param keysBegin the begin iterator on the keys, must be a forward iterator
+                             * @param keysEnd   the end iterator on the keys
+                             * @param out       the output iterator receiving, for each key in order, an iterator on the element or end if not found
+                             */
+                            template <class ForwardIterator, class OutputIterator> requires Concept::ForwardIterator<ForwardIterator>
+                            void findBatch(ForwardIterator keysBegin, ForwardIterator keysEnd, OutputIterator out) const;
+                            /**
+                             * @return the hash function
+                             */
+                            Hash getHash() const;
+                            /**
+                             * @return the key equal function
+                             */
+                            KeyEqual getKeyEqual() const;
+
+                        //## Assignment Operator ##//
+                            /**
+                             * Copy table into this
+                             * @param table the table to copy into this
+                             * @return      the reference of himself
+                             */
+                            SwissTable& operator =(SwissTable const& table);
+                            /**
+                             * Move table into this
+                             * @param table the table to move into this
+                             * @return      the reference of himself
+                             */
+                            SwissTable& operator =(SwissTable && table);
+
+                        //## Access Operator ##//
+                            /**
+                             * Try to access the element designed by the given key, if not found insert a default one
+                             * @param  k the key used for access
+                             * @return   the found/inserted element
+                             */
+                            MappedType& operator[](KeyType const& k);
+                            /**
+                             * Try to access the element designed by the given key, if not found insert a default one
+                             * @param  k the key used for access
+                             * @return   the found/inserted element
+                             */
+                            MappedType& operator[](KeyType && k);
+
+                        //## Stream Operator ##//
+                            /**
+                             * Convert the object into a string representation
+                             * @return the converted object
+                             */
+                            [[nodiscard]] String toString() const;
+                            /**
+                             * Append the object string representation at the end of out, reserving its exact size first
+                             * @param out the string to append into
+                             */
+                            void toString(String& out) const;
+                            /**
+                             * @return the object string representation size, used to format nested objects in one allocation
+                             */
+                            std::size_t estimateStringSize() const;
+                            /**
+                             * Format the object straight into the given sink
+                             * @param sink the sink to write into
+                             */
+                            template <class S>
+                            void writeTo(S& sink) const;
+
+                    private :   // Methods
+                        /**
+                         * Compute the hash value from the given key
+                         * @param  k the key to hash
+                         * @return   the corresponding hash value
+                         */
+                        template <class K>
+                        SizeType hashKey(K const& k) const;
+                        /**
+                         * Compare two key and return if they are equals
+                         * @param  k1 the first key
+                         * @param  k2 the second key
+                         * @return    if both key are equals
+                         */
+                        template <class K>
+                        bool compareKey(KeyType const& k1, K const& k2) const;
+                        /**
+                         * @param  index the slot index
+                         * @return       the value stored in the slot, which must be full
+                         */
+                        ValueType& slotData(SizeType index) const;
+                        /**
+                         * Find the slot holding the given key
+                         * @param  k         the key to search
+                         * @param  hashValue the key finalized hash
+                         * @return           the slot index, or the capacity if not found
+                         */
+                        template <class K>
+                        SizeType findIndex(K const& k, SizeType hashValue) const;
+                        /**
+                         * Find the first empty or deleted slot in the probe sequence of the given hash
+                         * @param  hashValue the finalized hash
+                         * @return           the slot index
+                         */
+                        SizeType findFirstNonFull(SizeType hashValue) const;
+                        /**
+                         * Find a free slot for a new element with the given hash, grow or clean the table if needed
+                         * @param  hashValue the finalized hash of the inserted key
+                         * @return           the free slot index
+                         */
+                        SizeType prepareInsert(SizeType hashValue);
+                        /**
+                         * Construct an element in a free slot, then mark the slot as full
+                         * @param index     the free slot index
+                         * @param hashValue the finalized hash of the inserted key
+                         * @param args      the parameter pack used to create the inserted pair
+                         */
+                        template <class ... Args>
+                        void constructAt(SizeType index, SizeType hashValue, Args && ... args);
+                        /**
+                         * Emplace an element with its key hash if the key is not already in the table, building the pair only on a miss
+                         * @param hashValue the key hash, before finalization
+                         * @param k         the element key
+                         * @param args      the parameter pack used to create the mapped value
+                         * @return          a pair containing an iterator on the inserted or found element, and a boolean telling if the insertion has been done
+                         */
+                        template <class K, class ... Args>
+                        Pair<Iterator, bool> tryEmplaceHashed(SizeType hashValue, K && k, Args && ... args);
+                        /**
+                         * Insert a built value with its key hash if the key is not already in the table
+                         * @param hashValue the inserted key hash, before finalization
+                         * @param toInsert  the value to insert, moved only if inserted
+                         * @return          a pair containing an iterator on the inserted element, and a boolean telling if the insertion has been done
+                         */
+                        Pair<Iterator, bool> insertHashed(SizeType hashValue, ValueType& toInsert);
+                        /**
+                         * Destroy the element in the given slot, leave an empty slot if no probe sequence may have crossed it, a tombstone else
+                         * @param index the slot index
+                         */
+                        void eraseAt(SizeType index);
+                        /**
+                         * Set a control byte and its copy after the sentinel
+                         * @param index the slot index
+                         * @param value the new control byte
+                         */
+                        void setControl(SizeType index, ControlType value);
+                        /**
+                         * Move every element in a new slot array, dropping every tombstone
+                         * @param newCapacity the new capacity, 0 or a power of two minus one
+                         */
+                        void resize(SizeType newCapacity);
+                        /**
+                         * Destroy every element and release the arrays
+                         */
+                        void release();
+                        /**
+                         * @param  count the table capacity
+                         * @return       the number of elements and tombstones allowed before growing
+                         */
+                        SizeType getGrowthThreshold(SizeType count) const;
+                        /**
+                         * @param  index the slot index
+                         * @return       an iterator on the slot
+                         */
+                        Iterator iteratorAt(SizeType index) const;
+
+                    private :    // Static
+                        static constexpr float DEFAULT_MAX_LOAD_FACTOR  = 0.875f;     /**< The default max load factor before growing */
+                        static constexpr SizeType MIN_CAPACITY          = Group::WIDTH - 1;   /**< The minimum allocated capacity, a group must fit in the copied bytes */
+                        static constexpr SizeType FIND_BATCH_SIZE       = 16;                 /**< The number of keys hashed and prefetched ahead in a batched lookup */
+
+                        /**
+                         * @param  h the finalized hash
+                         * @return   the probing start part of the hash
+                         */
+                        static SizeType H1(SizeType h) {
+                            return h >> 7;
+                        }
+                        /**
+                         * @param  h the finalized hash
+                         * @return   the 7 bits fragment stored in the control bytes
+                         */
+                        static ControlType H2(SizeType h) {
+                            return static_cast <ControlType> (h & 0x7F);
+                        }
+                        /**
+                         * Round the given count up to a valid capacity
+                         * @param  count the desired number of slots
+                         * @return       the smallest power of two minus one greater or equal to count, at least MIN_CAPACITY
+                         */
+                        static SizeType normalizeCapacity(SizeType count) {
+                            return (count <= MIN_CAPACITY) ? (MIN_CAPACITY) : (std::bit_ceil(count + 1) - 1);
+                        }
+
+                    public :    // Static
+                        static const SizeType DEFAULT_BUCKET_COUNT = 0;              /**< The default bucket count */
+                };
+            }
+        }
+    }
+
+    #include "NRE_SwissTable.tpp"
@@ -0,0 +1,933 @@
+    /**
+     * @file NRE_SwissTable.tpp
+     * @brief Implementation of Core's API's Object : SwissTable
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+     namespace NRE {
+         namespace Core {
+             namespace Detail {
+                namespace SwissTableInner {
+
+                     inline Group::Group(const ControlType* pos) {
+                         #if defined(__SSE2__)
+                             ctrl = _mm_loadu_si128(reinterpret_cast <const __m128i*> (pos));
+                         #else
+                             std::memcpy(ctrl, pos, WIDTH);
+                         #endif
+                     }
+
+                     inline Group::MaskType Group::match(ControlType h2) const {
+                         #if defined(__SSE2__)
+                             return static_cast <MaskType> (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl)));
+                         #else
+                             MaskType res = 0;
+                             for (std::size_t i = 0; i < WIDTH; ++i) {
+                                 res |= static_cast <MaskType> (ctrl[i] == h2) << i;
+                             }
+                             return res;
+                         #endif
+                     }
+
+                     inline Group::MaskType Group::matchEmpty() const {
+                         return match(EMPTY);
+                     }
+
+                     inline Group::MaskType Group::matchEmptyOrDeleted() const {
+                         #if defined(__SSE2__)
+                             return static_cast <MaskType> (_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(SENTINEL), ctrl)));
+                         #else
+                             MaskType res = 0;
+                             for (std::size_t i = 0; i < WIDTH; ++i) {
+                                 res |= static_cast <MaskType> (ctrl[i] < SENTINEL) << i;
+                             }
+                             return res;
+                         #endif
+                     }
+
+                     template <class T, class Category, class Slot>
+                     inline ForwardIterator<T, Category, Slot>::ForwardIterator(const ControlType* c, Slot* s) : ctrl(c), slot(s) {
+                     }
+
+                     template <class T, class Category, class Slot>
+                     inline ForwardIterator<T, Category, Slot>::ForwardIterator(const ControlType* c, const Slot* s) : ctrl(c), slot(const_cast <Slot*> (s)) {
+                     }
+
+                     template <class T, class Category, class Slot>
+                     inline const ControlType* ForwardIterator<T, Category, Slot>::getControl() const {
+                         return ctrl;
+                     }
+
+                     template <class T, class Category, class Slot>
+                     inline Slot* ForwardIterator<T, Category, Slot>::getSlot() const {
+                         return slot;
+                     }
+
+                     template <class T, class Category, class Slot>
+                     inline typename ForwardIterator<T, Category, Slot>::Reference ForwardIterator<T, Category, Slot>::dereference() const {
+                         return *reinterpret_cast <T*> (slot);
+                     }
+
+                     template <class T, class Category, class Slot>
+                     inline void ForwardIterator<T, Category, Slot>::increment() {
+                         do {
+                             ++ctrl;
+                             ++slot;
+                         } while (*ctrl < SENTINEL);
+                     }
+
+                     template <class T, class Category, class Slot>
+                     inline bool ForwardIterator<T, Category, Slot>::equal(ForwardIterator const& it) const {
+                         return ctrl == it.ctrl;
+                     }
+
+                     template <class T, class Category, class Slot>
+                     inline LocalForwardIterator<T, Category, Slot>::LocalForwardIterator(Slot* s) : current(s) {
+                     }
+
+                     template <class T, class Category, class Slot>
+                     inline LocalForwardIterator<T, Category, Slot>::LocalForwardIterator(const Slot* s) : current(const_cast <Slot*> (s)) {
+                     }
+
+                     template <class T, class Category, class Slot>
+                     inline typename LocalForwardIterator<T, Category, Slot>::Reference LocalForwardIterator<T, Category, Slot>::dereference() const {
+                         return *reinterpret_cast <T*> (current);
+                     }
+
+                     template <class T, class Category, class Slot>
+                     inline void LocalForwardIterator<T, Category, Slot>::increment() {
+                         current = nullptr;
+                     }
+
+                     template <class T, class Category, class Slot>
+                     inline bool LocalForwardIterator<T, Category, Slot>::equal(LocalForwardIterator const& it) const {
+                         return current == it.current;
+                     }
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SwissTable(SizeType bucketCount, Hash const& hasher, KeyEqual const& equal, Allocator const& alloc) : Hash(hasher), KeyEqual(equal), ctrl(const_cast <ControlType*> (SwissTableInner::EMPTY_GROUP)), slots(nullptr), capacity(0), nbElements(0), nbDeleted(0), maxLoadFactor(DEFAULT_MAX_LOAD_FACTOR), allocator(alloc) {
+                     if (bucketCount > 0) {
+                         resize(normalizeCapacity(bucketCount));
+                     }
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class InputIterator>
+                 inline SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SwissTable(InputIterator begin, InputIterator end, SizeType bucketCount, Hash const& hasher, KeyEqual const& equal, Allocator const& alloc) : SwissTable(bucketCount, hasher, equal, alloc) {
+                     insert(begin, end);
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SwissTable(std::initializer_list<ValueType> list, SizeType bucketCount, Hash const& hasher, KeyEqual const& equal, Allocator const& alloc) : SwissTable(bucketCount, hasher, equal, alloc) {
+                     insert(list);
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SwissTable(SwissTable const& table) : SwissTable(table, table.getAllocator()) {
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SwissTable(SwissTable const& table, Allocator const& alloc) : Hash(table), KeyEqual(table), ctrl(const_cast <ControlType*> (SwissTableInner::EMPTY_GROUP)), slots(nullptr), capacity(0), nbElements(0), nbDeleted(0), maxLoadFactor(table.maxLoadFactor), allocator(alloc) {
+                     if (table.capacity > 0) {
+                         ctrl = ControlAllocatorType(allocator).allocate(table.capacity + Group::WIDTH);
+                         slots = allocator.allocate(table.capacity);
+                         capacity = table.capacity;
+                         std::memcpy(ctrl, table.ctrl, capacity + Group::WIDTH);
+                         for (SizeType i = 0; i < capacity; ++i) {
+                             if (ctrl[i] >= 0) {
+                                 ::new(static_cast <void*> (slots + i)) ValueType(table.slotData(i));
+                             }
+                         }
+                         nbElements = table.nbElements;
+                         nbDeleted = table.nbDeleted;
+                     }
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SwissTable(SwissTable && table) : SwissTable(std::move(table), table.getAllocator()) {
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SwissTable(SwissTable && table, Allocator const& alloc) : Hash(std::move(static_cast <Hash&> (table))), KeyEqual(std::move(static_cast <KeyEqual&> (table))), ctrl(table.ctrl), slots(table.slots), capacity(table.capacity), nbElements(table.nbElements), nbDeleted(table.nbDeleted), maxLoadFactor(table.maxLoadFactor), allocator(alloc) {
+                     table.ctrl = const_cast <ControlType*> (SwissTableInner::EMPTY_GROUP);
+                     table.slots = nullptr;
+                     table.capacity = 0;
+                     table.nbElements = 0;
+                     table.nbDeleted = 0;
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::~SwissTable() {
+                     release();
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::MappedType& SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::get(KeyType const& k) {
+                     auto it = find(k);
+                     if (it == end()) {
+                         throw std::out_of_range("Accessing non existing element in NRE::Core::SwissTable.");
+                     }
+                     return it->second;
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::MappedType const& SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::get(KeyType const& k) const {
+                     auto it = find(k);
+                     if (it == end()) {
+                         throw std::out_of_range("Accessing non existing element in NRE::Core::SwissTable.");
+                     }
+                     return it->second;
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                 inline typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::MappedType& SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::get(K const& k) {
+                     auto it = find(k);
+                     if (it == end()) {
+                         throw std::out_of_range("Accessing non existing element in NRE::Core::SwissTable.");
+                     }
+                     return it->second;
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                 inline typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::MappedType const& SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::get(K const& k) const {
+                     auto it = find(k);
+                     if (it == end()) {
+                         throw std::out_of_range("Accessing non existing element in NRE::Core::SwissTable.");
+                     }
+                     return it->second;
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::getBucketCount() const {
+                     return capacity;
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 constexpr typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::getMaxBucketCount() const {
+                     return std::numeric_limits<SizeType>::max() / sizeof(ContainerType);
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::getSize() const {
+                     return nbElements;
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline float SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::getMaxLoadFactor() const {
+                     return maxLoadFactor;
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline float SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::getLoadFactor() const {
+                     if (capacity == 0) {
+                         return 0.0f;
+                     }
+                     return static_cast <float> (getSize()) / static_cast <float> (getBucketCount());
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 constexpr typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::getMaxSize() const {
+                     return std::numeric_limits<SizeType>::max();
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline Allocator SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::getAllocator() const {
+                     return Allocator(allocator);
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline bool SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::isEmpty() const {
+                     return nbElements == 0;
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::getCount(KeyType const& k) const {
+                     return getCount(k, hashKey(k));
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::getCount(KeyType const& k, SizeType hashValue) const {
+                     if (find(k, hashValue) != end()) {
+                         return 1;
+                     } else {
+                         return 0;
+                     }
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::getCount(HashedKey<KeyType> const& k) const {
+                     return getCount(k.getKey(), k.getHash());
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                 inline typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::getCount(K const& k) const {
+                     if (find(k) != end()) {
+                         return 1;
+                     } else {
+                         return 0;
+                     }
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::getBucket(KeyType const& k) const {
+                     return H1(Mix::mix(hashKey(k))) & capacity;
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::getMemoryUsage() const {
+                     if (capacity == 0) {
+                         return sizeof(SwissTable);
+                     }
+                     return sizeof(SwissTable) + (capacity + Group::WIDTH) * sizeof(ControlType) + capacity * sizeof(ValueType);
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::setMaxLoadFactor(float factor) {
+                     if (factor <= 0.0f || factor > 1.0f) {
+                         throw std::out_of_range("NRE::Core::SwissTable max load factor must be between 0.0 and 1.0.");
+                     }
+                     maxLoadFactor = factor;
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::begin() {
+                     Iterator it(ctrl, slots);
+                     if (*ctrl < SwissTableInner::SENTINEL) {
+                         ++it;
+                     }
+                     return it;
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConstIterator SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::begin() const {
+                     ConstIterator it(ctrl, slots);
+                     if (*ctrl < SwissTableInner::SENTINEL) {
+                         ++it;
+                     }
+                     return it;
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConstIterator SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::cbegin() const {
+                     return begin();
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::end() {
+                     return Iterator(ctrl + capacity, slots + capacity);
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConstIterator SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::end() const {
+                     return ConstIterator(ctrl + capacity, slots + capacity);
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConstIterator SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::cend() const {
+                     return end();
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::LocalIterator SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::begin(SizeType index) {
+                     return (ctrl[index] >= 0) ? (LocalIterator(slots + index)) : (end(index));
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConstLocalIterator SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::begin(SizeType index) const {
+                     return (ctrl[index] >= 0) ? (ConstLocalIterator(slots + index)) : (end(index));
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConstLocalIterator SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::cbegin(SizeType index) const {
+                     return begin(index);
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::LocalIterator SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::end(SizeType) {
+                     return LocalIterator(static_cast <ContainerType*> (nullptr));
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConstLocalIterator SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::end(SizeType) const {
+                     return ConstLocalIterator(static_cast <ContainerType*> (nullptr));
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConstLocalIterator SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::cend(SizeType index) const {
+                     return end(index);
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline Pair<typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator, bool> SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::insert(ValueType const& value) {
+                     return emplace(value);
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class P>
+                 inline Pair<typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator, bool> SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::insert(P&& value) {
+                     return emplace(std::forward<P>(value));
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class InputIterator>
+                 inline void SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::insert(InputIterator begin, InputIterator end) {
+                     SizeType count = std::distance(begin, end);
+                     if (count > 0) {
+                         reserve(getSize() + count);
+                     }
+                     for (; begin != end; ++begin) {
+                         insert(*begin);
+                     }
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::insert(std::initializer_list<ValueType> list) {
+                     insert(list.begin(), list.end());
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::insertHint(ConstIterator, ValueType const& value) {
+                     return insert(value).first;
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class P>
+                 inline typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::insertHint(ConstIterator, P&& value) {
+                     return insert(std::forward<P>(value)).first;
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class ... Args>
+                 inline Pair<typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator, bool> SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::emplace(Args&& ... args) {
+                     ValueType toInsert(std::forward<Args>(args)...);
+                     return insertHashed(hashKey(toInsert.first), toInsert);
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class ... Args>
+                 inline typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::emplaceHint(ConstIterator, Args&& ... args) {
+                     return emplace(std::forward<Args>(args)...).first;
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class ... Args>
+                 inline Pair<typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator, bool> SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::emplaceHashed(SizeType hashValue, Args&& ... args) {
+                     ValueType toInsert(std::forward<Args>(args)...);
+                     return insertHashed(hashValue, toInsert);
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class ... Args>
+                 inline Pair<typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator, bool> SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::tryEmplace(KeyType const& k, Args&& ... args) {
+                     return tryEmplaceHashed(hashKey(k), k, std::forward<Args>(args)...);
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class ... Args>
+                 inline Pair<typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator, bool> SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::tryEmplace(KeyType&& k, Args&& ... args) {
+                     return tryEmplaceHashed(hashKey(k), std::move(k), std::forward<Args>(args)...);
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class M>
+                 inline Pair<typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator, bool> SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::insertOrAssign(KeyType const& k, M&& value) {
+                     Pair<Iterator, bool> res = tryEmplace(k, std::forward<M>(value));
+                     if (!res.second) {
+                         res.first->second = std::forward<M>(value);
+                     }
+                     return res;
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class M>
+                 inline Pair<typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator, bool> SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::insertOrAssign(KeyType&& k, M&& value) {
+                     Pair<Iterator, bool> res = tryEmplace(std::move(k), std::forward<M>(value));
+                     if (!res.second) {
+                         res.first->second = std::forward<M>(value);
+                     }
+                     return res;
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::clear() {
+                     if (capacity == 0) {
+                         return;
+                     }
+                     for (SizeType i = 0; i < capacity; ++i) {
+                         if (ctrl[i] >= 0) {
+                             slotData(i).~ValueType();
+                         }
+                     }
+                     std::memset(ctrl, static_cast <unsigned char> (SwissTableInner::EMPTY), capacity + Group::WIDTH);
+                     ctrl[capacity] = SwissTableInner::SENTINEL;
+                     nbElements = 0;
+                     nbDeleted = 0;
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::swap(SwissTable& table) {
+                     using std::swap;
+                     swap(static_cast <Hash&> (*this), static_cast <Hash&> (table));
+                     swap(static_cast <KeyEqual&> (*this), static_cast <KeyEqual&> (table));
+                     swap(ctrl, table.ctrl);
+                     swap(slots, table.slots);
+                     swap(capacity, table.capacity);
+                     swap(nbElements, table.nbElements);
+                     swap(nbDeleted, table.nbDeleted);
+                     swap(maxLoadFactor, table.maxLoadFactor);
+                     swap(allocator, table.allocator);
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::reserve(SizeType count) {
+                     if (count > getGrowthThreshold(capacity)) {
+                         rehash(static_cast <SizeType> (std::ceil(static_cast <float> (count) / getMaxLoadFactor())));
+                     }
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::rehash(SizeType count) {
+                     if (count == 0 && nbElements == 0) {
+                         release();
+                         return;
+                     }
+                     SizeType newCapacity = normalizeCapacity(count);
+                     while (getGrowthThreshold(newCapacity) < nbElements) {
+                         newCapacity = newCapacity * 2 + 1;
+                     }
+                     resize(newCapacity);
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline Pair<typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator, typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator> SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::equalRange(KeyType const& k) {
+                     Iterator it = find(k);
+                     return Pair<Iterator, Iterator>(it, (it == end()) ? (it) : (std::next(it)));
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline Pair<typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConstIterator, typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConstIterator> SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::equalRange(KeyType const& k) const {
+                     ConstIterator it = find(k);
+                     return Pair<ConstIterator, ConstIterator>(it, (it == end()) ? (it) : (std::next(it)));
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                 inline Pair<typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator, typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator> SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::equalRange(K const& k) {
+                     Iterator it = find(k);
+                     return Pair<Iterator, Iterator>(it, (it == end()) ? (it) : (std::next(it)));
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                 inline Pair<typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConstIterator, typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConstIterator> SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::equalRange(K const& k) const {
+                     ConstIterator it = find(k);
+                     return Pair<ConstIterator, ConstIterator>(it, (it == end()) ? (it) : (std::next(it)));
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::find(KeyType const& k) {
+                     return find(k, hashKey(k));
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConstIterator SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::find(KeyType const& k) const {
+                     return find(k, hashKey(k));
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::find(KeyType const& k, SizeType hashValue) {
+                     return iteratorAt(findIndex(k, Mix::mix(hashValue)));
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConstIterator SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::find(KeyType const& k, SizeType hashValue) const {
+                     SizeType index = findIndex(k, Mix::mix(hashValue));
+                     return ConstIterator(ctrl + index, slots + index);
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::find(HashedKey<KeyType> const& k) {
+                     return find(k.getKey(), k.getHash());
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConstIterator SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::find(HashedKey<KeyType> const& k) const {
+                     return find(k.getKey(), k.getHash());
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                 inline typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::find(K const& k) {
+                     return iteratorAt(findIndex(k, Mix::mix(hashKey(k))));
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                 inline typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConstIterator SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::find(K const& k) const {
+                     SizeType index = findIndex(k, Mix::mix(hashKey(k)));
+                     return ConstIterator(ctrl + index, slots + index);
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::erase(Iterator pos) {
+                     return erase(ConstIterator(pos.getControl(), pos.getSlot()));
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::erase(ConstIterator pos) {
+                     SizeType index = static_cast <SizeType> (pos.getControl() - ctrl);
+                     eraseAt(index);
+                     Iterator it = iteratorAt(index);
+                     return ++it;
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::erase(ConstIterator begin, ConstIterator end) {
+                     for (SizeType index = static_cast <SizeType> (begin.getControl() - ctrl); index < static_cast <SizeType> (end.getControl() - ctrl); ++index) {
+                         if (ctrl[index] >= 0) {
+                             eraseAt(index);
+                         }
+                     }
+                     return Iterator(end.getControl(), end.getSlot());
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::erase(KeyType const& k) {
+                     return erase(k, hashKey(k));
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::erase(KeyType const& k, SizeType hashValue) {
+                     SizeType index = findIndex(k, Mix::mix(hashValue));
+                     if (index != capacity) {
+                         eraseAt(index);
+                         return 1;
+                     } else {
+                         return 0;
+                     }
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::erase(HashedKey<KeyType> const& k) {
+                     return erase(k.getKey(), k.getHash());
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                 inline typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::erase(K const& k) {
+                     SizeType index = findIndex(k, Mix::mix(hashKey(k)));
+                     if (index != capacity) {
+                         eraseAt(index);
+                         return 1;
+                     } else {
+                         return 0;
+                     }
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class ForwardIterator, class OutputIterator> requires Concept::ForwardIterator<ForwardIterator>
+                 inline void SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::findBatch(ForwardIterator keysBegin, ForwardIterator keysEnd, OutputIterator out) {
+                     SizeType hashes[FIND_BATCH_SIZE];
+                     while (keysBegin != keysEnd) {
+                         ForwardIterator current = keysBegin;
+                         SizeType count = 0;
+                         for (; count < FIND_BATCH_SIZE && keysBegin != keysEnd; ++count, ++keysBegin) {
+                             hashes[count] = Mix::mix(hashKey(*keysBegin));
+                             Memory::prefetch(ctrl + (H1(hashes[count]) & capacity));
+                         }
+                         for (SizeType i = 0; i < count; ++i, ++current, ++out) {
+                             *out = iteratorAt(findIndex(*current, hashes[i]));
+                         }
+                     }
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class ForwardIterator, class OutputIterator> requires Concept::ForwardIterator<ForwardIterator>
+                 inline void SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::findBatch(ForwardIterator keysBegin, ForwardIterator keysEnd, OutputIterator out) const {
+                     SizeType hashes[FIND_BATCH_SIZE];
+                     while (keysBegin != keysEnd) {
+                         ForwardIterator current = keysBegin;
+                         SizeType count = 0;
+                         for (; count < FIND_BATCH_SIZE && keysBegin != keysEnd; ++count, ++keysBegin) {
+                             hashes[count] = Mix::mix(hashKey(*keysBegin));
+                             Memory::prefetch(ctrl + (H1(hashes[count]) & capacity));
+                         }
+                         for (SizeType i = 0; i < count; ++i, ++current, ++out) {
+                             SizeType index = findIndex(*current, hashes[i]);
+                             *out = ConstIterator(ctrl + index, slots + index);
+                         }
+                     }
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline Hash SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::getHash() const {
+                     return static_cast <Hash const&> (*this);
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline KeyEqual SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::getKeyEqual() const {
+                     return static_cast <KeyEqual const&> (*this);
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>& SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::operator =(SwissTable const& table) {
+                     if (this != &table) {
+                         SwissTable copy(table);
+                         swap(copy);
+                     }
+                     return *this;
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>& SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::operator =(SwissTable && table) {
+                     if (this != &table) {
+                         swap(table);
+                         table.clear();
+                     }
+                     return *this;
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::MappedType& SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::operator [](KeyType const& k) {
+                     return (tryEmplace(k).first)->second;
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::MappedType& SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::operator [](KeyType && k) {
+                     return (tryEmplace(std::move(k)).first)->second;
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline String SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::toString() const {
+                     String res;
+                     toString(res);
+                     return res;
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::toString(String& out) const {
+                     out.reserve(out.getSize() + estimateStringSize());
+                     StringSink sink(out);
+                     writeTo(sink);
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class S>
+                 inline void SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::writeTo(S& sink) const {
+                     sink.write("{", 1);
+                     if (!isEmpty()) {
+                         ConstIterator first = begin();
+                         Core::format(sink, *first);
+                         ++first;
+                         while (first != end()) {
+                             sink.write(", ", 2);
+                             Core::format(sink, *first);
+                             ++first;
+                         }
+                     }
+                     sink.write("}", 1);
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline std::size_t SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::estimateStringSize() const {
+                     std::size_t size = (isEmpty()) ? (2) : (2 * nbElements);
+                     for (ConstIterator it = begin(); it != end(); ++it) {
+                         size += Core::estimateStringSize(*it);
+                     }
+                     return size;
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class K>
+                 inline typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::hashKey(K const& k) const {
+                     return Hash::operator ()(k);
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class K>
+                 inline bool SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::compareKey(KeyType const& k1, K const& k2) const {
+                     return KeyEqual::operator ()(k1, k2);
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::ValueType& SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::slotData(SizeType index) const {
+                     return *reinterpret_cast <ValueType*> (slots + index);
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class K>
+                 inline typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::findIndex(K const& k, SizeType hashValue) const {
+                     ControlType h2 = H2(hashValue);
+                     SizeType offset = H1(hashValue) & capacity;
+                     SizeType step = 0;
+                     while (true) {
+                         Group group(ctrl + offset);
+                         for (typename Group::MaskType match = group.match(h2); match != 0; match &= match - 1) {
+                             SizeType index = (offset + static_cast <SizeType> (std::countr_zero(match))) & capacity;
+                             if (compareKey(slotData(index).first, k)) {
+                                 return index;
+                             }
+                         }
+                         if (group.matchEmpty() != 0) {
+                             return capacity;
+                         }
+                         step += Group::WIDTH;
+                         offset = (offset + step) & capacity;
+                     }
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::findFirstNonFull(SizeType hashValue) const {
+                     SizeType offset = H1(hashValue) & capacity;
+                     SizeType step = 0;
+                     while (true) {
+                         typename Group::MaskType free = Group(ctrl + offset).matchEmptyOrDeleted();
+                         if (free != 0) {
+                             return (offset + static_cast <SizeType> (std::countr_zero(free))) & capacity;
+                         }
+                         step += Group::WIDTH;
+                         offset = (offset + step) & capacity;
+                     }
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::prepareInsert(SizeType hashValue) {
+                     if (capacity == 0) {
+                         resize(MIN_CAPACITY);
+                         return findFirstNonFull(hashValue);
+                     }
+                     SizeType index = findFirstNonFull(hashValue);
+                     SizeType threshold = getGrowthThreshold(capacity);
+                     if (nbElements + nbDeleted >= threshold && ctrl[index] != SwissTableInner::DELETED) {
+                         if (nbElements * 8 <= threshold * 7) {
+                             resize(capacity);
+                         } else {
+                             resize(capacity * 2 + 1);
+                         }
+                         index = findFirstNonFull(hashValue);
+                     }
+                     return index;
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class ... Args>
+                 inline void SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::constructAt(SizeType index, SizeType hashValue, Args&& ... args) {
+                     ::new(static_cast <void*> (slots + index)) ValueType(std::forward<Args>(args)...);
+                     if (ctrl[index] == SwissTableInner::DELETED) {
+                         --nbDeleted;
+                     }
+                     setControl(index, H2(hashValue));
+                     ++nbElements;
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class K, class ... Args>
+                 inline Pair<typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator, bool> SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::tryEmplaceHashed(SizeType hashValue, K&& k, Args&& ... args) {
+                     hashValue = Mix::mix(hashValue);
+                     SizeType index = findIndex(k, hashValue);
+                     if (index != capacity) {
+                         return Pair<Iterator, bool>(iteratorAt(index), false);
+                     }
+                     index = prepareInsert(hashValue);
+                     constructAt(index, hashValue, std::piecewise_construct, std::forward_as_tuple(std::forward<K>(k)), std::forward_as_tuple(std::forward<Args>(args)...));
+                     return Pair<Iterator, bool>(iteratorAt(index), true);
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline Pair<typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator, bool> SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::insertHashed(SizeType hashValue, ValueType& toInsert) {
+                     hashValue = Mix::mix(hashValue);
+                     SizeType index = findIndex(toInsert.first, hashValue);
+                     if (index != capacity) {
+                         return Pair<Iterator, bool>(iteratorAt(index), false);
+                     }
+                     index = prepareInsert(hashValue);
+                     constructAt(index, hashValue, std::move(toInsert));
+                     return Pair<Iterator, bool>(iteratorAt(index), true);
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::eraseAt(SizeType index) {
+                     slotData(index).~ValueType();
+                     --nbElements;
+                     typename Group::MaskType emptyBefore = Group(ctrl + ((index - Group::WIDTH) & capacity)).matchEmpty();
+                     typename Group::MaskType emptyAfter = Group(ctrl + index).matchEmpty();
+                     bool wasNeverFull = emptyBefore != 0 && emptyAfter != 0 &&
+                                         static_cast <SizeType> (std::countr_zero(emptyAfter) + std::countl_zero(static_cast <std::uint16_t> (emptyBefore))) < Group::WIDTH;
+                     if (wasNeverFull) {
+                         setControl(index, SwissTableInner::EMPTY);
+                     } else {
+                         setControl(index, SwissTableInner::DELETED);
+                         ++nbDeleted;
+                     }
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::setControl(SizeType index, ControlType value) {
+                     ctrl[index] = value;
+                     ctrl[((index - (Group::WIDTH - 1)) & capacity) + (Group::WIDTH - 1)] = value;
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::resize(SizeType newCapacity) {
+                     ControlType* oldCtrl = ctrl;
+                     ContainerType* oldSlots = slots;
+                     SizeType oldCapacity = capacity;
+
+                     ctrl = ControlAllocatorType(allocator).allocate(newCapacity + Group::WIDTH);
+                     slots = allocator.allocate(newCapacity);
+                     capacity = newCapacity;
+                     nbDeleted = 0;
+                     std::memset(ctrl, static_cast <unsigned char> (SwissTableInner::EMPTY), capacity + Group::WIDTH);
+                     ctrl[capacity] = SwissTableInner::SENTINEL;
+
+                     for (SizeType i = 0; i < oldCapacity; ++i) {
+                         if (oldCtrl[i] >= 0) {
+                             ValueType& value = *reinterpret_cast <ValueType*> (oldSlots + i);
+                             SizeType hashValue = Mix::mix(hashKey(value.first));
+                             SizeType index = findFirstNonFull(hashValue);
+                             ::new(static_cast <void*> (slots + index)) ValueType(std::move(value));
+                             value.~ValueType();
+                             setControl(index, H2(hashValue));
+                         }
+                     }
+
+                     if (oldCapacity > 0) {
+                         ControlAllocatorType(allocator).deallocate(oldCtrl);
+                         allocator.deallocate(oldSlots);
+                     }
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::release() {
+                     if (capacity > 0) {
+                         clear();
+                         ControlAllocatorType(allocator).deallocate(ctrl);
+                         allocator.deallocate(slots);
+                         ctrl = const_cast <ControlType*> (SwissTableInner::EMPTY_GROUP);
+                         slots = nullptr;
+                         capacity = 0;
+                     }
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::getGrowthThreshold(SizeType count) const {
+                     if (count == 0) {
+                         return 0;
+                     }
+                     return std::min(count - 1, static_cast <SizeType> (static_cast <float> (count) * maxLoadFactor));
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator SwissTable<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::iteratorAt(SizeType index) const {
+                     return Iterator(ctrl + index, slots + index);
+                 }
+
+             }
+         }
+     }
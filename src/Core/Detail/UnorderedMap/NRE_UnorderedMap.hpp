@@ -10,6 +10,7 @@
      #pragma once
 
     #include "../HashTable/NRE_HashTable.hpp"
+    #include "../SwissTable/NRE_SwissTable.hpp"
 
      /**
      * @namespace NRE
@@ -27,9 +28,10 @@
                 /**
                  * @class UnorderedMap
                  * @brief An unordered map, associative unordered container
+                 * The storage is delegated to a backend table : HashTable (Robin Hood) by default, or SwissTable
                  */
-                template <class Key, class T, class Allocator, bool StoreHash = false, class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key>>
-                class UnorderedMap : public Stringable<UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>> {
+                template <class Key, class T, class Allocator, bool StoreHash = false, class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key>, class Mix = DefaultHashMix<Key, Hash>, template <class, class, class, bool, class, class, class> class Backend = HashTable>
+                class UnorderedMap : public Stringable<UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>> {
                     static_assert(Memory::IsAllocatorV<Allocator>);                                /**< Check if the given AllocatorType inherit from NRE::Memory::AllocatorTraits */
                     static_assert(std::is_same_v<Pair<Key, T>, typename Allocator::ValueType>);    /**< Make sure the allocator is set for the container inner type */
                     
@@ -41,27 +43,27 @@
                         /** The container's allocated type */
                         using ValueType             = Pair<KeyType, MappedType>;
                         /** The container's allocator */
-                        using AllocatorType         = typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::AllocatorType;
+                        using AllocatorType         = typename Backend<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::AllocatorType;
                         /** The object's size type */
-                        using SizeType              = typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::SizeType;
+                        using SizeType              = typename Backend<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType;
                         /** The object's difference type */
-                        using DifferenceType        = typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::DifferenceType;
+                        using DifferenceType        = typename Backend<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::DifferenceType;
                         /** The allocated type reference */
-                        using Reference             = typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::Reference;
+                        using Reference             = typename Backend<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Reference;
                         /** The allocated type const reference */
-                        using ConstReference        = typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::ConstReference;
+                        using ConstReference        = typename Backend<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConstReference;
                         /** The allocated type pointer */
-                        using Pointer               = typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::Pointer;
+                        using Pointer               = typename Backend<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Pointer;
                         /** The allocated type const pointer */
-                        using ConstPointer          = typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::ConstPointer;
+                        using ConstPointer          = typename Backend<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConstPointer;
                         /** Mutable forward access iterator */
-                        using Iterator              = typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::Iterator;
+                        using Iterator              = typename Backend<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator;
                         /** Immuable forward access iterator */
-                        using ConstIterator         = typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::ConstIterator;
+                        using ConstIterator         = typename Backend<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConstIterator;
                         /** Mutable local forward access iterator */
-                        using LocalIterator         = typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::LocalIterator;
+                        using LocalIterator         = typename Backend<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::LocalIterator;
                         /** Immuable local forward access iterator */
-                        using ConstLocalIterator    = typename HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::ConstLocalIterator;
+                        using ConstLocalIterator    = typename Backend<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConstLocalIterator;
                         /** STL compatibility */
                         using value_type            = ValueType;
                         /** STL compatibility */
@@ -86,9 +88,13 @@
                         using local_iterator        = LocalIterator;
                         /** STL compatibility */
                         using const_local_iterator  = ConstLocalIterator;
+                        /** The map statistics snapshot */
+                        using Statistics            = HashTableInner::HashTableStatistics;
+                        /** The extracted element node */
+                        using NodeType              = HashTableInner::NodeHandle<Key, T>;
     
                     private :   // Fields
-                         HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual> table; /**< The internal hash table */
+                         Backend<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix> table; /**< The internal hash table, Robin Hood or Swiss backend */
     
                     public :    // Methods
                         //## Constructor ##//
@@ -99,7 +105,7 @@
                              * @param equal       the equal function used in the map
                              * @param alloc       the hashtable's memory allocator
                              */
-                            UnorderedMap(SizeType bucketCount = HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::DEFAULT_BUCKET_COUNT, Hash const& hasher = Hash(), KeyEqual const& equal = KeyEqual(), Allocator const& alloc = Allocator());
+                            UnorderedMap(SizeType bucketCount = Backend<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::DEFAULT_BUCKET_COUNT, Hash const& hasher = Hash(), KeyEqual const& equal = KeyEqual(), Allocator const& alloc = Allocator());
                             /**
                              * Construct a map with a number of bucket and filled with elements in the given range
                              * @param begin       the begin iterator
@@ -110,7 +116,7 @@
                              * @param alloc       the hashtable's memory allocator
                              */
                             template <class InputIterator>
-                            UnorderedMap(InputIterator begin, InputIterator end, SizeType bucketCount = HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::DEFAULT_BUCKET_COUNT, Hash const& hasher = Hash(), KeyEqual const& equal = KeyEqual(), Allocator const& alloc = Allocator());
+                            UnorderedMap(InputIterator begin, InputIterator end, SizeType bucketCount = Backend<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::DEFAULT_BUCKET_COUNT, Hash const& hasher = Hash(), KeyEqual const& equal = KeyEqual(), Allocator const& alloc = Allocator());
                             /**
                              * Construct a map with a number of bucket and filled with elements in the given list
                              * @param list        the list to fill the map with
@@ -119,7 +125,7 @@
                              * @param equal       the equal function used in the map
                              * @param alloc       the hashtable's memory allocator
                              */
-                            UnorderedMap(std::initializer_list<ValueType> list, SizeType bucketCount = HashTable<Key, T, Allocator, StoreHash, Hash, KeyEqual>::DEFAULT_BUCKET_COUNT, Hash const& hasher = Hash(), KeyEqual const& equal = KeyEqual(), Allocator const& alloc = Allocator());
+                            UnorderedMap(std::initializer_list<ValueType> list, SizeType bucketCount = Backend<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>::DEFAULT_BUCKET_COUNT, Hash const& hasher = Hash(), KeyEqual const& equal = KeyEqual(), Allocator const& alloc = Allocator());
     
                         //## Copy Constructor ##//
                             /**
@@ -150,6 +156,20 @@
                              * @return   the corresponding element
                              */
                             MappedType const& get(KeyType const& k) const;
+                            /**
+                             * Access a particular element with bound checking, with any key comparable to KeyType when the hash and equal functions are transparent
+                             * @param  k the element key
+                             * @return   the corresponding element
+                             */
+                            template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                            MappedType& get(K const& k);
+                            /**
+                             * Access a particular element with bound checking, with any key comparable to KeyType when the hash and equal functions are transparent
+                             * @param  k the element key
+                             * @return   the corresponding element
+                             */
+                            template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                            MappedType const& get(K const& k) const;
                             /**
                              * @return the number of buckets in the map
                              */
@@ -166,6 +186,10 @@
                              * @return the maximum load factor
                              */
                             float getMaxLoadFactor() const;
+                            /**
+                             * @return the minimum load factor, 0 if the map never shrinks on its own
+                             */
+                            float getMinLoadFactor() const;
                             /**
                              * @return the current load factor
                              */
@@ -188,12 +212,49 @@
                              * @return   the number of corresponding elements
                              */
                             SizeType getCount(KeyType const& k) const;
+                            /**
+                             * Find the number of element with the given key, using its precomputed hash
+                             * @param  k         the key to search
+                             * @param  hashValue the key hash, computed with the map hash function
+                             * @return           the number of corresponding elements
+                             */
+                            SizeType getCount(KeyType const& k, SizeType hashValue) const;
+                            /**
+                             * Find the number of element with the given key, using its precomputed hash
+                             * @param  k the key to search with its hash
+                             * @return   the number of corresponding elements
+                             */
+                            SizeType getCount(HashedKey<KeyType> const& k) const;
+                            /**
+                             * Find the number of element with the given key, with any key comparable to KeyType when the hash and equal functions are transparent
+                             * @param  k the key to search
+                             * @return   the number of corresponding elements
+                             */
+                            template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                            SizeType getCount(K const& k) const;
                             /**
                              * Get the bucket index from a given key
                              * @param  k the key to search
                              * @return   the corresponding bucket
                              */
                             SizeType getBucket(KeyType const& k) const;
+                            /**
+                             * @return the number of bytes used by the map, its buckets included
+                             */
+                            SizeType getMemoryUsage() const;
+                            /**
+                             * Take a snapshot of the map layout and event counters, events being counted only when NRE_USE_HASHTABLE_STATISTICS is defined
+                             * @return the map statistics
+                             */
+                            Statistics getStatistics() const;
+                            /**
+                             * @return if an incremental rehash is in progress
+                             */
+                            bool isRehashing() const;
+                            /**
+                             * @return the number of previous buckets moved at each insert or erase during an incremental rehash, 0 if the map grows in one go
+                             */
+                            SizeType getRehashStep() const;
     
                         //## Setter ##//
                             /**
@@ -201,6 +262,16 @@
                              * @param factor the new factor
                              */
                             void setMaxLoadFactor(float factor);
+                            /**
+                             * Set the load factor under which erasing by key shrinks the map, 0 to never shrink, at most a quarter of the max load factor
+                             * @param factor the new factor
+                             */
+                            void setMinLoadFactor(float factor);
+                            /**
+                             * Set the number of previous buckets moved at each insert or erase when the map grows, 0 to grow in one go
+                             * @param step the new step
+                             */
+                            void setRehashStep(SizeType step);
     
                         //## Iterator Access ##//
                             /**
@@ -285,11 +356,25 @@
                              */
                             template <class InputIterator>
                             void insert(InputIterator begin, InputIterator end);
+                            /**
+                             * Insert elements in the given range from several threads, the result being the same as with insert
+                             * @param begin       the begin iterator
+                             * @param end         the end iterator
+                             * @param threadCount the number of threads, 0 to use the hardware concurrency
+                             */
+                            template <class RandomAccessIterator> requires Concept::RandomAccessIterator<RandomAccessIterator>
+                            void insertParallel(RandomAccessIterator begin, RandomAccessIterator end, SizeType threadCount = 0);
                             /**
                              * Insert elements in the given list
                              * @param list the list of value to insert
                              */
                             void insert(std::initializer_list<ValueType> list);
+                            /**
+                             * Insert the element held by a node if its key is not already in the map, reusing the node stored hash when possible
+                             * @param  node the node to insert, left empty if the insertion has been done and untouched otherwise
+                             * @return      a pair containing an iterator on the element with the node key, and a boolean telling if the insertion has been done
+                             */
+                            Pair<Iterator, bool> insert(NodeType && node);
                             /**
                              * Insert the given value in the map using the hint as a suggestion for the search start
                              * @param  hint  the hint used for the search
@@ -320,6 +405,46 @@
                              */
                             template <class ... Args>
                             Iterator emplaceHint(ConstIterator hint, Args && ... args);
+                            /**
+                             * Emplace an element using the given elements and the precomputed hash of its key
+                             * @param hashValue the hash of the inserted key, computed with the map hash function
+                             * @param args      the parameter pack used to create the inserted pair
+                             * @return          a pair containing an iterator on the inserted element, and a boolean telling if the insertion has been done
+                             */
+                            template <class ... Args>
+                            Pair<Iterator, bool> emplaceHashed(SizeType hashValue, Args && ... args);
+                            /**
+                             * Emplace an element if the key is not in the map, the mapped value is only constructed after a miss
+                             * @param k    the element key, left untouched if already in the map
+                             * @param args the parameter pack used to create the mapped value
+                             * @return     a pair containing an iterator on the inserted or found element, and a boolean telling if the insertion has been done
+                             */
+                            template <class ... Args>
+                            Pair<Iterator, bool> tryEmplace(KeyType const& k, Args && ... args);
+                            /**
+                             * Emplace an element if the key is not in the map, the mapped value is only constructed after a miss
+                             * @param k    the element key, left untouched if already in the map
+                             * @param args the parameter pack used to create the mapped value
+                             * @return     a pair containing an iterator on the inserted or found element, and a boolean telling if the insertion has been done
+                             */
+                            template <class ... Args>
+                            Pair<Iterator, bool> tryEmplace(KeyType && k, Args && ... args);
+                            /**
+                             * Insert the value with the given key, or assign it to the existing element
+                             * @param k     the element key
+                             * @param value the value to insert or assign
+                             * @return      a pair containing an iterator on the element, and a boolean telling if the insertion has been done
+                             */
+                            template <class M>
+                            Pair<Iterator, bool> insertOrAssign(KeyType const& k, M && value);
+                            /**
+                             * Insert the value with the given key, or assign it to the existing element
+                             * @param k     the element key
+                             * @param value the value to insert or assign
+                             * @return      a pair containing an iterator on the element, and a boolean telling if the insertion has been done
+                             */
+                            template <class M>
+                            Pair<Iterator, bool> insertOrAssign(KeyType && k, M && value);
                             /**
                              * Clear all buckets
                              */
@@ -329,6 +454,12 @@
                              * @param map the other map
                              */
                             void swap(UnorderedMap& map);
+                            /**
+                             * Move every element of the given map whose key isn't in this map, without hashing keys again when the hash is stored
+                             * Elements with a key already in this map stay in the given one
+                             * @param map the map to take elements from
+                             */
+                            void merge(UnorderedMap& map);
                             /**
                              * Reserve at least count bucket in the map and rehash the map
                              * @param count the number of desired bucket
@@ -339,6 +470,42 @@
                              * @param count the number of desired bucket
                              */
                             void rehash(SizeType count);
+                            /**
+                             * Move every remaining previous bucket, ending the incremental rehash in progress if any
+                             */
+                            void finishRehash();
+                            /**
+                             * Shrink the bucket count to the smallest one holding the elements under the max load factor
+                             */
+                            void shrinkToFit();
+                            /**
+                             * Move back every displaced element to the closest free bucket after its home, ending the incremental rehash in progress if any
+                             */
+                            void compact();
+                            /**
+                             * Reset the event counters
+                             */
+                            void resetStatistics();
+                            /**
+                             * Write a binary snapshot of the map, a header followed by the raw bucket array
+                             * @param fd the destination file descriptor
+                             * @throw std::system_error if the write fails
+                             */
+                            void save(int fd) const requires Concept::MemCopyable<ValueType>;
+                            /**
+                             * Replace the map content with a snapshot, read in a single bulk read, elements being reinserted only if the hash seed or bucket placement version differs
+                             * @param fd the source file descriptor, positioned on the snapshot header
+                             * @throw std::system_error  if the read fails
+                             * @throw std::runtime_error if the snapshot is truncated, corrupted or written for another element type
+                             */
+                            void load(int fd) requires Concept::MemCopyable<ValueType>;
+                            /**
+                             * Replace the map content with a snapshot file, mapped in memory and copied in a single memcpy, elements being reinserted only if the hash seed or bucket placement version differs
+                             * @param path the snapshot file path
+                             * @throw std::system_error  if the file can't be opened or mapped
+                             * @throw std::runtime_error if the snapshot is truncated, corrupted or written for another element type
+                             */
+                            void mapFrom(const char* path) requires Concept::MemCopyable<ValueType>;
                             /**
                              * Find a range of iterator containing all elements with the given key, both end if not found
                              * @param key the key to search
@@ -351,6 +518,20 @@
                              * @return    a pair of iterator
                              */
                             Pair<ConstIterator, ConstIterator> equalRange(KeyType const& key) const;
+                            /**
+                             * Find a range of iterator containing all elements with the given key, with any key comparable to KeyType when the hash and equal functions are transparent
+                             * @param key the key to search
+                             * @return    a pair of iterator
+                             */
+                            template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                            Pair<Iterator, Iterator> equalRange(K const& key);
+                            /**
+                             * Find a range of iterator containing all elements with the given key, with any key comparable to KeyType when the hash and equal functions are transparent
+                             * @param key the key to search
+                             * @return    a pair of iterator
+                             */
+                            template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                            Pair<ConstIterator, ConstIterator> equalRange(K const& key) const;
                             /**
                              * Find the element corresponding with the given key
                              * @param  k the key to search
@@ -363,6 +544,46 @@
                              * @return   the iterator pointing on the element, or end if not found
                              */
                             ConstIterator find(KeyType const& k) const;
+                            /**
+                             * Find the element corresponding with the given key, using its precomputed hash
+                             * @param  k         the key to search
+                             * @param  hashValue the key hash, computed with the map hash function
+                             * @return           the iterator pointing on the element, or end if not found
+                             */
+                            Iterator find(KeyType const& k, SizeType hashValue);
+                            /**
+                             * Find the element corresponding with the given key, using its precomputed hash
+                             * @param  k         the key to search
+                             * @param  hashValue the key hash, computed with the map hash function
+                             * @return           the iterator pointing on the element, or end if not found
+                             */
+                            ConstIterator find(KeyType const& k, SizeType hashValue) const;
+                            /**
+                             * Find the element corresponding with the given key, using its precomputed hash
+                             * @param  k the key to search with its hash
+                             * @return   the iterator pointing on the element, or end if not found
+                             */
+                            Iterator find(HashedKey<KeyType> const& k);
+                            /**
+                             * Find the element corresponding with the given key, using its precomputed hash
+                             * @param  k the key to search with its hash
+                             * @return   the iterator pointing on the element, or end if not found
+                             */
+                            ConstIterator find(HashedKey<KeyType> const& k) const;
+                            /**
+                             * Find the element corresponding with the given key, with any key comparable to KeyType when the hash and equal functions are transparent
+                             * @param  k the key to search
+                             * @return   the iterator pointing on the element, or end if not found
+                             */
+                            template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                            Iterator find(K const& k);
+                            /**
+                             * Find the element corresponding with the given key, with any key comparable to KeyType when the hash and equal functions are transparent
+                             * @param  k the key to search
+                             * @return   the iterator pointing on the element, or end if not found
+                             */
+                            template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                            ConstIterator find(K const& k) const;
                             /**
                              * Erase the element pointed by the iterator
                              * @param  pos the iterator on the erased element
@@ -382,12 +603,66 @@
                              * @return       an iterator after the last erased element
                              */
                             Iterator erase(ConstIterator begin, ConstIterator end);
+                            /**
+                             * Remove the element pointed by the iterator and return it in a node, with its stored hash
+                             * @param  pos the iterator on the extracted element
+                             * @return     the node holding the element
+                             */
+                            NodeType extract(Iterator pos);
+                            /**
+                             * Remove the element pointed by the iterator and return it in a node, with its stored hash
+                             * @param  pos the iterator on the extracted element
+                             * @return     the node holding the element
+                             */
+                            NodeType extract(ConstIterator pos);
+                            /**
+                             * Remove the element with the given key and return it in a node, with its stored hash
+                             * @param  k the key of the extracted element
+                             * @return   the node holding the element, empty if the key isn't in the map
+                             */
+                            NodeType extract(KeyType const& k);
                             /**
                              * Erase all element with the given key
                              * @param  k the key to search and erase
                              * @return   the number of erased elements
                              */
                             SizeType erase(KeyType const& k);
+                            /**
+                             * Erase all element with the given key, using its precomputed hash
+                             * @param  k         the key to search and erase
+                             * @param  hashValue the key hash, computed with the map hash function
+                             * @return           the number of erased elements
+                             */
+                            SizeType erase(KeyType const& k, SizeType hashValue);
+                            /**
+                             * Erase all element with the given key, using its precomputed hash
+                             * @param  k the key to search and erase with its hash
+                             * @return   the number of erased elements
+                             */
+                            SizeType erase(HashedKey<KeyType> const& k);
+                            /**
+                             * Erase all element with the given key, with any key comparable to KeyType when the hash and equal functions are transparent
+                             * @param  k the key to search and erase
+                             * @return   the number of erased elements
+                             */
+                            template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                            SizeType erase(K const& k);
+                            /**
+                             * Find the elements corresponding with a range of keys, hashing and prefetching a whole batch before probing it to overlap the cache misses
+                             * @param keysBegin the begin iterator on the keys, must be a forward iterator
+                             * @param keysEnd   the end iterator on the keys
+                             * @param out       the output iterator receiving, for each key in order, an iterator on the element or end if not found
+                             */
+                            template <class ForwardIterator, class OutputIterator> requires Concept::ForwardIterator<ForwardIterator>
+                            void findBatch(ForwardIterator keysBegin, ForwardIterator keysEnd, OutputIterator out);
+                            /**
+                             * Find the elements corresponding with a range of keys, hashing and prefetching a whole batch before probing it to overlap the cache misses
+                             * @param keysBegin the begin iterator on the keys, must be a forward iterator
+                             * @param keysEnd   the end iterator on the keys
+                             * @param out       the output iterator receiving, for each key in order, an iterator on the element or end if not found
+                             */
+                            template <class ForwardIterator, class OutputIterator> requires Concept::ForwardIterator<ForwardIterator>
+                            void findBatch(ForwardIterator keysBegin, ForwardIterator keysEnd, OutputIterator out) const;
                             /**
                              * @return the hash function
                              */
@@ -445,6 +720,21 @@
                              * @return the converted object
                              */
                             [[nodiscard]] String toString() const;
+                            /**
+                             * Append the object string representation at the end of out, reserving its exact size first
+                             * @param out the string to append into
+                             */
+                            void toString(String& out) const;
+                            /**
+                             * @return the object string representation size, used to format nested objects in one allocation
+                             */
+                            std::size_t estimateStringSize() const;
+                            /**
+                             * Format the object straight into the given sink
+                             * @param sink the sink to write into
+                             */
+                            template <class S>
+                            void writeTo(S& sink) const;
                 };
             }
         }
@@ -11,297 +11,544 @@
          namespace Core {
              namespace Detail {
 
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::UnorderedMap(SizeType bucketCount, Hash const& hasher, KeyEqual const& equal, Allocator const& alloc) : table(bucketCount, hasher, equal, alloc) {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::UnorderedMap(SizeType bucketCount, Hash const& hasher, KeyEqual const& equal, Allocator const& alloc) : table(bucketCount, hasher, equal, alloc) {
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
                  template <class InputIterator>
-                 inline UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::UnorderedMap(InputIterator begin, InputIterator end, SizeType bucketCount, Hash const& hasher, KeyEqual const& equal, Allocator const& alloc) : table(begin, end, bucketCount, hasher, equal, alloc) {
+                 inline UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::UnorderedMap(InputIterator begin, InputIterator end, SizeType bucketCount, Hash const& hasher, KeyEqual const& equal, Allocator const& alloc) : table(begin, end, bucketCount, hasher, equal, alloc) {
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::UnorderedMap(std::initializer_list<ValueType> list, SizeType bucketCount, Hash const& hasher, KeyEqual const& equal, Allocator const& alloc) : table(list, bucketCount, hasher, equal, alloc) {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::UnorderedMap(std::initializer_list<ValueType> list, SizeType bucketCount, Hash const& hasher, KeyEqual const& equal, Allocator const& alloc) : table(list, bucketCount, hasher, equal, alloc) {
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::UnorderedMap(UnorderedMap const& map, Allocator const& alloc) : table(map.table, alloc) {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::UnorderedMap(UnorderedMap const& map, Allocator const& alloc) : table(map.table, alloc) {
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::UnorderedMap(UnorderedMap && map, Allocator const& alloc) : table(std::move(map.table), alloc) {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::UnorderedMap(UnorderedMap && map, Allocator const& alloc) : table(std::move(map.table), alloc) {
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::MappedType& UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::get(KeyType const& k) {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::MappedType& UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::get(KeyType const& k) {
                      return table.get(k);
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::MappedType const& UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::get(KeyType const& k) const {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::MappedType const& UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::get(KeyType const& k) const {
                      return table.get(k);
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::SizeType UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::getBucketCount() const {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::MappedType& UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::get(K const& k) {
+                     return table.get(k);
+                 }
+    
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::MappedType const& UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::get(K const& k) const {
+                     return table.get(k);
+                 }
+    
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::SizeType UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::getBucketCount() const {
                      return table.getBucketCount();
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 constexpr typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::SizeType UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::getMaxBucketCount() const {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 constexpr typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::SizeType UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::getMaxBucketCount() const {
                      return table.getMaxBucketCount();
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::SizeType UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::getSize() const {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::SizeType UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::getSize() const {
                      return table.getSize();
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline float UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::getMaxLoadFactor() const {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline float UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::getMaxLoadFactor() const {
                      return table.getMaxLoadFactor();
                  }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline float UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::getMinLoadFactor() const {
+                     return table.getMinLoadFactor();
+                 }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline float UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::getLoadFactor() const {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline float UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::getLoadFactor() const {
                      return table.getLoadFactor();
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 constexpr typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::SizeType UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::getMaxSize() const {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 constexpr typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::SizeType UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::getMaxSize() const {
                      return table.getMaxSize();
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline Allocator UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::getAllocator() const {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline Allocator UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::getAllocator() const {
                      return table.getAllocator();
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline bool UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::isEmpty() const {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline bool UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::isEmpty() const {
                      return table.isEmpty();
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::SizeType UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::getCount(KeyType const& k) const {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::SizeType UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::getCount(KeyType const& k) const {
                      return table.getCount(k);
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::SizeType UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::getBucket(KeyType const& k) const {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::SizeType UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::getCount(KeyType const& k, SizeType hashValue) const {
+                     return table.getCount(k, hashValue);
+                 }
+    
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::SizeType UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::getCount(HashedKey<KeyType> const& k) const {
+                     return table.getCount(k);
+                 }
+    
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::SizeType UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::getCount(K const& k) const {
+                     return table.getCount(k);
+                 }
+    
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::SizeType UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::getBucket(KeyType const& k) const {
                      return table.getBucket(k);
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline void UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::setMaxLoadFactor(float factor) {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::SizeType UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::getMemoryUsage() const {
+                     return table.getMemoryUsage();
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::Statistics UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::getStatistics() const {
+                     return table.getStatistics();
+                 }
+    
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline bool UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::isRehashing() const {
+                     return table.isRehashing();
+                 }
+    
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::SizeType UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::getRehashStep() const {
+                     return table.getRehashStep();
+                 }
+    
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline void UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::setMaxLoadFactor(float factor) {
                      table.setMaxLoadFactor(factor);
                  }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline void UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::setMinLoadFactor(float factor) {
+                     table.setMinLoadFactor(factor);
+                 }
+    
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline void UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::setRehashStep(SizeType step) {
+                     table.setRehashStep(step);
+                 }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::Iterator UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::begin() {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::Iterator UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::begin() {
                      return table.begin();
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::ConstIterator UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::begin() const {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::ConstIterator UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::begin() const {
                      return table.begin();
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::ConstIterator UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::cbegin() const {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::ConstIterator UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::cbegin() const {
                      return table.cbegin();
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::Iterator UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::end() {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::Iterator UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::end() {
                      return table.end();
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::ConstIterator UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::end() const {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::ConstIterator UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::end() const {
                      return table.end();
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::ConstIterator UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::cend() const {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::ConstIterator UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::cend() const {
                      return table.cend();
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::LocalIterator UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::begin(SizeType index) {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::LocalIterator UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::begin(SizeType index) {
                      return table.begin(index);
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::ConstLocalIterator UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::begin(SizeType index) const {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::ConstLocalIterator UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::begin(SizeType index) const {
                      return table.begin(index);
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::ConstLocalIterator UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::cbegin(SizeType index) const {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::ConstLocalIterator UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::cbegin(SizeType index) const {
                      return table.cbegin(index);
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::LocalIterator UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::end(SizeType index) {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::LocalIterator UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::end(SizeType index) {
                      return table.end(index);
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::ConstLocalIterator UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::end(SizeType index) const {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::ConstLocalIterator UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::end(SizeType index) const {
                      return table.end(index);
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::ConstLocalIterator UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::cend(SizeType index) const {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::ConstLocalIterator UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::cend(SizeType index) const {
                      return table.cend(index);
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline Pair<typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::Iterator, bool> UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::insert(ValueType const& value) {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline Pair<typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::Iterator, bool> UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::insert(ValueType const& value) {
                      return table.insert(value);
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
                  template <class P>
-                 inline Pair<typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::Iterator, bool> UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::insert(P && value) {
+                 inline Pair<typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::Iterator, bool> UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::insert(P && value) {
                      return table.insert(value);
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
                  template <class InputIterator>
-                 inline void UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::insert(InputIterator begin, InputIterator end) {
+                 inline void UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::insert(InputIterator begin, InputIterator end) {
                      return table.insert(begin, end);
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline void UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::insert(std::initializer_list<ValueType> list) {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 template <class RandomAccessIterator> requires Concept::RandomAccessIterator<RandomAccessIterator>
+                 inline void UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::insertParallel(RandomAccessIterator begin, RandomAccessIterator end, SizeType threadCount) {
+                     table.insertParallel(begin, end, threadCount);
+                 }
+    
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline void UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::insert(std::initializer_list<ValueType> list) {
                      return table.insert(list);
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::Iterator UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::insertHint(ConstIterator hint, ValueType const& value) {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline Pair<typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::Iterator, bool> UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::insert(NodeType && node) {
+                     return table.insert(std::move(node));
+                 }
+    
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::Iterator UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::insertHint(ConstIterator hint, ValueType const& value) {
                      return table.insertHint(hint, value);
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
                  template <class P>
-                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::Iterator UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::insertHint(ConstIterator hint, P && value) {
+                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::Iterator UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::insertHint(ConstIterator hint, P && value) {
                      return table.insertHint(hint, std::forward<P>(value));
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
                  template <class ... Args>
-                 inline Pair<typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::Iterator, bool> UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::emplace(Args && ... args) {
+                 inline Pair<typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::Iterator, bool> UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::emplace(Args && ... args) {
                      return table.emplace(std::forward<Args>(args)...);
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
                  template <class ... Args>
-                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::Iterator UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::emplaceHint(ConstIterator hint, Args && ... args) {
+                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::Iterator UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::emplaceHint(ConstIterator hint, Args && ... args) {
                      return table.emplaceHint(hint, std::forward<Args>(args)...);
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline void UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::clear() {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 template <class ... Args>
+                 inline Pair<typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::Iterator, bool> UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::emplaceHashed(SizeType hashValue, Args && ... args) {
+                     return table.emplaceHashed(hashValue, std::forward<Args>(args)...);
+                 }
+    
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 template <class ... Args>
+                 inline Pair<typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::Iterator, bool> UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::tryEmplace(KeyType const& k, Args && ... args) {
+                     return table.tryEmplace(k, std::forward<Args>(args)...);
+                 }
+    
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 template <class ... Args>
+                 inline Pair<typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::Iterator, bool> UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::tryEmplace(KeyType && k, Args && ... args) {
+                     return table.tryEmplace(std::move(k), std::forward<Args>(args)...);
+                 }
+    
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 template <class M>
+                 inline Pair<typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::Iterator, bool> UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::insertOrAssign(KeyType const& k, M && value) {
+                     return table.insertOrAssign(k, std::forward<M>(value));
+                 }
+    
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 template <class M>
+                 inline Pair<typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::Iterator, bool> UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::insertOrAssign(KeyType && k, M && value) {
+                     return table.insertOrAssign(std::move(k), std::forward<M>(value));
+                 }
+    
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline void UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::clear() {
                      return table.clear();
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline void UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::swap(UnorderedMap& map) {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline void UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::swap(UnorderedMap& map) {
                      using std::swap;
                      swap(table, map.table);
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline void UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::reserve(SizeType count) {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline void UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::merge(UnorderedMap& map) {
+                     table.merge(map.table);
+                 }
+    
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline void UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::reserve(SizeType count) {
                      table.reserve(count);
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline void UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::rehash(SizeType count) {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline void UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::rehash(SizeType count) {
                      table.rehash(count);
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline Pair<typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::Iterator, typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::Iterator> UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::equalRange(KeyType const& key) {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline void UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::finishRehash() {
+                     table.finishRehash();
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline void UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::shrinkToFit() {
+                     table.shrinkToFit();
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline void UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::compact() {
+                     table.compact();
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline void UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::resetStatistics() {
+                     table.resetStatistics();
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline void UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::save(int fd) const requires Concept::MemCopyable<ValueType> {
+                     table.save(fd);
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline void UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::load(int fd) requires Concept::MemCopyable<ValueType> {
+                     table.load(fd);
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline void UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::mapFrom(const char* path) requires Concept::MemCopyable<ValueType> {
+                     table.mapFrom(path);
+                 }
+    
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline Pair<typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::Iterator, typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::Iterator> UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::equalRange(KeyType const& key) {
                      return table.equalRange(key);
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline Pair<typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::ConstIterator, typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::ConstIterator> UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::equalRange(KeyType const& key) const {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline Pair<typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::ConstIterator, typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::ConstIterator> UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::equalRange(KeyType const& key) const {
                      return table.equalRange(key);
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::Iterator UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::find(KeyType const& k) {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                 inline Pair<typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::Iterator, typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::Iterator> UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::equalRange(K const& key) {
+                     return table.equalRange(key);
+                 }
+    
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                 inline Pair<typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::ConstIterator, typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::ConstIterator> UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::equalRange(K const& key) const {
+                     return table.equalRange(key);
+                 }
+    
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::Iterator UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::find(KeyType const& k) {
                      return table.find(k);
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::ConstIterator UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::find(KeyType const& k) const {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::ConstIterator UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::find(KeyType const& k) const {
                      return table.find(k);
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::Iterator UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::erase(Iterator pos) {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::Iterator UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::find(KeyType const& k, SizeType hashValue) {
+                     return table.find(k, hashValue);
+                 }
+    
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::ConstIterator UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::find(KeyType const& k, SizeType hashValue) const {
+                     return table.find(k, hashValue);
+                 }
+    
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::Iterator UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::find(HashedKey<KeyType> const& k) {
+                     return table.find(k);
+                 }
+    
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::ConstIterator UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::find(HashedKey<KeyType> const& k) const {
+                     return table.find(k);
+                 }
+    
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::Iterator UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::find(K const& k) {
+                     return table.find(k);
+                 }
+    
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::ConstIterator UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::find(K const& k) const {
+                     return table.find(k);
+                 }
+    
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::Iterator UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::erase(Iterator pos) {
                      return table.erase(pos);
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::Iterator UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::erase(ConstIterator pos) {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::Iterator UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::erase(ConstIterator pos) {
                      return table.erase(pos);
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::Iterator UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::erase(ConstIterator begin, ConstIterator end) {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::Iterator UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::erase(ConstIterator begin, ConstIterator end) {
                      return table.erase(begin, end);
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::SizeType UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::erase(KeyType const& k) {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::NodeType UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::extract(Iterator pos) {
+                     return table.extract(pos);
+                 }
+    
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::NodeType UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::extract(ConstIterator pos) {
+                     return table.extract(pos);
+                 }
+    
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::NodeType UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::extract(KeyType const& k) {
+                     return table.extract(k);
+                 }
+    
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::SizeType UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::erase(KeyType const& k) {
+                     return table.erase(k);
+                 }
+    
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::SizeType UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::erase(KeyType const& k, SizeType hashValue) {
+                     return table.erase(k, hashValue);
+                 }
+    
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::SizeType UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::erase(HashedKey<KeyType> const& k) {
                      return table.erase(k);
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline Hash UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::getHash() const {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::SizeType UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::erase(K const& k) {
+                     return table.erase(k);
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 template <class ForwardIterator, class OutputIterator> requires Concept::ForwardIterator<ForwardIterator>
+                 inline void UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::findBatch(ForwardIterator keysBegin, ForwardIterator keysEnd, OutputIterator out) {
+                     table.findBatch(keysBegin, keysEnd, out);
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 template <class ForwardIterator, class OutputIterator> requires Concept::ForwardIterator<ForwardIterator>
+                 inline void UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::findBatch(ForwardIterator keysBegin, ForwardIterator keysEnd, OutputIterator out) const {
+                     table.findBatch(keysBegin, keysEnd, out);
+                 }
+    
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline Hash UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::getHash() const {
                      return table.getHash();
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline KeyEqual UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::getKeyEqual() const {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline KeyEqual UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::getKeyEqual() const {
                      return table.getKeyEqual();
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>& UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::operator=(UnorderedMap const& map) {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>& UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::operator=(UnorderedMap const& map) {
                      table = map.table;
                      return *this;
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>& UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::operator=(UnorderedMap && map) {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>& UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::operator=(UnorderedMap && map) {
                      table = std::move(map.table);
                      return *this;
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::MappedType& UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::operator[](KeyType const& k) {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::MappedType& UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::operator[](KeyType const& k) {
                      return table[k];
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::MappedType& UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::operator[](KeyType && k) {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline typename UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::MappedType& UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::operator[](KeyType && k) {
                      return table[std::forward<Key>(k)];
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline String UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::toString() const {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline String UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::toString() const {
                      return table.toString();
                  }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline void UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::toString(String& out) const {
+                     table.toString(out);
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline std::size_t UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::estimateStringSize() const {
+                     return table.estimateStringSize();
+                 }
+
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 template <class S>
+                 inline void UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::writeTo(S& sink) const {
+                     table.writeTo(sink);
+                 }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline bool UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::operator==(UnorderedMap const& map) const {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline bool UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::operator==(UnorderedMap const& map) const {
                      if (getSize() != map.getSize()) {
                          return false;
                      }
@@ -316,8 +563,8 @@
                      return true;
                  }
     
-                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual>
-                 inline bool UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>::operator!=(UnorderedMap const& map) const {
+                 template <class Key, class T, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix, template <class, class, class, bool, class, class, class> class Backend>
+                 inline bool UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix, Backend>::operator!=(UnorderedMap const& map) const {
                      return !(*this == map);
                  }
             }
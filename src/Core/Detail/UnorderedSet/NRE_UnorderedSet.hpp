@@ -0,0 +1,579 @@
+
+    /**
+     * @file Detail/UnorderedSet/NRE_UnorderedSet.hpp
+     * @brief Declaration of Core's API's Container : UnorderedSet
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+     #pragma once
+
+    #include "../HashTable/NRE_HashTable.hpp"
+
+     /**
+     * @namespace NRE
+     * @brief The NearlyRealEngine's global namespace
+     */
+    namespace NRE {
+        /**
+         * @namespace Core
+         * @brief Core's API
+         */
+        namespace Core {
+
+            namespace Detail {
+
+                /**
+                 * @class UnorderedSet
+                 * @brief An unordered set, associative unordered container of unique keys
+                 * Keys are stored alone in a Robin Hood HashTable, without any mapped value, and can't be modified through iterators
+                 */
+                template <class Key, class Allocator, bool StoreHash = false, class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key>, class Mix = DefaultHashMix<Key, Hash>>
+                class UnorderedSet : public Stringable<UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>> {
+                    static_assert(Memory::IsAllocatorV<Allocator>);                    /**< Check if the given AllocatorType inherit from NRE::Memory::AllocatorTraits */
+                    static_assert(std::is_same_v<Key, typename Allocator::ValueType>);  /**< Make sure the allocator is set for the container inner type */
+
+                    private :   // Traits
+                        /** The internal table, storing keys only */
+                        using Table                 = HashTable<Key, void, Allocator, StoreHash, Hash, KeyEqual, Mix>;
+
+                    public :     // Traits
+                        /** The set key type */
+                        using KeyType               = Key;
+                        /** The container's allocated type */
+                        using ValueType             = Key;
+                        /** The container's allocator */
+                        using AllocatorType         = typename Table::AllocatorType;
+                        /** The object's size type */
+                        using SizeType              = typename Table::SizeType;
+                        /** The object's difference type */
+                        using DifferenceType        = typename Table::DifferenceType;
+                        /** The allocated type reference */
+                        using Reference             = typename Table::ConstReference;
+                        /** The allocated type const reference */
+                        using ConstReference        = typename Table::ConstReference;
+                        /** The allocated type pointer */
+                        using Pointer               = typename Table::ConstPointer;
+                        /** The allocated type const pointer */
+                        using ConstPointer          = typename Table::ConstPointer;
+                        /** Immuable forward access iterator, keys can't be modified in place */
+                        using Iterator              = typename Table::ConstIterator;
+                        /** Immuable forward access iterator */
+                        using ConstIterator         = typename Table::ConstIterator;
+                        /** Immuable local forward access iterator, keys can't be modified in place */
+                        using LocalIterator         = typename Table::ConstLocalIterator;
+                        /** Immuable local forward access iterator */
+                        using ConstLocalIterator    = typename Table::ConstLocalIterator;
+                        /** STL compatibility */
+                        using key_type              = KeyType;
+                        /** STL compatibility */
+                        using value_type            = ValueType;
+                        /** STL compatibility */
+                        using allocator_type        = AllocatorType;
+                        /** STL compatibility */
+                        using size_type             = SizeType;
+                        /** STL compatibility */
+                        using difference_type       = DifferenceType;
+                        /** STL compatibility */
+                        using reference             = Reference;
+                        /** STL compatibility */
+                        using const_reference       = ConstReference;
+                        /** STL compatibility */
+                        using pointer               = Pointer;
+                        /** STL compatibility */
+                        using const_pointer         = ConstPointer;
+                        /** STL compatibility */
+                        using iterator              = Iterator;
+                        /** STL compatibility */
+                        using const_iterator        = ConstIterator;
+                        /** STL compatibility */
+                        using local_iterator        = LocalIterator;
+                        /** STL compatibility */
+                        using const_local_iterator  = ConstLocalIterator;
+                        /** The set statistics snapshot */
+                        using Statistics            = HashTableInner::HashTableStatistics;
+                        /** The extracted element node */
+                        using NodeType              = HashTableInner::NodeHandle<Key, void>;
+
+                    private :   // Fields
+                         Table table; /**< The internal hash table */
+
+                    public :    // Methods
+                        //## Constructor ##//
+                            /**
+                             * Construct an empty set with a number of bucket
+                             * @param bucketCount the base bucket count
+                             * @param hasher      the hash function used in the set
+                             * @param equal       the equal function used in the set
+                             * @param alloc       the hashtable's memory allocator
+                             */
+                            UnorderedSet(SizeType bucketCount = Table::DEFAULT_BUCKET_COUNT, Hash const& hasher = Hash(), KeyEqual const& equal = KeyEqual(), Allocator const& alloc = Allocator());
+                            /**
+                             * Construct a set with a number of bucket and filled with elements in the given range
+                             * @param begin       the begin iterator
+                             * @param end         the end iterator
+                             * @param bucketCount the base bucket count
+                             * @param hasher      the hash function used in the set
+                             * @param equal       the equal function used in the set
+                             * @param alloc       the hashtable's memory allocator
+                             */
+                            template <class InputIterator>
+                            UnorderedSet(InputIterator begin, InputIterator end, SizeType bucketCount = Table::DEFAULT_BUCKET_COUNT, Hash const& hasher = Hash(), KeyEqual const& equal = KeyEqual(), Allocator const& alloc = Allocator());
+                            /**
+                             * Construct a set with a number of bucket and filled with elements in the given list
+                             * @param list        the list to fill the set with
+                             * @param bucketCount the base bucket count
+                             * @param hasher      the hash function used in the set
+                             * @param equal       the equal function used in the set
+                             * @param alloc       the hashtable's memory allocator
+                             */
+                            UnorderedSet(std::initializer_list<ValueType> list, SizeType bucketCount = Table::DEFAULT_BUCKET_COUNT, Hash const& hasher = Hash(), KeyEqual const& equal = KeyEqual(), Allocator const& alloc = Allocator());
+
+                        //## Copy Constructor ##//
+                            /**
+                             * Copy set into this
+                             * @param set   the set to copy
+                             * @param alloc the hashtable's memory allocator
+                             */
+                            UnorderedSet(UnorderedSet const& set, Allocator const& alloc = Allocator());
+
+                        //## Move Constructor ##//
+                            /**
+                             * Move set into this
+                             * @param set   the set to move
+                             * @param alloc the hashtable's memory allocator
+                             */
+                            UnorderedSet(UnorderedSet && set, Allocator const& alloc = Allocator());
+
+                        //## Getter ##//
+                            /**
+                             * @return the number of bucket
+                             */
+                            SizeType getBucketCount() const;
+                            /**
+                             * @return the maximum number of bucket
+                             */
+                            constexpr SizeType getMaxBucketCount() const;
+                            /**
+                             * @return the number of elements in the set
+                             */
+                            SizeType getSize() const;
+                            /**
+                             * @return the maximum load factor
+                             */
+                            float getMaxLoadFactor() const;
+                            /**
+                             * @return the minimum load factor, 0 if the set never shrinks on its own
+                             */
+                            float getMinLoadFactor() const;
+                            /**
+                             * @return the current load factor
+                             */
+                            float getLoadFactor() const;
+                            /**
+                             * @return the maximum set size
+                             */
+                            constexpr SizeType getMaxSize() const;
+                            /**
+                             * @return the hashtable's memory allocator
+                             */
+                            Allocator getAllocator() const;
+                            /**
+                             * @return if the set is empty
+                             */
+                            bool isEmpty() const;
+                            /**
+                             * Find the number of element with the given key
+                             * @param  k the key to search
+                             * @return   the number of corresponding elements
+                             */
+                            SizeType getCount(KeyType const& k) const;
+                            /**
+                             * Find the number of element with the given key, using its precomputed hash
+                             * @param  k         the key to search
+                             * @param  hashValue the key hash, computed with the set hash function
+                             * @return           the number of corresponding elements
+                             */
+                            SizeType getCount(KeyType const& k, SizeType hashValue) const;
+                            /**
+                             * Find the number of element with the given key, using its precomputed hash
+                             * @param  k the key to search with its hash
+                             * @return   the number of corresponding elements
+                             */
+                            SizeType getCount(HashedKey<KeyType> const& k) const;
+                            /**
+                             * Find the number of element with the given key, with any key comparable to KeyType when the hash and equal functions are transparent
+                             * @param  k the key to search
+                             * @return   the number of corresponding elements
+                             */
+                            template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                            SizeType getCount(K const& k) const;
+                            /**
+                             * Return the bucket corresponding to the given key
+                             * @param  k the key
+                             * @return   the corresponding bucket
+                             */
+                            SizeType getBucket(KeyType const& k) const;
+                            /**
+                             * @return the number of bytes used by the set, its buckets included
+                             */
+                            SizeType getMemoryUsage() const;
+                            /**
+                             * Take a snapshot of the set layout and event counters, events being counted only when NRE_USE_HASHTABLE_STATISTICS is defined
+                             * @return the set statistics
+                             */
+                            Statistics getStatistics() const;
+                            /**
+                             * @return if an incremental rehash is in progress
+                             */
+                            bool isRehashing() const;
+                            /**
+                             * @return the number of previous buckets moved at each insert or erase during an incremental rehash, 0 if the set grows in one go
+                             */
+                            SizeType getRehashStep() const;
+
+                        //## Setter ##//
+                            /**
+                             * Set the maximum load factor
+                             * @param factor the new factor
+                             */
+                            void setMaxLoadFactor(float factor);
+                            /**
+                             * Set the load factor under which erasing by key shrinks the set, 0 to never shrink, at most a quarter of the max load factor
+                             * @param factor the new factor
+                             */
+                            void setMinLoadFactor(float factor);
+                            /**
+                             * Set the number of previous buckets moved at each insert or erase when the set grows, 0 to grow in one go
+                             * @param step the new step
+                             */
+                            void setRehashStep(SizeType step);
+
+                        //## Iterator Access ##//
+                            /**
+                             * @return a const iterator on the first element
+                             */
+                            ConstIterator begin() const;
+                            /**
+                             * @return a const iterator on the first element
+                             */
+                            ConstIterator cbegin() const;
+                            /**
+                             * @return a const iterator on the end of the container
+                             */
+                            ConstIterator end() const;
+                            /**
+                             * @return a const iterator on the end of the container
+                             */
+                            ConstIterator cend() const;
+                            /**
+                             * Return a const local iterator on the first element of the given bucket
+                             * @param  index the bucket index
+                             * @return       the const local iterator
+                             */
+                            ConstLocalIterator begin(SizeType index) const;
+                            /**
+                             * Return a const local iterator on the first element of the given bucket
+                             * @param  index the bucket index
+                             * @return       the const local iterator
+                             */
+                            ConstLocalIterator cbegin(SizeType index) const;
+                            /**
+                             * Return a const local iterator on the end of the given bucket
+                             * @param  index the bucket index
+                             * @return       the const local iterator
+                             */
+                            ConstLocalIterator end(SizeType index) const;
+                            /**
+                             * Return a const local iterator on the end of the given bucket
+                             * @param  index the bucket index
+                             * @return       the const local iterator
+                             */
+                            ConstLocalIterator cend(SizeType index) const;
+
+                        //## Methods ##//
+                            /**
+                             * Insert a key in the set
+                             * @param  value the key to insert
+                             * @return       the iterator on the inserted element and if the insertion took place
+                             */
+                            Pair<Iterator, bool> insert(ValueType const& value);
+                            /**
+                             * Insert a key in the set
+                             * @param  value the key to insert
+                             * @return       the iterator on the inserted element and if the insertion took place
+                             */
+                            Pair<Iterator, bool> insert(ValueType && value);
+                            /**
+                             * Insert all keys in the given range
+                             * @param begin the range begin
+                             * @param end   the range end
+                             */
+                            template <class InputIterator>
+                            void insert(InputIterator begin, InputIterator end);
+                            /**
+                             * Insert keys in the given range from several threads, the result being the same as with insert
+                             * @param begin       the begin iterator
+                             * @param end         the end iterator
+                             * @param threadCount the number of threads, 0 to use the hardware concurrency
+                             */
+                            template <class RandomAccessIterator> requires Concept::RandomAccessIterator<RandomAccessIterator>
+                            void insertParallel(RandomAccessIterator begin, RandomAccessIterator end, SizeType threadCount = 0);
+                            /**
+                             * Insert all keys in the given list
+                             * @param list the list of keys to insert
+                             */
+                            void insert(std::initializer_list<ValueType> list);
+                            /**
+                             * Insert the key held by a node if its key is not already in the set, reusing the node stored hash when possible
+                             * @param  node the node to insert, left empty if the insertion has been done and untouched otherwise
+                             * @return      a pair containing an iterator on the key with the node key, and a boolean telling if the insertion has been done
+                             */
+                            Pair<Iterator, bool> insert(NodeType && node);
+                            /**
+                             * Emplace a key in the set
+                             * @param  args the key construction arguments
+                             * @return      the iterator on the inserted element and if the insertion took place
+                             */
+                            template <class ... Args>
+                            Pair<Iterator, bool> emplace(Args && ... args);
+                            /**
+                             * Clear all elements in the set
+                             */
+                            void clear();
+                            /**
+                             * Swap the set with the given one
+                             * @param set the other set
+                             */
+                            void swap(UnorderedSet& set);
+                            /**
+                             * Move every key of the given set whose key isn't in this set, without hashing keys again when the hash is stored
+                             * Keys with a key already in this set stay in the given one
+                             * @param set the set to take keys from
+                             */
+                            void merge(UnorderedSet& set);
+                            /**
+                             * Reserve enough bucket to hold count elements without growing and rehash the set
+                             * @param count the number of desired elements
+                             */
+                            void reserve(SizeType count);
+                            /**
+                             * Reserve at least count bucket in the set and rehash the set
+                             * @param count the number of desired bucket
+                             */
+                            void rehash(SizeType count);
+                            /**
+                             * Move every remaining previous bucket, ending the incremental rehash in progress if any
+                             */
+                            void finishRehash();
+                            /**
+                             * Shrink the bucket count to the smallest one holding the elements under the max load factor
+                             */
+                            void shrinkToFit();
+                            /**
+                             * Move back every displaced element to the closest free bucket after its home, ending the incremental rehash in progress if any
+                             */
+                            void compact();
+                            /**
+                             * Reset the event counters
+                             */
+                            void resetStatistics();
+                            /**
+                             * Write a binary snapshot of the set, a header followed by the raw bucket array
+                             * @param fd the destination file descriptor
+                             * @throw std::system_error if the write fails
+                             */
+                            void save(int fd) const requires Concept::MemCopyable<ValueType>;
+                            /**
+                             * Replace the set content with a snapshot, read in a single bulk read, elements being reinserted only if the hash seed or bucket placement version differs
+                             * @param fd the source file descriptor, positioned on the snapshot header
+                             * @throw std::system_error  if the read fails
+                             * @throw std::runtime_error if the snapshot is truncated, corrupted or written for another element type
+                             */
+                            void load(int fd) requires Concept::MemCopyable<ValueType>;
+                            /**
+                             * Replace the set content with a snapshot file, mapped in memory and copied in a single memcpy, elements being reinserted only if the hash seed or bucket placement version differs
+                             * @param path the snapshot file path
+                             * @throw std::system_error  if the file can't be opened or mapped
+                             * @throw std::runtime_error if the snapshot is truncated, corrupted or written for another element type
+                             */
+                            void mapFrom(const char* path) requires Concept::MemCopyable<ValueType>;
+                            /**
+                             * Find the element with the given key
+                             * @param  k the key to search
+                             * @return   the corresponding iterator or end if not found
+                             */
+                            ConstIterator find(KeyType const& k) const;
+                            /**
+                             * Find the element with the given key, using its precomputed hash
+                             * @param  k         the key to search
+                             * @param  hashValue the key hash, computed with the set hash function
+                             * @return           the corresponding iterator or end if not found
+                             */
+                            ConstIterator find(KeyType const& k, SizeType hashValue) const;
+                            /**
+                             * Find the element with the given key, using its precomputed hash
+                             * @param  k the key to search with its hash
+                             * @return   the corresponding iterator or end if not found
+                             */
+                            ConstIterator find(HashedKey<KeyType> const& k) const;
+                            /**
+                             * Find the element with the given key, with any key comparable to KeyType when the hash and equal functions are transparent
+                             * @param  k the key to search
+                             * @return   the corresponding iterator or end if not found
+                             */
+                            template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                            ConstIterator find(K const& k) const;
+                            /**
+                             * Find the elements with the given keys, hashing and prefetching a batch of keys ahead of the probes
+                             * @param keysBegin the first key to search
+                             * @param keysEnd   the end of the keys
+                             * @param out       the output receiving one iterator per key, end if not found
+                             */
+                            template <class ForwardIterator, class OutputIterator> requires Concept::ForwardIterator<ForwardIterator>
+                            void findBatch(ForwardIterator keysBegin, ForwardIterator keysEnd, OutputIterator out) const;
+                            /**
+                             * Erase an element in the set
+                             * @param  pos the element position
+                             * @return     an iterator on the next element
+                             */
+                            Iterator erase(ConstIterator pos);
+                            /**
+                             * Erase a range of elements in the set
+                             * @param  begin the first element to erase
+                             * @param  end   the end of the range
+                             * @return       an iterator on the element following the range
+                             */
+                            Iterator erase(ConstIterator begin, ConstIterator end);
+                            /**
+                             * Remove the key pointed by the iterator and return it in a node, with its stored hash
+                             * @param  pos the iterator on the extracted key
+                             * @return     the node holding the key
+                             */
+                            NodeType extract(ConstIterator pos);
+                            /**
+                             * Remove the key with the given key and return it in a node, with its stored hash
+                             * @param  k the key of the extracted key
+                             * @return   the node holding the key, empty if the key isn't in the set
+                             */
+                            NodeType extract(KeyType const& k);
+                            /**
+                             * Erase the element with the given key
+                             * @param  k the key of the element to erase
+                             * @return   the number of erased elements
+                             */
+                            SizeType erase(KeyType const& k);
+                            /**
+                             * Erase the element with the given key, using its precomputed hash
+                             * @param  k         the key of the element to erase
+                             * @param  hashValue the key hash, computed with the set hash function
+                             * @return           the number of erased elements
+                             */
+                            SizeType erase(KeyType const& k, SizeType hashValue);
+                            /**
+                             * Erase the element with the given key, using its precomputed hash
+                             * @param  k the key of the element to erase with its hash
+                             * @return   the number of erased elements
+                             */
+                            SizeType erase(HashedKey<KeyType> const& k);
+                            /**
+                             * Erase the element with the given key, with any key comparable to KeyType when the hash and equal functions are transparent
+                             * @param  k the key of the element to erase
+                             * @return   the number of erased elements
+                             */
+                            template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                            SizeType erase(K const& k);
+                            /**
+                             * Insert in this every key of the given set, the union of both sets
+                             * @param set the other set
+                             */
+                            void unite(UnorderedSet const& set);
+                            /**
+                             * Keep in this only the keys also in the given set, the intersection of both sets
+                             * @param set the other set
+                             */
+                            void intersect(UnorderedSet const& set);
+                            /**
+                             * Erase from this every key of the given set, the difference of both sets
+                             * @param set the other set
+                             */
+                            void subtract(UnorderedSet const& set);
+                            /**
+                             * Test if every key of this is in the given set
+                             * @param  set the other set
+                             * @return     if this is a subset of the given set
+                             */
+                            bool isSubsetOf(UnorderedSet const& set) const;
+                            /**
+                             * @return the set's hash function
+                             */
+                            Hash getHash() const;
+                            /**
+                             * @return the set's key equal function
+                             */
+                            KeyEqual getKeyEqual() const;
+
+                        //## Assignment Operator ##//
+                            /**
+                             * Copy set into this
+                             * @param set the set to copy into this
+                             * @return    the reference of himself
+                             */
+                            UnorderedSet& operator =(UnorderedSet const& set);
+                            /**
+                             * Move set into this
+                             * @param set the set to move into this
+                             * @return    the reference of himself
+                             */
+                            UnorderedSet& operator =(UnorderedSet && set);
+
+                        //## Comparison Operator ##//
+                            /**
+                             * Equality test between this and set
+                             * @param set the other set
+                             * @return    the test's result
+                             */
+                            bool operator ==(UnorderedSet const& set) const;
+                            /**
+                             * Inequality test between this and set
+                             * @param set the other set
+                             * @return    the test's result
+                             */
+                            bool operator !=(UnorderedSet const& set) const;
+
+                        //## Stream Operator ##//
+                            /**
+                             * Convert the set into a string
+                             * @return the converted set
+                             */
+                            [[nodiscard]] String toString() const;
+                            /**
+                             * Append the set's textual form to out, reserving the estimated size once
+                             * @param out the string to append to
+                             */
+                            void toString(String& out) const;
+                            /**
+                             * @return an upper estimate of the textual form size
+                             */
+                            std::size_t estimateStringSize() const;
+                            /**
+                             * Write the set's textual form into the given sink
+                             * @param sink the destination sink
+                             */
+                            template <class S>
+                            void writeTo(S& sink) const;
+
+                    private :   // Methods
+                        /**
+                         * Convert a table iterator into a set iterator
+                         * @param  it the table iterator
+                         * @return    the corresponding immuable iterator
+                         */
+                        static ConstIterator toConstIterator(typename Table::Iterator it);
+                };
+            }
+        }
+    }
+
+    #include "NRE_UnorderedSet.tpp"
@@ -0,0 +1,471 @@
+
+    /**
+     * @file NRE_UnorderedSet.tpp
+     * @brief Implementation of Core's API's Container : UnorderedSet
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+     namespace NRE {
+         namespace Core {
+             namespace Detail {
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::UnorderedSet(SizeType bucketCount, Hash const& hasher, KeyEqual const& equal, Allocator const& alloc) : table(bucketCount, hasher, equal, alloc) {
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class InputIterator>
+                 inline UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::UnorderedSet(InputIterator begin, InputIterator end, SizeType bucketCount, Hash const& hasher, KeyEqual const& equal, Allocator const& alloc) : table(begin, end, bucketCount, hasher, equal, alloc) {
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::UnorderedSet(std::initializer_list<ValueType> list, SizeType bucketCount, Hash const& hasher, KeyEqual const& equal, Allocator const& alloc) : table(list, bucketCount, hasher, equal, alloc) {
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::UnorderedSet(UnorderedSet const& set, Allocator const& alloc) : table(set.table, alloc) {
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::UnorderedSet(UnorderedSet && set, Allocator const& alloc) : table(std::move(set.table), alloc) {
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::getBucketCount() const {
+                     return table.getBucketCount();
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 constexpr typename UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::getMaxBucketCount() const {
+                     return table.getMaxBucketCount();
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::getSize() const {
+                     return table.getSize();
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline float UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::getMaxLoadFactor() const {
+                     return table.getMaxLoadFactor();
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline float UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::getMinLoadFactor() const {
+                     return table.getMinLoadFactor();
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline float UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::getLoadFactor() const {
+                     return table.getLoadFactor();
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 constexpr typename UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::getMaxSize() const {
+                     return table.getMaxSize();
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline Allocator UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::getAllocator() const {
+                     return table.getAllocator();
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline bool UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::isEmpty() const {
+                     return table.isEmpty();
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::getCount(KeyType const& k) const {
+                     return table.getCount(k);
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::getCount(KeyType const& k, SizeType hashValue) const {
+                     return table.getCount(k, hashValue);
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::getCount(HashedKey<KeyType> const& k) const {
+                     return table.getCount(k);
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                 inline typename UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::getCount(K const& k) const {
+                     return table.getCount(k);
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::getBucket(KeyType const& k) const {
+                     return table.getBucket(k);
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::getMemoryUsage() const {
+                     return table.getMemoryUsage();
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::Statistics UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::getStatistics() const {
+                     return table.getStatistics();
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline bool UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::isRehashing() const {
+                     return table.isRehashing();
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::getRehashStep() const {
+                     return table.getRehashStep();
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::setMaxLoadFactor(float factor) {
+                     table.setMaxLoadFactor(factor);
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::setMinLoadFactor(float factor) {
+                     table.setMinLoadFactor(factor);
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::setRehashStep(SizeType step) {
+                     table.setRehashStep(step);
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConstIterator UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::begin() const {
+                     return table.begin();
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConstIterator UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::cbegin() const {
+                     return table.cbegin();
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConstIterator UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::end() const {
+                     return table.end();
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConstIterator UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::cend() const {
+                     return table.cend();
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConstLocalIterator UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::begin(SizeType index) const {
+                     return table.begin(index);
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConstLocalIterator UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::cbegin(SizeType index) const {
+                     return table.cbegin(index);
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConstLocalIterator UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::end(SizeType index) const {
+                     return table.end(index);
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConstLocalIterator UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::cend(SizeType index) const {
+                     return table.cend(index);
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline Pair<typename UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator, bool> UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::insert(ValueType const& value) {
+                     auto res = table.insert(value);
+                     return Pair<Iterator, bool>(toConstIterator(res.first), res.second);
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline Pair<typename UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator, bool> UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::insert(ValueType&& value) {
+                     auto res = table.insert(std::move(value));
+                     return Pair<Iterator, bool>(toConstIterator(res.first), res.second);
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class InputIterator>
+                 inline void UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::insert(InputIterator begin, InputIterator end) {
+                     table.insert(begin, end);
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class RandomAccessIterator> requires Concept::RandomAccessIterator<RandomAccessIterator>
+                 inline void UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::insertParallel(RandomAccessIterator begin, RandomAccessIterator end, SizeType threadCount) {
+                     table.insertParallel(begin, end, threadCount);
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::insert(std::initializer_list<ValueType> list) {
+                     table.insert(list);
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline Pair<typename UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator, bool> UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::insert(NodeType && node) {
+                     Pair<typename Table::Iterator, bool> res = table.insert(std::move(node));
+                     return Pair<Iterator, bool>(toConstIterator(res.first), res.second);
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class ... Args>
+                 inline Pair<typename UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator, bool> UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::emplace(Args&& ... args) {
+                     auto res = table.emplace(std::forward<Args>(args)...);
+                     return Pair<Iterator, bool>(toConstIterator(res.first), res.second);
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::clear() {
+                     table.clear();
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::swap(UnorderedSet& set) {
+                     table.swap(set.table);
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::merge(UnorderedSet& set) {
+                     table.merge(set.table);
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::reserve(SizeType count) {
+                     table.reserve(count);
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::rehash(SizeType count) {
+                     table.rehash(count);
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::finishRehash() {
+                     table.finishRehash();
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::shrinkToFit() {
+                     table.shrinkToFit();
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::compact() {
+                     table.compact();
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::resetStatistics() {
+                     table.resetStatistics();
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::save(int fd) const requires Concept::MemCopyable<ValueType> {
+                     table.save(fd);
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::load(int fd) requires Concept::MemCopyable<ValueType> {
+                     table.load(fd);
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::mapFrom(const char* path) requires Concept::MemCopyable<ValueType> {
+                     table.mapFrom(path);
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConstIterator UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::find(KeyType const& k) const {
+                     return table.find(k);
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConstIterator UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::find(KeyType const& k, SizeType hashValue) const {
+                     return table.find(k, hashValue);
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConstIterator UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::find(HashedKey<KeyType> const& k) const {
+                     return table.find(k);
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                 inline typename UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConstIterator UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::find(K const& k) const {
+                     return table.find(k);
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class ForwardIterator, class OutputIterator> requires Concept::ForwardIterator<ForwardIterator>
+                 inline void UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::findBatch(ForwardIterator keysBegin, ForwardIterator keysEnd, OutputIterator out) const {
+                     table.findBatch(keysBegin, keysEnd, out);
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::erase(ConstIterator pos) {
+                     return toConstIterator(table.erase(pos));
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::Iterator UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::erase(ConstIterator begin, ConstIterator end) {
+                     return toConstIterator(table.erase(begin, end));
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::NodeType UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::extract(ConstIterator pos) {
+                     return table.extract(pos);
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::NodeType UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::extract(KeyType const& k) {
+                     return table.extract(k);
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::erase(KeyType const& k) {
+                     return table.erase(k);
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::erase(KeyType const& k, SizeType hashValue) {
+                     return table.erase(k, hashValue);
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::erase(HashedKey<KeyType> const& k) {
+                     return table.erase(k);
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class K> requires Concept::Transparent<Hash> && Concept::Transparent<KeyEqual>
+                 inline typename UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::SizeType UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::erase(K const& k) {
+                     return table.erase(k);
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::unite(UnorderedSet const& set) {
+                     if (this == &set) {
+                         return;
+                     }
+                     for (KeyType const& k : set) {
+                         table.insert(k);
+                     }
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::intersect(UnorderedSet const& set) {
+                     if (this == &set) {
+                         return;
+                     }
+                     ConstIterator it = begin();
+                     while (it != end()) {
+                         if (set.getCount(*it) == 0) {
+                             it = erase(it);
+                         } else {
+                             ++it;
+                         }
+                     }
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::subtract(UnorderedSet const& set) {
+                     if (this == &set) {
+                         clear();
+                         return;
+                     }
+                     if (set.getSize() < getSize()) {
+                         for (KeyType const& k : set) {
+                             table.erase(k);
+                         }
+                     } else {
+                         ConstIterator it = begin();
+                         while (it != end()) {
+                             if (set.getCount(*it) != 0) {
+                                 it = erase(it);
+                             } else {
+                                 ++it;
+                             }
+                         }
+                     }
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline bool UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::isSubsetOf(UnorderedSet const& set) const {
+                     if (getSize() > set.getSize()) {
+                         return false;
+                     }
+                     for (KeyType const& k : *this) {
+                         if (set.getCount(k) == 0) {
+                             return false;
+                         }
+                     }
+                     return true;
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline Hash UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::getHash() const {
+                     return table.getHash();
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline KeyEqual UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::getKeyEqual() const {
+                     return table.getKeyEqual();
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>& UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::operator =(UnorderedSet const& set) {
+                     table = set.table;
+                     return *this;
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>& UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::operator =(UnorderedSet&& set) {
+                     table = std::move(set.table);
+                     return *this;
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline bool UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::operator ==(UnorderedSet const& set) const {
+                     return getSize() == set.getSize() && isSubsetOf(set);
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline bool UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::operator !=(UnorderedSet const& set) const {
+                     return !(*this == set);
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline String UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::toString() const {
+                     return table.toString();
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline void UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::toString(String& out) const {
+                     table.toString(out);
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline std::size_t UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::estimateStringSize() const {
+                     return table.estimateStringSize();
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 template <class S>
+                 inline void UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::writeTo(S& sink) const {
+                     table.writeTo(sink);
+                 }
+
+                 template <class Key, class Allocator, bool StoreHash, class Hash, class KeyEqual, class Mix>
+                 inline typename UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::ConstIterator UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>::toConstIterator(typename Table::Iterator it) {
+                     return ConstIterator(it);
+                 }
+
+             }
+         }
+     }
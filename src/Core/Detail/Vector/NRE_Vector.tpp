@@ -413,20 +413,39 @@
     
                  template <class T, class Allocator>
                  inline String Vector<T, Allocator>::toString() const {
-                     if (isEmpty()) {
-                         String res;
-                         res << '[' << ']';
-                         return res;
-                     } else {
-                         String res;
-                         res << '[' << data[0];
-                         res.reserve((res.getSize() + 2) * length);
+                     String res;
+                     toString(res);
+                     return res;
+                 }
+
+                 template <class T, class Allocator>
+                 inline void Vector<T, Allocator>::toString(String& out) const {
+                     out.reserve(out.getSize() + estimateStringSize());
+                     StringSink sink(out);
+                     writeTo(sink);
+                 }
+
+                 template <class T, class Allocator>
+                 template <class S>
+                 inline void Vector<T, Allocator>::writeTo(S& sink) const {
+                     sink.write("[", 1);
+                     if (!isEmpty()) {
+                         Core::format(sink, data[0]);
                          for (SizeType index = 1; index < length; index++) {
-                             res << ',' << ' ' << data[index];
+                             sink.write(", ", 2);
+                             Core::format(sink, data[index]);
                          }
-                         res << ']';
-                         return res;
                      }
+                     sink.write("]", 1);
+                 }
+
+                 template <class T, class Allocator>
+                 inline std::size_t Vector<T, Allocator>::estimateStringSize() const {
+                     std::size_t size = (isEmpty()) ? (2) : (2 * length);
+                     for (SizeType index = 0; index < length; index++) {
+                         size += Core::estimateStringSize(data[index]);
+                     }
+                     return size;
                  }
     
                  template <class T, class Allocator>
@@ -0,0 +1,92 @@
+
+    /**
+     * @file NRE_Hash.hpp
+     * @brief Declaration of Core's API's Object : Hash
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+     #pragma once
+
+     #include <cstddef>
+     #include <cstdint>
+     #include <cstring>
+     #include <bit>
+     #include <type_traits>
+
+     /**
+     * @namespace NRE
+     * @brief The NearlyRealEngine's global namespace
+     */
+    namespace NRE {
+        /**
+         * @namespace Core
+         * @brief Core's API
+         */
+        namespace Core {
+
+            /**
+             * Hash a raw byte range, wyhash algorithm : 48 bytes per round for long inputs and
+             * at most two overlapping loads for inputs up to 16 bytes
+             * @param data   the first byte
+             * @param length the number of bytes
+             * @param seed   the hash seed, use a per table random seed to resist hash flooding
+             * @return       the computed hash
+             */
+            std::uint64_t hashBytes(const void* data, std::size_t length, std::uint64_t seed = 0);
+            /**
+             * Hash a character range, usable in constant expressions and equal to hashBytes on the same bytes
+             * @param data   the first character
+             * @param length the number of characters
+             * @param seed   the hash seed
+             * @return       the computed hash
+             */
+            constexpr std::uint64_t hashString(const char* data, std::size_t length, std::uint64_t seed = 0);
+
+            namespace HashInner {
+                /** The wyhash default secret */
+                constexpr std::uint64_t SECRET[4] = {0x2d358dccaa6c78a5ULL, 0x8bb84b93962eacc9ULL, 0x4b33a62ed433d4a3ULL, 0x4d5a2da51de1aa47ULL};
+
+                /**
+                 * Compute the full 128 bits product of a and b
+                 * @param a the first factor, receive the low 64 bits
+                 * @param b the second factor, receive the high 64 bits
+                 */
+                constexpr void multiply(std::uint64_t& a, std::uint64_t& b);
+                /**
+                 * Fold the 128 bits product of a and b into 64 bits
+                 * @param a the first factor
+                 * @param b the second factor
+                 * @return  the folded product
+                 */
+                constexpr std::uint64_t mix(std::uint64_t a, std::uint64_t b);
+                /**
+                 * Read bytes as a little endian value, byte by byte in constant evaluation
+                 * @param p the first byte
+                 * @return  the read value
+                 */
+                template <class V, class T>
+                constexpr std::uint64_t read(const T* p);
+                /**
+                 * Read 1 to 3 bytes, first, middle and last
+                 * @param p the first byte
+                 * @param k the number of bytes
+                 * @return  the read value
+                 */
+                template <class T>
+                constexpr std::uint64_t read3(const T* p, std::size_t k);
+                /**
+                 * The hash algorithm on any byte sized character type
+                 * @param p      the first byte
+                 * @param length the number of bytes
+                 * @param seed   the hash seed
+                 * @return       the computed hash
+                 */
+                template <class T>
+                constexpr std::uint64_t hash(const T* p, std::size_t length, std::uint64_t seed);
+            }
+        }
+    }
+
+    #include "NRE_Hash.tpp"
@@ -0,0 +1,109 @@
+
+    /**
+     * @file NRE_Hash.tpp
+     * @brief Implementation of Core's API's Object : Hash
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+     namespace NRE {
+         namespace Core {
+             namespace HashInner {
+
+                 constexpr void multiply(std::uint64_t& a, std::uint64_t& b) {
+                     #ifdef __SIZEOF_INT128__
+                         __uint128_t r = a;
+                         r *= b;
+                         a = static_cast <std::uint64_t> (r);
+                         b = static_cast <std::uint64_t> (r >> 64);
+                     #else
+                         std::uint64_t ha = a >> 32, hb = b >> 32, la = static_cast <std::uint32_t> (a), lb = static_cast <std::uint32_t> (b);
+                         std::uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+                         std::uint64_t t = rl + (rm0 << 32);
+                         std::uint64_t c = (t < rl) ? (1) : (0);
+                         std::uint64_t lo = t + (rm1 << 32);
+                         c += (lo < t) ? (1) : (0);
+                         a = lo;
+                         b = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+                     #endif
+                 }
+
+                 constexpr std::uint64_t mix(std::uint64_t a, std::uint64_t b) {
+                     multiply(a, b);
+                     return a ^ b;
+                 }
+
+                 template <class V, class T>
+                 constexpr std::uint64_t read(const T* p) {
+                     static_assert(sizeof(T) == 1, "NRE::Core::hash only read byte sized characters");
+                     if (std::is_constant_evaluated() || std::endian::native != std::endian::little) {
+                         std::uint64_t v = 0;
+                         for (std::size_t i = 0; i < sizeof(V); i++) {
+                             v |= static_cast <std::uint64_t> (static_cast <unsigned char> (p[i])) << (8 * i);
+                         }
+                         return v;
+                     } else {
+                         V v;
+                         std::memcpy(&v, p, sizeof(V));
+                         return v;
+                     }
+                 }
+
+                 template <class T>
+                 constexpr std::uint64_t read3(const T* p, std::size_t k) {
+                     return (static_cast <std::uint64_t> (static_cast <unsigned char> (p[0])) << 16)
+                          | (static_cast <std::uint64_t> (static_cast <unsigned char> (p[k >> 1])) << 8)
+                          | static_cast <unsigned char> (p[k - 1]);
+                 }
+
+                 template <class T>
+                 constexpr std::uint64_t hash(const T* p, std::size_t length, std::uint64_t seed) {
+                     seed ^= mix(seed ^ SECRET[0], SECRET[1]);
+                     std::uint64_t a = 0, b = 0;
+                     if (length <= 16) [[likely]] {
+                         if (length >= 4) [[likely]] {
+                             // Two overlapping reads cover any length between 4 and 16
+                             a = (read<std::uint32_t>(p) << 32) | read<std::uint32_t>(p + ((length >> 3) << 2));
+                             b = (read<std::uint32_t>(p + length - 4) << 32) | read<std::uint32_t>(p + length - 4 - ((length >> 3) << 2));
+                         } else if (length > 0) [[likely]] {
+                             a = read3(p, length);
+                         }
+                     } else {
+                         std::size_t i = length;
+                         if (i >= 48) [[unlikely]] {
+                             // Three independent lanes to keep the multipliers busy
+                             std::uint64_t see1 = seed, see2 = seed;
+                             do {
+                                 seed = mix(read<std::uint64_t>(p) ^ SECRET[1], read<std::uint64_t>(p + 8) ^ seed);
+                                 see1 = mix(read<std::uint64_t>(p + 16) ^ SECRET[2], read<std::uint64_t>(p + 24) ^ see1);
+                                 see2 = mix(read<std::uint64_t>(p + 32) ^ SECRET[3], read<std::uint64_t>(p + 40) ^ see2);
+                                 p += 48;
+                                 i -= 48;
+                             } while (i >= 48);
+                             seed ^= see1 ^ see2;
+                         }
+                         while (i > 16) {
+                             seed = mix(read<std::uint64_t>(p) ^ SECRET[1], read<std::uint64_t>(p + 8) ^ seed);
+                             i -= 16;
+                             p += 16;
+                         }
+                         a = read<std::uint64_t>(p + i - 16);
+                         b = read<std::uint64_t>(p + i - 8);
+                     }
+                     a ^= SECRET[1];
+                     b ^= seed;
+                     multiply(a, b);
+                     return mix(a ^ SECRET[0] ^ length, b ^ SECRET[1]);
+                 }
+             }
+
+             inline std::uint64_t hashBytes(const void* data, std::size_t length, std::uint64_t seed) {
+                 return HashInner::hash(static_cast <const unsigned char*> (data), length, seed);
+             }
+
+             constexpr std::uint64_t hashString(const char* data, std::size_t length, std::uint64_t seed) {
+                 return HashInner::hash(data, length, seed);
+             }
+         }
+     }
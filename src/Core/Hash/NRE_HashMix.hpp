@@ -0,0 +1,76 @@
+    /**
+     * @file NRE_HashMix.hpp
+     * @brief Declaration of Core's API's Object : HashMix
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+     #pragma once
+
+     #include <cstddef>
+     #include <cstdint>
+     #include <functional>
+     #include <type_traits>
+
+     /**
+     * @namespace NRE
+     * @brief The NearlyRealEngine's global namespace
+     */
+    namespace NRE {
+        /**
+         * @namespace Core
+         * @brief Core's API
+         */
+        namespace Core {
+
+            /**
+             * @class IdentityMix
+             * @brief Hash finalizer policy leaving the hash untouched, for hash functions already spreading their low bits
+             */
+            class IdentityMix {
+                public :    // Static
+                    /**
+                     * @param h the hash to finalize
+                     * @return  the same hash
+                     */
+                    static constexpr std::size_t mix(std::size_t h);
+            };
+
+            /**
+             * @class FibonacciMix
+             * @brief Hash finalizer policy multiplying by 2^64 / phi then folding the high half in the low one
+             * Cheap, enough for keys differing by regular strides
+             */
+            class FibonacciMix {
+                public :    // Static
+                    /**
+                     * @param h the hash to finalize
+                     * @return  the finalized hash
+                     */
+                    static constexpr std::size_t mix(std::size_t h);
+            };
+
+            /**
+             * @class XorShiftMix
+             * @brief Hash finalizer policy using the splitmix64 xor-shift multiply sequence, every input bit affects every output bit
+             */
+            class XorShiftMix {
+                public :    // Static
+                    /**
+                     * @param h the hash to finalize
+                     * @return  the finalized hash
+                     */
+                    static constexpr std::size_t mix(std::size_t h);
+            };
+
+            /**
+             * Select the default finalizer for a hash table : identity hashes of arithmetic, enum and pointer keys are mixed
+             * as the table masks the hash low bits, any other hash is trusted as is
+             */
+            template <class Key, class Hash>
+            using DefaultHashMix = std::conditional_t<(std::is_arithmetic_v<Key> || std::is_enum_v<Key> || std::is_pointer_v<Key>) && std::is_same_v<Hash, std::hash<Key>>, XorShiftMix, IdentityMix>;
+        }
+    }
+
+    #include "NRE_HashMix.tpp"
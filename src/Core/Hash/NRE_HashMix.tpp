@@ -0,0 +1,29 @@
+
+    /**
+     * @file NRE_HashMix.tpp
+     * @brief Implementation of Core's API's Object : HashMix
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+     namespace NRE {
+         namespace Core {
+
+             constexpr std::size_t IdentityMix::mix(std::size_t h) {
+                 return h;
+             }
+
+             constexpr std::size_t FibonacciMix::mix(std::size_t h) {
+                 std::uint64_t x = static_cast <std::uint64_t> (h) * 0x9E3779B97F4A7C15ULL;
+                 return static_cast <std::size_t> (x ^ (x >> 32));
+             }
+
+             constexpr std::size_t XorShiftMix::mix(std::size_t h) {
+                 std::uint64_t x = static_cast <std::uint64_t> (h);
+                 x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+                 x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+                 return static_cast <std::size_t> (x ^ (x >> 31));
+             }
+         }
+     }
@@ -0,0 +1,82 @@
+    /**
+     * @file NRE_HashedKey.hpp
+     * @brief Declaration of Core's API's Object : HashedKey
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+     #pragma once
+
+     #include <cstddef>
+     #include <type_traits>
+
+     /**
+     * @namespace NRE
+     * @brief The NearlyRealEngine's global namespace
+     */
+    namespace NRE {
+        /**
+         * @namespace Core
+         * @brief Core's API
+         */
+        namespace Core {
+
+            /**
+             * @class HashedKey
+             * @brief Reference a key along with its precomputed hash, to look it up in several tables without hashing it again
+             * The hash must come from the same hash function as the queried tables, the key must outlive the object
+             */
+            template <class K>
+            class HashedKey {
+                public :    // Traits
+                    /** The referenced key type */
+                    using KeyType = K;
+
+                private :   // Fields
+                    const KeyType* key; /**< The referenced key */
+                    std::size_t hash;   /**< The key hash */
+
+                public :    // Methods
+                    //## Constructor ##//
+                        /**
+                         * No default constructor
+                         */
+                        HashedKey() = delete;
+                        /**
+                         * Construct the object from a key and its already known hash
+                         * @param k the referenced key
+                         * @param h the key hash
+                         */
+                        HashedKey(KeyType const& k, std::size_t h);
+                        /**
+                         * Construct the object by hashing the key with the given hash function
+                         * @param k      the referenced key
+                         * @param hasher the hash function, the same used by the queried tables
+                         */
+                        template <class Hash> requires std::is_invocable_r_v<std::size_t, Hash const&, K const&>
+                        HashedKey(KeyType const& k, Hash const& hasher);
+                        /**
+                         * Refuse temporary keys, the object would outlive them
+                         */
+                        HashedKey(KeyType && k, std::size_t h) = delete;
+                        /**
+                         * Refuse temporary keys, the object would outlive them
+                         */
+                        template <class Hash>
+                        HashedKey(KeyType && k, Hash const& hasher) = delete;
+
+                    //## Getter ##//
+                        /**
+                         * @return the referenced key
+                         */
+                        KeyType const& getKey() const;
+                        /**
+                         * @return the key hash
+                         */
+                        std::size_t getHash() const;
+            };
+        }
+    }
+
+    #include "NRE_HashedKey.tpp"
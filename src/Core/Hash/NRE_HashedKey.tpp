@@ -0,0 +1,32 @@
+
+    /**
+     * @file NRE_HashedKey.tpp
+     * @brief Implementation of Core's API's Object : HashedKey
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+     namespace NRE {
+         namespace Core {
+
+             template <class K>
+             inline HashedKey<K>::HashedKey(KeyType const& k, std::size_t h) : key(&k), hash(h) {
+             }
+
+             template <class K>
+             template <class Hash> requires std::is_invocable_r_v<std::size_t, Hash const&, K const&>
+             inline HashedKey<K>::HashedKey(KeyType const& k, Hash const& hasher) : key(&k), hash(hasher(k)) {
+             }
+
+             template <class K>
+             inline typename HashedKey<K>::KeyType const& HashedKey<K>::getKey() const {
+                 return *key;
+             }
+
+             template <class K>
+             inline std::size_t HashedKey<K>::getHash() const {
+                 return hash;
+             }
+         }
+     }
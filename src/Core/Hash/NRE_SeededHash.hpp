@@ -0,0 +1,73 @@
+
+    /**
+     * @file NRE_SeededHash.hpp
+     * @brief Declaration of Core's API's Object : SeededHash
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+     #pragma once
+
+     #include <atomic>
+     #include <random>
+     #include <type_traits>
+
+     #include "NRE_Hash.hpp"
+     #include "../String/NRE_String.hpp"
+
+     /**
+     * @namespace NRE
+     * @brief The NearlyRealEngine's global namespace
+     */
+    namespace NRE {
+        /**
+         * @namespace Core
+         * @brief Core's API
+         */
+        namespace Core {
+
+            /**
+             * @class SeededHash
+             * @brief Hash functor carrying its own seed, to give each table a different hash function
+             * Work for string like keys (convertible to StringView) and keys with unique object representation
+             */
+            template <class K>
+            class SeededHash {
+                static_assert(std::is_convertible_v<K const&, StringView> || std::has_unique_object_representations_v<K>, "NRE::Core::SeededHash need a string like key or a key hashable by its bytes");
+
+                private :   // Fields
+                    std::uint64_t seed; /**< The hash seed */
+
+                public :    // Methods
+                    //## Constructor ##//
+                        /**
+                         * Construct the functor with the given seed
+                         * @param s the hash seed
+                         */
+                        SeededHash(std::uint64_t s = 0);
+
+                    //## Getter ##//
+                        /**
+                         * @return the hash seed
+                         */
+                        std::uint64_t getSeed() const;
+
+                    //## Methods ##//
+                        /**
+                         * Compute the seeded hash of the given key
+                         * @param k the key to hash
+                         * @return  the computed hash
+                         */
+                        std::size_t operator()(K const& k) const;
+
+                public :    // Static
+                    /**
+                     * @return a new functor with an unpredictable seed, different at each call
+                     */
+                    static SeededHash withRandomSeed();
+            };
+        }
+    }
+
+    #include "NRE_SeededHash.tpp"
@@ -0,0 +1,41 @@
+
+    /**
+     * @file NRE_SeededHash.tpp
+     * @brief Implementation of Core's API's Object : SeededHash
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+     namespace NRE {
+         namespace Core {
+
+             template <class K>
+             inline SeededHash<K>::SeededHash(std::uint64_t s) : seed(s) {
+             }
+
+             template <class K>
+             inline std::uint64_t SeededHash<K>::getSeed() const {
+                 return seed;
+             }
+
+             template <class K>
+             inline std::size_t SeededHash<K>::operator()(K const& k) const {
+                 if constexpr (std::is_convertible_v<K const&, StringView>) {
+                     StringView view(k);
+                     return static_cast <std::size_t> (hashBytes(view.getData(), view.getSize(), seed));
+                 } else {
+                     return static_cast <std::size_t> (hashBytes(&k, sizeof(K), seed));
+                 }
+             }
+
+             template <class K>
+             inline SeededHash<K> SeededHash<K>::withRandomSeed() {
+                 // Draw the entropy once, then derive a distinct seed per call
+                 static const std::uint64_t base = (static_cast <std::uint64_t> (std::random_device()()) << 32) ^ std::random_device()();
+                 static std::atomic<std::uint64_t> counter(0);
+                 std::uint64_t index = counter.fetch_add(1, std::memory_order_relaxed);
+                 return SeededHash(HashInner::mix(base ^ HashInner::SECRET[0], index ^ HashInner::SECRET[1]));
+             }
+         }
+     }
@@ -0,0 +1,30 @@
+    
+    /**
+     * @file Core/IndexMap/NRE_IndexMap.hpp
+     * @brief Declaration of Core's API's Container : IndexMap
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+    
+    #pragma once
+    
+    #include <Memory/Allocator/NRE_Allocator.hpp>
+    #include "../Detail/IndexMap/NRE_IndexMap.hpp"
+    
+    /**
+    * @namespace NRE
+    * @brief The NearlyRealEngine's global namespace
+    */
+    namespace NRE {
+        /**
+         * @namespace Core
+         * @brief Core's API
+         */
+        namespace Core {
+    
+            /** Hide IndexMap detail implementation and provide default allocator */
+            template <class Key, class T, class Allocator = Memory::Allocator<Pair<Key, T>>, class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key>, class Mix = DefaultHashMix<Key, Hash>>
+            using IndexMap = Detail::IndexMap<Key, T, Allocator, Hash, KeyEqual, Mix>;
+        }
+    }
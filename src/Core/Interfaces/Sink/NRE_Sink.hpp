@@ -0,0 +1,63 @@
+
+    /**
+     * @file NRE_Sink.hpp
+     * @brief Declaration of Core's API's Interface : Sink
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+     #pragma once
+
+     #include <charconv>
+     #include <cstdio>
+     #include <string>
+     #include <type_traits>
+
+     #include "../NRE_StaticInterface.hpp"
+     #include "../../String/NRE_String.hpp"
+
+    /**
+     * @namespace NRE
+     * @brief The NearlyRealEngine's global namespace
+     */
+    namespace NRE {
+        /**
+         * @namespace Core
+         * @brief Core's API
+         */
+        namespace Core {
+
+            template<class> class Stringable;
+
+            /**
+             * @class Sink
+             * @brief Describe a character output, objects format themselves straight into it through writeTo(Sink&)
+             *
+             * A sink T must provide write(const char*, std::size_t) and flush()
+             */
+            template <class T>
+            class Sink : public StaticInterface<Sink<T>> {
+                public:    // Methods
+                    //## Stream Operator ##//
+                        /**
+                         * Format the object into the sink
+                         * @param o the object to format
+                         * @return  the reference of the sink
+                         */
+                        template <class K>
+                        T& operator <<(K const& o);
+            };
+
+            /**
+             * Format the given object into the sink, with the same representation as String::append
+             * Objects providing writeTo(Sink&) format themselves, other Stringable go through toString()
+             * @param sink the sink to write into
+             * @param o    the object to format
+             */
+            template <class S, class K>
+            void format(S& sink, K const& o);
+        }
+    }
+
+    #include "NRE_Sink.tpp"
@@ -0,0 +1,60 @@
+
+    /**
+     * @file NRE_Sink.tpp
+     * @brief Implementation of Core's API's Interface : Sink
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+     namespace NRE {
+         namespace Core {
+
+             template <class T>
+             template <class K>
+             inline T& Sink<T>::operator <<(K const& o) {
+                 format(this->impl(), o);
+                 return this->impl();
+             }
+
+             template <class S, class K>
+             inline void format(S& sink, K const& o) {
+                 if constexpr (requires { o.writeTo(sink); }) {
+                     o.writeTo(sink);
+                 } else if constexpr (std::is_same_v<K, bool>) {
+                     if (o) {
+                         sink.write("true", 4);
+                     } else {
+                         sink.write("false", 5);
+                     }
+                 } else if constexpr (std::is_same_v<K, char>) {
+                     sink.write(&o, 1);
+                 } else if constexpr (std::is_integral_v<K>) {
+                     char buffer[24];
+                     std::to_chars_result res = std::to_chars(buffer, buffer + sizeof(buffer), o);
+                     sink.write(buffer, static_cast <std::size_t> (res.ptr - buffer));
+                 } else if constexpr (std::is_floating_point_v<K>) {
+                     constexpr const char* pattern = (std::is_same_v<K, long double>) ? ("%Lf") : ("%f");
+                     char buffer[64];
+                     int length = std::snprintf(buffer, sizeof(buffer), pattern, o);
+                     if (length < static_cast <int> (sizeof(buffer))) {
+                         sink.write(buffer, static_cast <std::size_t> (length));
+                     } else {
+                         // Huge values only, %f print every integral digit
+                         String large(static_cast <std::size_t> (length), '\0');
+                         std::snprintf(&large[0], static_cast <std::size_t> (length) + 1, pattern, o);
+                         sink.write(large.getCData(), large.getSize());
+                     }
+                 } else if constexpr (std::is_convertible_v<K const&, StringView>) {
+                     StringView view(o);
+                     sink.write(view.getData(), view.getSize());
+                 } else if constexpr (std::is_same_v<K, std::string>) {
+                     sink.write(o.data(), o.size());
+                 } else {
+                     static_assert(std::is_base_of_v<Stringable<K>, K>, "NRE::Core::format only support arithmetic, string and Stringable objects");
+                     String str(o.Stringable<K>::toString());
+                     sink.write(str.getCData(), str.getSize());
+                 }
+             }
+         }
+     }
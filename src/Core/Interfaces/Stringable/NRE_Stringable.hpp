@@ -10,9 +10,13 @@
      #pragma once
 
      #include <cassert>
+     #include <cmath>
+     #include <cstdint>
 
     #include "../NRE_StaticInterface.hpp"
     #include "../../String/NRE_String.hpp"
+    #include "../../Sink/NRE_StringSink.hpp"
+    #include "../../Sink/NRE_OStreamSink.hpp"
 
     /**
      * @namespace NRE
@@ -41,14 +45,103 @@
                             return this->impl().toString();
                         }
                         /**
-                         * Output stream operator for T object
+                         * Append the stringable string representation at the end of out, allowing buffer reuse
+                         * Use T::toString(String&) if provided, else append T::toString()
+                         * @param out the string to append into
+                         */
+                        void toString(String& out) const {
+                            if constexpr (requires (T const& o, String& str) { o.T::toString(str); }) {
+                                this->impl().toString(out);
+                            } else {
+                                out.append(this->impl().toString());
+                            }
+                        }
+                        /**
+                         * Estimate the stringable string representation size, allowing a single allocation when formatting
+                         * Use T::estimateStringSize() if provided, else return 0 meaning unknown
+                         * @return the estimated number of characters
+                         */
+                        std::size_t estimateStringSize() const {
+                            if constexpr (std::is_same_v<decltype(&T::estimateStringSize), std::size_t (T::*)() const>) {
+                                return this->impl().estimateStringSize();
+                            } else {
+                                return 0;
+                            }
+                        }
+                        /**
+                         * Output stream operator for T object, formatted through a bounded buffer without building the whole string
                          * @param  stream the stream to add T string representation
                          * @param  o      the object to add in the stream
                          * @return the    modified stream
                          */
                         friend std::ostream& operator <<(std::ostream& stream, T const& o) {
-                            return stream << o.Stringable<T>::toString();
+                            OStreamSink sink(stream);
+                            format(sink, o);
+                            return stream;
                         }
             };
+
+            namespace StringableInner {
+                /**
+                 * Count the number of decimal digits of the given value
+                 * @param value the value to count digits
+                 * @return      the number of digits, at least 1
+                 */
+                constexpr std::size_t countDigits(std::uint64_t value) {
+                    std::size_t digits = 1;
+                    while (value >= 10000) {
+                        value /= 10000;
+                        digits += 4;
+                    }
+                    if (value >= 1000) {
+                        return digits + 3;
+                    }
+                    if (value >= 100) {
+                        return digits + 2;
+                    }
+                    if (value >= 10) {
+                        return digits + 1;
+                    }
+                    return digits;
+                }
+            }
+
+            /**
+             * Estimate the number of characters appended to a String when formatting the given object
+             * Exact for booleans, characters, integers and strings, close for floating points, 0 if unknown
+             * @param o the object to estimate
+             * @return  the estimated number of characters
+             */
+            template <class K>
+            std::size_t estimateStringSize(K const& o) {
+                if constexpr (std::is_same_v<K, bool>) {
+                    return (o) ? (4) : (5);
+                } else if constexpr (std::is_same_v<K, char>) {
+                    return 1;
+                } else if constexpr (std::is_integral_v<K>) {
+                    if constexpr (std::is_signed_v<K>) {
+                        if (o < 0) {
+                            return 1 + StringableInner::countDigits(static_cast <std::uint64_t> (0) - static_cast <std::uint64_t> (o));
+                        }
+                    }
+                    return StringableInner::countDigits(static_cast <std::uint64_t> (o));
+                } else if constexpr (std::is_floating_point_v<K>) {
+                    // Formatted with %f : integral part, dot and 6 decimals
+                    if (!std::isfinite(o)) {
+                        return 4;
+                    }
+                    long double magnitude = std::fabs(static_cast <long double> (o));
+                    std::size_t integral = (magnitude < 10) ? (1) : (static_cast <std::size_t> (std::log10(magnitude)) + 1);
+                    return ((o < 0) ? (1) : (0)) + integral + 7;
+                } else if constexpr (std::is_base_of_v<Stringable<K>, K>) {
+                    return o.Stringable<K>::estimateStringSize();
+                } else if constexpr (std::is_convertible_v<K const&, StringView>) {
+                    return StringView(o).getSize();
+                } else if constexpr (std::is_same_v<K, std::string>) {
+                    return o.size();
+                } else {
+                    return 0;
+                }
+            }
         }
     }
@@ -9,6 +9,9 @@
 
      #pragma once
 
+    #include <tuple>
+    #include <utility>
+
     #include "../String/NRE_String.hpp"
     #include "../Interfaces/Stringable/NRE_Stringable.hpp"
 
@@ -44,14 +47,21 @@
                          * @param x the first object
                          * @param y the second object
                          */
-                        Pair(T const& x, K const& y);
+                        constexpr Pair(T const& x, K const& y);
                         /**
                          * Conpuct the pair while forwarding given elements
                          * @param x the first object
                          * @param y the second object
                          */
                         template <class T2, class K2>
-                        Pair(T2 && x, K2 && y);
+                        constexpr Pair(T2 && x, K2 && y);
+                        /**
+                         * Conpuct both objects in place from the given arguments tuples, without any intermediate copy or move
+                         * @param x the arguments used to construct the first object
+                         * @param y the arguments used to construct the second object
+                         */
+                        template <class ... Args1, class ... Args2>
+                        Pair(std::piecewise_construct_t, std::tuple<Args1...> x, std::tuple<Args2...> y);
 
                     //## Copy Conpuctor ##//
                         /**
@@ -64,7 +74,7 @@
                          * @param p the pair to initialize this
                          */
                         template <class T2, class K2>
-                        Pair(Pair<T2, K2> const& p);
+                        constexpr Pair(Pair<T2, K2> const& p);
 
                     //## Move Conpuctor ##//
                         /**
@@ -77,7 +87,7 @@
                          * @param p the pair to move
                          */
                         template <class T2, class K2>
-                        Pair(Pair<T2, K2> && p);
+                        constexpr Pair(Pair<T2, K2> && p);
 
                     //## Deconpuctor ##//
                         /**
@@ -164,6 +174,21 @@
                          * @return the converted object
                          */
                         [[nodiscard]] String toString() const;
+                        /**
+                         * Append the object string representation at the end of out, reserving its exact size first
+                         * @param out the string to append into
+                         */
+                        void toString(String& out) const;
+                        /**
+                         * @return the object string representation size, used to format nested objects in one allocation
+                         */
+                        std::size_t estimateStringSize() const;
+                        /**
+                         * Format the object straight into the given sink
+                         * @param sink the sink to write into
+                         */
+                        template <class S>
+                        void writeTo(S& sink) const;
 
             };
         }
@@ -15,22 +15,27 @@
              }
 
              template <class T, class K>
-             inline Pair<T, K>::Pair(T const& x, K const& y) : first(x), second(y) {
+             constexpr Pair<T, K>::Pair(T const& x, K const& y) : first(x), second(y) {
              }
 
              template <class T, class K>
              template <class T2, class K2>
-             inline Pair<T, K>::Pair(T2 && x, K2 && y) : first(std::forward<T2>(x)), second(std::forward<K2>(y)) {
+             constexpr Pair<T, K>::Pair(T2 && x, K2 && y) : first(std::forward<T2>(x)), second(std::forward<K2>(y)) {
+             }
+
+             template <class T, class K>
+             template <class ... Args1, class ... Args2>
+             inline Pair<T, K>::Pair(std::piecewise_construct_t, std::tuple<Args1...> x, std::tuple<Args2...> y) : first(std::make_from_tuple<T>(std::move(x))), second(std::make_from_tuple<K>(std::move(y))) {
              }
 
              template <class T, class K>
              template <class T2, class K2>
-             inline Pair<T, K>::Pair(Pair<T2, K2> const& p) : first(p.first), second(p.second) {
+             constexpr Pair<T, K>::Pair(Pair<T2, K2> const& p) : first(p.first), second(p.second) {
              }
 
              template <class T, class K>
              template <class T2, class K2>
-             inline Pair<T, K>::Pair(Pair<T2, K2> && p) : first(std::move(p.first)), second(std::move(p.second)) {
+             constexpr Pair<T, K>::Pair(Pair<T2, K2> && p) : first(std::move(p.first)), second(std::move(p.second)) {
              }
 
              template <class T, class K>
@@ -89,9 +94,31 @@
              template <class T, class K>
              inline String Pair<T, K>::toString() const {
                  String res;
-                 res << '(' << first << ',' << ' ' << second << ')';
+                 toString(res);
                  return res;
              }
 
+             template <class T, class K>
+             inline void Pair<T, K>::toString(String& out) const {
+                 out.reserve(out.getSize() + estimateStringSize());
+                 StringSink sink(out);
+                 writeTo(sink);
+             }
+
+             template <class T, class K>
+             template <class S>
+             inline void Pair<T, K>::writeTo(S& sink) const {
+                 sink.write("(", 1);
+                 format(sink, first);
+                 sink.write(", ", 2);
+                 format(sink, second);
+                 sink.write(")", 1);
+             }
+
+             template <class T, class K>
+             inline std::size_t Pair<T, K>::estimateStringSize() const {
+                 return 4 + Core::estimateStringSize(first) + Core::estimateStringSize(second);
+             }
+
          }
      }
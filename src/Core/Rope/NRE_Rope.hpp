@@ -0,0 +1,328 @@
+
+    /**
+     * @file NRE_Rope.hpp
+     * @brief Declaration of Core's API's Object : Rope
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+     #pragma once
+
+     #include <memory>
+     #include <iostream>
+
+     #include "../String/NRE_String.hpp"
+     #include "../Vector/NRE_Vector.hpp"
+     #include "../Interfaces/Iterator/NRE_IteratorBase.hpp"
+
+     /**
+     * @namespace NRE
+     * @brief The NearlyRealEngine's global namespace
+     */
+    namespace NRE {
+        /**
+         * @namespace Core
+         * @brief Core's API
+         */
+        namespace Core {
+
+            namespace RopeInner {
+                /**
+                 * @struct Chunk
+                 * @brief A view on a shared, immutable once shared, character buffer
+                 */
+                struct Chunk {
+                    std::shared_ptr<String> owner;  /**< The buffer holding the characters */
+                    StringView view;                /**< The part of the buffer owned by this chunk */
+                };
+
+                /**
+                 * @class ChunkIterator
+                 * @brief Rope forward iterator, iterating over each chunk view
+                 */
+                template <class T, class Category, class Container>
+                class ChunkIterator : public IteratorBase<ChunkIterator<T, Category, Container>, T, Category> {
+                    public :    // Traits
+                        /** Inherited iterator traits */
+                        using Traits = IteratorBase<ChunkIterator<T, Category, Container>, T, Category>;
+                        /** The iterated object */
+                        using ValueType         = typename Traits::ValueType;
+                        /** The pointer on iterated object */
+                        using Pointer           = typename Traits::Pointer;
+                        /** The reference on iterated object */
+                        using Reference         = typename Traits::Reference;
+                        /** The iterator difference type */
+                        using DifferenceType    = typename Traits::DifferenceType;
+                        /** The iterator size type */
+                        using SizeType          = std::size_t;
+                        /** STL compatibility */
+                        using value_type        = ValueType;
+                        /** STL compatibility */
+                        using pointer           = Pointer;
+                        /** STL compatibility */
+                        using reference         = Reference;
+                        /** STL compatibility */
+                        using difference_type   = DifferenceType;
+                        /** STL compatibility */
+                        using iterator_category = typename Traits::iterator_category;
+
+                    private :   // Fields
+                        const Container* front; /**< The prepended chunks, stored in reverse order */
+                        const Container* back;  /**< The appended chunks */
+                        SizeType index;         /**< The current chunk index */
+
+                    public :    // Methods
+                        //## Constructor ##//
+                            /**
+                             * Default constructor with no rope
+                             */
+                            ChunkIterator() = default;
+                            /**
+                             * Construct the iterator on the given chunk
+                             * @param f the prepended chunks
+                             * @param b the appended chunks
+                             * @param i the chunk index
+                             */
+                            ChunkIterator(const Container* f, const Container* b, SizeType i);
+
+                        //## Methods ##//
+                            /**
+                             * @return a reference on the iterated data
+                             */
+                            Reference dereference() const;
+                            /**
+                             * Increment the iterator position by one
+                             */
+                            void increment();
+                            /**
+                             * Test if the given iterator point to the same position
+                             * @param it the other iterator
+                             * @return   the test's result
+                             */
+                            bool equal(ChunkIterator const& it) const;
+                };
+            }
+
+            /**
+             * @class Rope
+             * @brief A string made of shared immutable chunks, for large incremental concatenations
+             *
+             * Appending or prepending never copy the existing content, slices share the chunks
+             * with their source and the whole content is copied once when flattened.
+             * Small appends are gathered in the last chunk while it isn't shared.
+             */
+            class Rope {
+                public :    // Traits
+                    /** The object's size type */
+                    using SizeType          = std::size_t;
+                    /** Immuable chunk iterator */
+                    using ConstIterator     = RopeInner::ChunkIterator<StringView, ForwardIterator, Vector<RopeInner::Chunk>>;
+                    /** STL compatibility */
+                    using size_type         = SizeType;
+                    /** STL compatibility */
+                    using const_iterator    = ConstIterator;
+
+                private :   // Fields
+                    Vector<RopeInner::Chunk> front; /**< The prepended chunks, stored in reverse order */
+                    Vector<RopeInner::Chunk> back;  /**< The appended chunks */
+                    SizeType length;                /**< The total number of characters */
+
+                public :    // Methods
+                    //## Constructor ##//
+                        /**
+                         * Construct an empty rope
+                         */
+                        Rope();
+                        /**
+                         * Construct a rope taking ownership of str
+                         * @param str the initial content
+                         */
+                        Rope(String && str);
+                        /**
+                         * Construct a rope with a copy of view
+                         * @param view the initial content
+                         */
+                        Rope(StringView const& view);
+                        /**
+                         * Construct a rope with a copy of str, str need to be terminated by a null character
+                         * @param str the initial content
+                         */
+                        Rope(const char* str);
+
+                    //## Getter ##//
+                        /**
+                         * @return the total number of characters
+                         */
+                        SizeType getSize() const;
+                        /**
+                         * @return the total number of characters
+                         */
+                        SizeType getLength() const;
+                        /**
+                         * @return the number of chunks
+                         */
+                        SizeType getChunkCount() const;
+                        /**
+                         * @return if the rope is empty
+                         */
+                        bool isEmpty() const;
+
+                    //## Iterator Access ##//
+                        /**
+                         * @return a const iterator on the first chunk
+                         */
+                        ConstIterator begin() const;
+                        /**
+                         * @return a const iterator on the first chunk
+                         */
+                        ConstIterator cbegin() const;
+                        /**
+                         * @return a const iterator on the end of the chunks
+                         */
+                        ConstIterator end() const;
+                        /**
+                         * @return a const iterator on the end of the chunks
+                         */
+                        ConstIterator cend() const;
+
+                    //## Methods ##//
+                        /**
+                         * Append the string at the end, taking its ownership without copy
+                         * @param  str the string to append
+                         * @return     the reference of himself
+                         */
+                        Rope& append(String && str);
+                        /**
+                         * Append a copy of the viewed characters at the end
+                         * @param  view the characters to append
+                         * @return      the reference of himself
+                         */
+                        Rope& append(StringView const& view);
+                        /**
+                         * Append a copy of str at the end, str need to be terminated by a null character
+                         * @param  str the characters to append
+                         * @return     the reference of himself
+                         */
+                        Rope& append(const char* str);
+                        /**
+                         * Append all chunks of rope at the end, sharing them
+                         * @param  rope the rope to append
+                         * @return      the reference of himself
+                         */
+                        Rope& append(Rope const& rope);
+                        /**
+                         * Insert the string at the beginning, taking its ownership without copy
+                         * @param  str the string to prepend
+                         * @return     the reference of himself
+                         */
+                        Rope& prepend(String && str);
+                        /**
+                         * Insert a copy of the viewed characters at the beginning
+                         * @param  view the characters to prepend
+                         * @return      the reference of himself
+                         */
+                        Rope& prepend(StringView const& view);
+                        /**
+                         * Insert a copy of str at the beginning, str need to be terminated by a null character
+                         * @param  str the characters to prepend
+                         * @return     the reference of himself
+                         */
+                        Rope& prepend(const char* str);
+                        /**
+                         * Insert all chunks of rope at the beginning, sharing them
+                         * @param  rope the rope to prepend
+                         * @return      the reference of himself
+                         */
+                        Rope& prepend(Rope const& rope);
+                        /**
+                         * Create a rope on the given range, sharing the chunks with this
+                         * @param  pos   the start index
+                         * @param  count the number of character to take, clamped to the rope end
+                         * @return       the sub rope
+                         */
+                        Rope slice(SizeType pos, SizeType count = NOT_FOUND) const;
+                        /**
+                         * Access a particular character with bound checking, linear in the number of chunks
+                         * @param  index the character index
+                         * @return       the corresponding character
+                         */
+                        char get(SizeType index) const;
+                        /**
+                         * Remove all chunks
+                         */
+                        void clear();
+                        /**
+                         * Copy all characters into a single string, allocating once
+                         * @return the flattened string
+                         */
+                        String flatten() const;
+                        /**
+                         * Append all characters at the end of str, allocating at most once
+                         * @param str the string to fill
+                         */
+                        void appendTo(String& str) const;
+                        /**
+                         * Write all chunks into the stream, without flattening
+                         * @param stream the stream to write in
+                         */
+                        void writeTo(std::ostream& stream) const;
+                        /**
+                         * Write all chunks into the sink, without flattening
+                         * @param sink the sink to write in
+                         */
+                        template <class S>
+                        void writeTo(S& sink) const;
+                        /**
+                         * Convert the object into a string representation
+                         * @return the converted object
+                         */
+                        [[nodiscard]] String toString() const;
+
+                    //## Stream Operator ##//
+                        /**
+                         * Append the object string representation at the end
+                         * @param o the object to append
+                         * @return  the reference of himself
+                         */
+                        template <class K>
+                        Rope& operator <<(K const& o);
+                        /**
+                         * Append the string at the end, taking its ownership without copy
+                         * @param str the string to append
+                         * @return    the reference of himself
+                         */
+                        Rope& operator <<(String && str);
+
+                private :   // Methods
+                    /**
+                     * Try to append the characters in place in the last chunk, only done while it is not shared
+                     * @param  view the characters to append
+                     * @return      if the characters have been gathered
+                     */
+                    bool gather(StringView const& view);
+                    /**
+                     * Access a chunk in the global order
+                     * @param  index the chunk index
+                     * @return       the corresponding chunk
+                     */
+                    RopeInner::Chunk const& getChunk(SizeType index) const;
+
+                public :     // Static
+                    static constexpr SizeType NOT_FOUND = -1;       /**< The not found marker value */
+
+                private :    // Static
+                    static constexpr SizeType CHUNK_SIZE = 4096;    /**< The size under which small appends are gathered in the last chunk */
+            };
+
+            /**
+             * Output stream operator for the object, write chunk by chunk without flattening
+             * @param  stream the stream to add the object's string representation
+             * @param  o      the object to add in the stream
+             * @return        the modified stream
+             */
+            std::ostream& operator <<(std::ostream& stream, Rope const& o);
+        }
+    }
+
+    #include "NRE_Rope.tpp"
@@ -0,0 +1,270 @@
+
+    /**
+     * @file NRE_Rope.tpp
+     * @brief Implementation of Core's API's Object : Rope
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+     namespace NRE {
+         namespace Core {
+             namespace RopeInner {
+
+                 template <class T, class Category, class Container>
+                 inline ChunkIterator<T, Category, Container>::ChunkIterator(const Container* f, const Container* b, SizeType i) : front(f), back(b), index(i) {
+                 }
+
+                 template <class T, class Category, class Container>
+                 inline typename ChunkIterator<T, Category, Container>::Reference ChunkIterator<T, Category, Container>::dereference() const {
+                     if (index < front->getSize()) {
+                         return (*front)[front->getSize() - 1 - index].view;
+                     }
+                     return (*back)[index - front->getSize()].view;
+                 }
+
+                 template <class T, class Category, class Container>
+                 inline void ChunkIterator<T, Category, Container>::increment() {
+                     ++index;
+                 }
+
+                 template <class T, class Category, class Container>
+                 inline bool ChunkIterator<T, Category, Container>::equal(ChunkIterator const& it) const {
+                     return index == it.index;
+                 }
+             }
+
+             inline Rope::Rope() : length(0) {
+             }
+
+             inline Rope::Rope(String && str) : Rope() {
+                 append(std::move(str));
+             }
+
+             inline Rope::Rope(StringView const& view) : Rope() {
+                 append(view);
+             }
+
+             inline Rope::Rope(const char* str) : Rope(StringView(str)) {
+             }
+
+             inline Rope::SizeType Rope::getSize() const {
+                 return length;
+             }
+
+             inline Rope::SizeType Rope::getLength() const {
+                 return length;
+             }
+
+             inline Rope::SizeType Rope::getChunkCount() const {
+                 return front.getSize() + back.getSize();
+             }
+
+             inline bool Rope::isEmpty() const {
+                 return length == 0;
+             }
+
+             inline Rope::ConstIterator Rope::begin() const {
+                 return ConstIterator(&front, &back, 0);
+             }
+
+             inline Rope::ConstIterator Rope::cbegin() const {
+                 return begin();
+             }
+
+             inline Rope::ConstIterator Rope::end() const {
+                 return ConstIterator(&front, &back, getChunkCount());
+             }
+
+             inline Rope::ConstIterator Rope::cend() const {
+                 return end();
+             }
+
+             inline Rope& Rope::append(String && str) {
+                 if (str.isEmpty()) {
+                     return *this;
+                 }
+                 if (str.getSize() < CHUNK_SIZE && gather(str)) {
+                     return *this;
+                 }
+                 std::shared_ptr<String> owner = std::make_shared<String>(std::move(str));
+                 length += owner->getSize();
+                 back.pushBack({owner, *owner});
+                 return *this;
+             }
+
+             inline Rope& Rope::append(StringView const& view) {
+                 if (view.isEmpty() || gather(view)) {
+                     return *this;
+                 }
+                 std::shared_ptr<String> owner = std::make_shared<String>();
+                 owner->reserve(std::max(view.getSize(), CHUNK_SIZE));
+                 owner->append(view);
+                 length += owner->getSize();
+                 back.pushBack({owner, *owner});
+                 return *this;
+             }
+
+             inline Rope& Rope::append(const char* str) {
+                 return append(StringView(str));
+             }
+
+             inline Rope& Rope::append(Rope const& rope) {
+                 if (this == &rope) {
+                     Rope copy(rope);
+                     return append(copy);
+                 }
+                 for (SizeType i = 0; i < rope.getChunkCount(); i++) {
+                     back.pushBack(rope.getChunk(i));
+                 }
+                 length += rope.length;
+                 return *this;
+             }
+
+             inline Rope& Rope::prepend(String && str) {
+                 if (str.isEmpty()) {
+                     return *this;
+                 }
+                 std::shared_ptr<String> owner = std::make_shared<String>(std::move(str));
+                 length += owner->getSize();
+                 front.pushBack({owner, *owner});
+                 return *this;
+             }
+
+             inline Rope& Rope::prepend(StringView const& view) {
+                 return prepend(String(view));
+             }
+
+             inline Rope& Rope::prepend(const char* str) {
+                 return prepend(StringView(str));
+             }
+
+             inline Rope& Rope::prepend(Rope const& rope) {
+                 if (this == &rope) {
+                     Rope copy(rope);
+                     return prepend(copy);
+                 }
+                 for (SizeType i = rope.getChunkCount(); i > 0; i--) {
+                     front.pushBack(rope.getChunk(i - 1));
+                 }
+                 length += rope.length;
+                 return *this;
+             }
+
+             inline Rope Rope::slice(SizeType pos, SizeType count) const {
+                 if (pos > length) {
+                     throw std::out_of_range("Slicing NRE::Core::Rope after its end.");
+                 }
+                 count = std::min(count, length - pos);
+                 Rope res;
+                 res.length = count;
+                 for (SizeType i = 0; i < getChunkCount() && count > 0; i++) {
+                     RopeInner::Chunk const& chunk = getChunk(i);
+                     if (pos >= chunk.view.getSize()) {
+                         pos -= chunk.view.getSize();
+                         continue;
+                     }
+                     StringView part = chunk.view.substr(pos, count);
+                     res.back.pushBack({chunk.owner, part});
+                     count -= part.getSize();
+                     pos = 0;
+                 }
+                 return res;
+             }
+
+             inline char Rope::get(SizeType index) const {
+                 if (index >= length) {
+                     throw std::out_of_range("Accessing NRE::Core::Rope element : " + std::to_string(index) + " while rope length is " + std::to_string(length) + ".");
+                 }
+                 for (StringView const& view : *this) {
+                     if (index < view.getSize()) {
+                         return view[index];
+                     }
+                     index -= view.getSize();
+                 }
+                 return '\0';
+             }
+
+             inline void Rope::clear() {
+                 front.clear();
+                 back.clear();
+                 length = 0;
+             }
+
+             inline String Rope::flatten() const {
+                 String res;
+                 appendTo(res);
+                 return res;
+             }
+
+             inline void Rope::appendTo(String& str) const {
+                 str.reserve(str.getSize() + length);
+                 for (StringView const& view : *this) {
+                     str.append(view);
+                 }
+             }
+
+             inline void Rope::writeTo(std::ostream& stream) const {
+                 for (StringView const& view : *this) {
+                     stream << view;
+                 }
+             }
+
+             template <class S>
+             inline void Rope::writeTo(S& sink) const {
+                 for (StringView const& view : *this) {
+                     sink.write(view.getData(), view.getSize());
+                 }
+             }
+
+             inline String Rope::toString() const {
+                 return flatten();
+             }
+
+             template <class K>
+             inline Rope& Rope::operator <<(K const& o) {
+                 if constexpr (std::is_same_v<K, Rope>) {
+                     return append(o);
+                 } else if constexpr (std::is_convertible_v<K const&, StringView>) {
+                     return append(StringView(o));
+                 } else {
+                     String str;
+                     str << o;
+                     return append(std::move(str));
+                 }
+             }
+
+             inline Rope& Rope::operator <<(String && str) {
+                 return append(std::move(str));
+             }
+
+             inline bool Rope::gather(StringView const& view) {
+                 if (back.isEmpty()) {
+                     return false;
+                 }
+                 RopeInner::Chunk& last = back.getLast();
+                 String& owner = *last.owner;
+                 // Only the sole owner may write, and only after the characters it views
+                 if (last.owner.use_count() != 1 || last.view.end() != owner.getCData() + owner.getSize() || owner.getSize() + view.getSize() > CHUNK_SIZE) {
+                     return false;
+                 }
+                 SizeType offset = static_cast <SizeType> (last.view.getData() - owner.getCData());
+                 owner.append(view);
+                 last.view = StringView(owner.getCData() + offset, owner.getSize() - offset);
+                 length += view.getSize();
+                 return true;
+             }
+
+             inline RopeInner::Chunk const& Rope::getChunk(SizeType index) const {
+                 if (index < front.getSize()) {
+                     return front[front.getSize() - 1 - index];
+                 }
+                 return back[index - front.getSize()];
+             }
+
+             inline std::ostream& operator <<(std::ostream& stream, Rope const& o) {
+                 o.writeTo(stream);
+                 return stream;
+             }
+         }
+     }
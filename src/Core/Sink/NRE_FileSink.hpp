@@ -0,0 +1,88 @@
+
+    /**
+     * @file NRE_FileSink.hpp
+     * @brief Declaration of Core's API's Object : FileSink
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+     #pragma once
+
+     #include <cerrno>
+     #include <system_error>
+
+     #ifdef _WIN32
+        #include <io.h>
+     #else
+        #include <unistd.h>
+     #endif
+
+     #include "../Interfaces/Sink/NRE_Sink.hpp"
+     #include "../Interfaces/Uncopyable/NRE_Uncopyable.hpp"
+
+    /**
+     * @namespace NRE
+     * @brief The NearlyRealEngine's global namespace
+     */
+    namespace NRE {
+        /**
+         * @namespace Core
+         * @brief Core's API
+         */
+        namespace Core {
+
+            /**
+             * @class FileSink
+             * @brief Sink writing into a file descriptor through a fixed size buffer, flushed when full and on destruction
+             * The file descriptor is not owned, it is never closed by the sink
+             */
+            class FileSink : public Sink<FileSink>, public Uncopyable<FileSink> {
+                public :    // Static
+                    static constexpr std::size_t BUFFER_SIZE = 4096;    /**< The internal buffer size */
+
+                private :   // Fields
+                    int fd;                     /**< The destination file descriptor */
+                    char buffer[BUFFER_SIZE];   /**< The pending characters */
+                    std::size_t length;         /**< The number of pending characters */
+
+                public :    // Methods
+                    //## Constructor ##//
+                        /**
+                         * Construct the sink on the given file descriptor
+                         * @param descriptor the destination file descriptor
+                         */
+                        FileSink(int descriptor);
+
+                    //## Deconstructor ##//
+                        /**
+                         * FileSink Deconstructor, flush pending characters, ignoring errors
+                         */
+                        ~FileSink();
+
+                    //## Methods ##//
+                        /**
+                         * Buffer the given characters, large writes bypass the buffer
+                         * @param data  the characters to write
+                         * @param count the number of characters
+                         * @throw std::system_error if the descriptor refuse the data
+                         */
+                        void write(const char* data, std::size_t count);
+                        /**
+                         * Write pending characters into the file descriptor
+                         * @throw std::system_error if the descriptor refuse the data
+                         */
+                        void flush();
+
+                private :   // Methods
+                    /**
+                     * Write all given characters into the file descriptor, retrying on partial writes
+                     * @param data  the characters to write
+                     * @param count the number of characters
+                     */
+                    void writeAll(const char* data, std::size_t count);
+            };
+        }
+    }
+
+    #include "NRE_FileSink.tpp"
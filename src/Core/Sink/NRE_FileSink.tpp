@@ -0,0 +1,61 @@
+
+    /**
+     * @file NRE_FileSink.tpp
+     * @brief Implementation of Core's API's Object : FileSink
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+     namespace NRE {
+         namespace Core {
+
+             inline FileSink::FileSink(int descriptor) : fd(descriptor), length(0) {
+             }
+
+             inline FileSink::~FileSink() {
+                 try {
+                     flush();
+                 } catch (std::system_error const&) {
+                 }
+             }
+
+             inline void FileSink::write(const char* data, std::size_t count) {
+                 if (length + count > BUFFER_SIZE) {
+                     flush();
+                     if (count >= BUFFER_SIZE) {
+                         writeAll(data, count);
+                         return;
+                     }
+                 }
+                 std::memcpy(buffer + length, data, count);
+                 length += count;
+             }
+
+             inline void FileSink::flush() {
+                 if (length > 0) {
+                     std::size_t pending = length;
+                     length = 0;
+                     writeAll(buffer, pending);
+                 }
+             }
+
+             inline void FileSink::writeAll(const char* data, std::size_t count) {
+                 while (count > 0) {
+                     #ifdef _WIN32
+                         int written = ::_write(fd, data, static_cast <unsigned int> (count));
+                     #else
+                         ssize_t written = ::write(fd, data, count);
+                     #endif
+                     if (written < 0) {
+                         if (errno == EINTR) {
+                             continue;
+                         }
+                         throw std::system_error(errno, std::generic_category(), "Writing into NRE::Core::FileSink descriptor.");
+                     }
+                     data += written;
+                     count -= static_cast <std::size_t> (written);
+                 }
+             }
+         }
+     }
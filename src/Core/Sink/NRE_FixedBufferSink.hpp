@@ -0,0 +1,88 @@
+
+    /**
+     * @file NRE_FixedBufferSink.hpp
+     * @brief Declaration of Core's API's Object : FixedBufferSink
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+     #pragma once
+
+     #include "../Interfaces/Sink/NRE_Sink.hpp"
+
+    /**
+     * @namespace NRE
+     * @brief The NearlyRealEngine's global namespace
+     */
+    namespace NRE {
+        /**
+         * @namespace Core
+         * @brief Core's API
+         */
+        namespace Core {
+
+            /**
+             * @class FixedBufferSink
+             * @brief Sink writing into a caller provided buffer, never allocating, truncating what doesn't fit
+             */
+            class FixedBufferSink : public Sink<FixedBufferSink> {
+                private :   // Fields
+                    char* buffer;           /**< The destination buffer */
+                    std::size_t capacity;   /**< The buffer capacity */
+                    std::size_t length;     /**< The number of written characters */
+                    bool truncated;         /**< Tell if some characters didn't fit */
+
+                public :    // Methods
+                    //## Constructor ##//
+                        /**
+                         * Construct the sink on the given buffer
+                         * @param data the destination buffer
+                         * @param size the buffer capacity
+                         */
+                        FixedBufferSink(char* data, std::size_t size);
+                        /**
+                         * Construct the sink on the given array
+                         * @param data the destination array
+                         */
+                        template <std::size_t Size>
+                        FixedBufferSink(char (&data)[Size]);
+
+                    //## Getter ##//
+                        /**
+                         * @return the number of written characters
+                         */
+                        std::size_t getSize() const;
+                        /**
+                         * @return the buffer capacity
+                         */
+                        std::size_t getCapacity() const;
+                        /**
+                         * @return if some characters have been dropped
+                         */
+                        bool isTruncated() const;
+                        /**
+                         * @return a view on the written characters
+                         */
+                        StringView getView() const;
+
+                    //## Methods ##//
+                        /**
+                         * Copy the given characters, dropping the ones which don't fit
+                         * @param data  the characters to write
+                         * @param count the number of characters
+                         */
+                        void write(const char* data, std::size_t count);
+                        /**
+                         * Do nothing, the buffer is always up to date
+                         */
+                        void flush();
+                        /**
+                         * Rewind the sink at the buffer start
+                         */
+                        void clear();
+            };
+        }
+    }
+
+    #include "NRE_FixedBufferSink.tpp"
@@ -0,0 +1,54 @@
+
+    /**
+     * @file NRE_FixedBufferSink.tpp
+     * @brief Implementation of Core's API's Object : FixedBufferSink
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+     namespace NRE {
+         namespace Core {
+
+             inline FixedBufferSink::FixedBufferSink(char* data, std::size_t size) : buffer(data), capacity(size), length(0), truncated(false) {
+             }
+
+             template <std::size_t Size>
+             inline FixedBufferSink::FixedBufferSink(char (&data)[Size]) : FixedBufferSink(data, Size) {
+             }
+
+             inline std::size_t FixedBufferSink::getSize() const {
+                 return length;
+             }
+
+             inline std::size_t FixedBufferSink::getCapacity() const {
+                 return capacity;
+             }
+
+             inline bool FixedBufferSink::isTruncated() const {
+                 return truncated;
+             }
+
+             inline StringView FixedBufferSink::getView() const {
+                 return StringView(buffer, length);
+             }
+
+             inline void FixedBufferSink::write(const char* data, std::size_t count) {
+                 std::size_t available = capacity - length;
+                 if (count > available) {
+                     count = available;
+                     truncated = true;
+                 }
+                 std::memcpy(buffer + length, data, count);
+                 length += count;
+             }
+
+             inline void FixedBufferSink::flush() {
+             }
+
+             inline void FixedBufferSink::clear() {
+                 length = 0;
+                 truncated = false;
+             }
+         }
+     }
@@ -0,0 +1,70 @@
+
+    /**
+     * @file NRE_OStreamSink.hpp
+     * @brief Declaration of Core's API's Object : OStreamSink
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+     #pragma once
+
+     #include <iostream>
+
+     #include "../Interfaces/Sink/NRE_Sink.hpp"
+     #include "../Interfaces/Uncopyable/NRE_Uncopyable.hpp"
+
+    /**
+     * @namespace NRE
+     * @brief The NearlyRealEngine's global namespace
+     */
+    namespace NRE {
+        /**
+         * @namespace Core
+         * @brief Core's API
+         */
+        namespace Core {
+
+            /**
+             * @class OStreamSink
+             * @brief Sink writing into a std::ostream through a fixed size buffer, flushed when full and on destruction
+             */
+            class OStreamSink : public Sink<OStreamSink>, public Uncopyable<OStreamSink> {
+                public :    // Static
+                    static constexpr std::size_t BUFFER_SIZE = 4096;    /**< The internal buffer size */
+
+                private :   // Fields
+                    std::ostream& stream;       /**< The destination stream */
+                    char buffer[BUFFER_SIZE];   /**< The pending characters */
+                    std::size_t length;         /**< The number of pending characters */
+
+                public :    // Methods
+                    //## Constructor ##//
+                        /**
+                         * Construct the sink on the given stream
+                         * @param s the destination stream
+                         */
+                        OStreamSink(std::ostream& s);
+
+                    //## Deconstructor ##//
+                        /**
+                         * OStreamSink Deconstructor, flush pending characters
+                         */
+                        ~OStreamSink();
+
+                    //## Methods ##//
+                        /**
+                         * Buffer the given characters, large writes bypass the buffer
+                         * @param data  the characters to write
+                         * @param count the number of characters
+                         */
+                        void write(const char* data, std::size_t count);
+                        /**
+                         * Write pending characters into the stream
+                         */
+                        void flush();
+            };
+        }
+    }
+
+    #include "NRE_OStreamSink.tpp"
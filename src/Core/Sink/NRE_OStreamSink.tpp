@@ -0,0 +1,39 @@
+
+    /**
+     * @file NRE_OStreamSink.tpp
+     * @brief Implementation of Core's API's Object : OStreamSink
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+     namespace NRE {
+         namespace Core {
+
+             inline OStreamSink::OStreamSink(std::ostream& s) : stream(s), length(0) {
+             }
+
+             inline OStreamSink::~OStreamSink() {
+                 flush();
+             }
+
+             inline void OStreamSink::write(const char* data, std::size_t count) {
+                 if (length + count > BUFFER_SIZE) {
+                     flush();
+                     if (count >= BUFFER_SIZE) {
+                         stream.write(data, static_cast <std::streamsize> (count));
+                         return;
+                     }
+                 }
+                 std::memcpy(buffer + length, data, count);
+                 length += count;
+             }
+
+             inline void OStreamSink::flush() {
+                 if (length > 0) {
+                     stream.write(buffer, static_cast <std::streamsize> (length));
+                     length = 0;
+                 }
+             }
+         }
+     }
@@ -0,0 +1,62 @@
+
+    /**
+     * @file NRE_StringSink.hpp
+     * @brief Declaration of Core's API's Object : StringSink
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+     #pragma once
+
+     #include "../Interfaces/Sink/NRE_Sink.hpp"
+
+    /**
+     * @namespace NRE
+     * @brief The NearlyRealEngine's global namespace
+     */
+    namespace NRE {
+        /**
+         * @namespace Core
+         * @brief Core's API
+         */
+        namespace Core {
+
+            /**
+             * @class StringSink
+             * @brief Sink appending at the end of a String
+             */
+            class StringSink : public Sink<StringSink> {
+                private :   // Fields
+                    String& out;    /**< The string to append into */
+
+                public :    // Methods
+                    //## Constructor ##//
+                        /**
+                         * Construct the sink on the given string
+                         * @param str the string to append into
+                         */
+                        StringSink(String& str);
+
+                    //## Getter ##//
+                        /**
+                         * @return the filled string
+                         */
+                        String& getString() const;
+
+                    //## Methods ##//
+                        /**
+                         * Append the given characters
+                         * @param data  the characters to write
+                         * @param count the number of characters
+                         */
+                        void write(const char* data, std::size_t count);
+                        /**
+                         * Do nothing, the string is always up to date
+                         */
+                        void flush();
+            };
+        }
+    }
+
+    #include "NRE_StringSink.tpp"
@@ -0,0 +1,27 @@
+
+    /**
+     * @file NRE_StringSink.tpp
+     * @brief Implementation of Core's API's Object : StringSink
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+     namespace NRE {
+         namespace Core {
+
+             inline StringSink::StringSink(String& str) : out(str) {
+             }
+
+             inline String& StringSink::getString() const {
+                 return out;
+             }
+
+             inline void StringSink::write(const char* data, std::size_t count) {
+                 out.append(data, count);
+             }
+
+             inline void StringSink::flush() {
+             }
+         }
+     }
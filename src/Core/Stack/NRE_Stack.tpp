@@ -78,6 +78,22 @@
             inline String Stack<T, Container>::toString() const {
                 return c.toString();
             }
+
+            template <class T, class Container>
+            inline void Stack<T, Container>::toString(String& out) const {
+                out << c;
+            }
+
+            template <class T, class Container>
+            inline std::size_t Stack<T, Container>::estimateStringSize() const {
+                return Core::estimateStringSize(c);
+            }
+
+            template <class T, class Container>
+            template <class S>
+            inline void Stack<T, Container>::writeTo(S& sink) const {
+                format(sink, c);
+            }
     
         }
     }
\ No newline at end of file
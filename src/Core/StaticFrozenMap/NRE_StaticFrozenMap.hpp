@@ -0,0 +1,176 @@
+
+    /**
+     * @file NRE_StaticFrozenMap.hpp
+     * @brief Declaration of Core's API's Container : StaticFrozenMap
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+    #pragma once
+
+    #include <cstdint>
+    #include <stdexcept>
+    #include <type_traits>
+    #include <vector>
+
+    #include "../String/NRE_StringView.hpp"
+    #include "../Pair/NRE_Pair.hpp"
+    #include "../Hash/NRE_Hash.hpp"
+    #include "../Detail/FrozenMap/NRE_FrozenMap.hpp"
+
+    /**
+    * @namespace NRE
+    * @brief The NearlyRealEngine's global namespace
+    */
+    namespace NRE {
+        /**
+         * @namespace Core
+         * @brief Core's API
+         */
+        namespace Core {
+
+            /**
+             * @class FrozenHash
+             * @brief Hash functor usable in constant expressions, for integral, enum and string like keys
+             * The result is not finalized, frozen maps mix it with their own seed
+             */
+            template <class K>
+            class FrozenHash {
+                static_assert(std::is_convertible_v<K const&, StringView> || std::is_integral_v<K> || std::is_enum_v<K>, "NRE::Core::FrozenHash need a string like, integral or enum key");
+
+                public :    // Methods
+                    /**
+                     * Compute the hash of the given key
+                     * @param k the key to hash
+                     * @return  the computed hash
+                     */
+                    constexpr std::uint64_t operator ()(K const& k) const;
+            };
+
+            /**
+             * @class StaticFrozenMap
+             * @brief An immutable map of N elements built in a constant expression, around a minimal perfect hash function
+             *
+             * Works as FrozenMap with inline storage, so literal tables can be built at compile time and searched in constant expressions.
+             * Keys must be distinct, a duplicated key making the construction throw.
+             */
+            template <class Key, class T, std::size_t N, class Hash = FrozenHash<Key>, class KeyEqual = std::equal_to<Key>>
+            class StaticFrozenMap : private Hash, private KeyEqual {
+                static_assert(N > 0, "NRE::Core::StaticFrozenMap need at least one element");
+
+                public :    // Traits
+                    /** The map key type */
+                    using KeyType               = Key;
+                    /** The map mapped type */
+                    using MappedType            = T;
+                    /** The container's allocated type */
+                    using ValueType             = Pair<KeyType, MappedType>;
+                    /** The object's size type */
+                    using SizeType              = std::size_t;
+                    /** The allocated type const reference */
+                    using ConstReference        = ValueType const&;
+                    /** Immuable random access iterator, in slot order */
+                    using ConstIterator         = ValueType const*;
+                    /** The map only hands out immuable iterators */
+                    using Iterator              = ConstIterator;
+                    /** STL compatibility */
+                    using key_type              = KeyType;
+                    /** STL compatibility */
+                    using mapped_type           = MappedType;
+                    /** STL compatibility */
+                    using value_type            = ValueType;
+                    /** STL compatibility */
+                    using size_type             = SizeType;
+                    /** STL compatibility */
+                    using const_reference       = ConstReference;
+                    /** STL compatibility */
+                    using iterator              = Iterator;
+                    /** STL compatibility */
+                    using const_iterator        = ConstIterator;
+
+                private :   // Static
+                    static constexpr SizeType BUCKET_COUNT = Detail::FrozenMapInner::bucketCountFor(N);    /**< The number of displacement buckets */
+
+                private :   // Fields
+                    ValueType entries[N];                          /**< The entries, at their slot */
+                    std::uint32_t displacements[BUCKET_COUNT];     /**< The displacement of each bucket */
+                    std::uint64_t seed;                            /**< The global seed mixed into each key hash */
+
+                public :    // Methods
+                    //## Constructor ##//
+                        /**
+                         * Construct the map from the given elements
+                         * @param values the map elements
+                         * @param hasher the hash function used in the map
+                         * @param equal  the equal function used in the map
+                         * @throw std::invalid_argument if a key is duplicated or two different keys have the same hash
+                         */
+                        constexpr StaticFrozenMap(ValueType const (&values)[N], Hash const& hasher = Hash(), KeyEqual const& equal = KeyEqual());
+
+                    //## Getter ##//
+                        /**
+                         * Return the value mapped to the given key
+                         * @param  k the key to search
+                         * @return   the mapped value
+                         * @throw std::out_of_range if the key is not in the map
+                         */
+                        constexpr MappedType const& get(KeyType const& k) const;
+                        /**
+                         * @return the number of elements
+                         */
+                        constexpr SizeType getSize() const;
+                        /**
+                         * @return if the map is empty
+                         */
+                        constexpr bool isEmpty() const;
+                        /**
+                         * Find the number of element with the given key
+                         * @param  k the key to search
+                         * @return   the number of corresponding elements
+                         */
+                        constexpr SizeType getCount(KeyType const& k) const;
+                        /**
+                         * @return the number of displacement buckets
+                         */
+                        constexpr SizeType getBucketCount() const;
+
+                    //## Iterator Access ##//
+                        /**
+                         * @return an iterator on the first element
+                         */
+                        constexpr ConstIterator begin() const;
+                        /**
+                         * @return an iterator on the first element
+                         */
+                        constexpr ConstIterator cbegin() const;
+                        /**
+                         * @return an iterator on the end of the container
+                         */
+                        constexpr ConstIterator end() const;
+                        /**
+                         * @return an iterator on the end of the container
+                         */
+                        constexpr ConstIterator cend() const;
+
+                    //## Methods ##//
+                        /**
+                         * Find the element with the given key, comparing a single entry
+                         * @param  k the key to search
+                         * @return   an iterator on the element, end if not found
+                         */
+                        constexpr ConstIterator find(KeyType const& k) const;
+            };
+
+            /**
+             * Build a StaticFrozenMap from a list of elements, its size being deduced
+             * @param  values the map elements
+             * @return        the built map
+             * @throw std::invalid_argument if a key is duplicated or two different keys have the same hash
+             */
+            template <class Key, class T, std::size_t N>
+            constexpr StaticFrozenMap<Key, T, N> makeFrozenMap(Pair<Key, T> const (&values)[N]);
+        }
+    }
+
+    #include "NRE_StaticFrozenMap.tpp"
@@ -0,0 +1,110 @@
+
+    /**
+     * @file NRE_StaticFrozenMap.tpp
+     * @brief Implementation of Core's API's Container : StaticFrozenMap
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+     namespace NRE {
+         namespace Core {
+
+             template <class K>
+             constexpr std::uint64_t FrozenHash<K>::operator ()(K const& k) const {
+                 if constexpr (std::is_convertible_v<K const&, StringView>) {
+                     StringView view(k);
+                     return hashString(view.getData(), view.getSize());
+                 } else if constexpr (std::is_enum_v<K>) {
+                     return static_cast <std::uint64_t> (static_cast <std::underlying_type_t<K>> (k));
+                 } else {
+                     return static_cast <std::uint64_t> (k);
+                 }
+             }
+
+             template <class Key, class T, std::size_t N, class Hash, class KeyEqual>
+             constexpr StaticFrozenMap<Key, T, N, Hash, KeyEqual>::StaticFrozenMap(ValueType const (&values)[N], Hash const& hasher, KeyEqual const& equal) : Hash(hasher), KeyEqual(equal), entries(), displacements(), seed(0) {
+                 std::vector<std::uint64_t> hashes(N, 0);
+                 for (SizeType index = 0; index < N; ++index) {
+                     hashes[index] = static_cast <std::uint64_t> (Hash::operator ()(values[index].first));
+                 }
+                 Detail::FrozenMapInner::Layout layout = Detail::FrozenMapInner::buildLayout(hashes, [this, &values](SizeType first, SizeType second) {
+                     return KeyEqual::operator ()(values[first].first, values[second].first);
+                 });
+                 if (layout.count != N) {
+                     throw std::invalid_argument("Building NRE::Core::StaticFrozenMap with a duplicated key.");
+                 }
+                 for (SizeType index = 0; index < N; ++index) {
+                     entries[layout.slots[index]] = values[index];
+                 }
+                 for (SizeType bucket = 0; bucket < BUCKET_COUNT; ++bucket) {
+                     displacements[bucket] = layout.displacements[bucket];
+                 }
+                 seed = layout.seed;
+             }
+
+             template <class Key, class T, std::size_t N, class Hash, class KeyEqual>
+             constexpr typename StaticFrozenMap<Key, T, N, Hash, KeyEqual>::MappedType const& StaticFrozenMap<Key, T, N, Hash, KeyEqual>::get(KeyType const& k) const {
+                 ConstIterator it = find(k);
+                 if (it == end()) {
+                     throw std::out_of_range("Accessing non-existing key in NRE::Core::StaticFrozenMap.");
+                 }
+                 return it->second;
+             }
+
+             template <class Key, class T, std::size_t N, class Hash, class KeyEqual>
+             constexpr typename StaticFrozenMap<Key, T, N, Hash, KeyEqual>::SizeType StaticFrozenMap<Key, T, N, Hash, KeyEqual>::getSize() const {
+                 return N;
+             }
+
+             template <class Key, class T, std::size_t N, class Hash, class KeyEqual>
+             constexpr bool StaticFrozenMap<Key, T, N, Hash, KeyEqual>::isEmpty() const {
+                 return false;
+             }
+
+             template <class Key, class T, std::size_t N, class Hash, class KeyEqual>
+             constexpr typename StaticFrozenMap<Key, T, N, Hash, KeyEqual>::SizeType StaticFrozenMap<Key, T, N, Hash, KeyEqual>::getCount(KeyType const& k) const {
+                 return (find(k) == end()) ? (0) : (1);
+             }
+
+             template <class Key, class T, std::size_t N, class Hash, class KeyEqual>
+             constexpr typename StaticFrozenMap<Key, T, N, Hash, KeyEqual>::SizeType StaticFrozenMap<Key, T, N, Hash, KeyEqual>::getBucketCount() const {
+                 return BUCKET_COUNT;
+             }
+
+             template <class Key, class T, std::size_t N, class Hash, class KeyEqual>
+             constexpr typename StaticFrozenMap<Key, T, N, Hash, KeyEqual>::ConstIterator StaticFrozenMap<Key, T, N, Hash, KeyEqual>::begin() const {
+                 return entries;
+             }
+
+             template <class Key, class T, std::size_t N, class Hash, class KeyEqual>
+             constexpr typename StaticFrozenMap<Key, T, N, Hash, KeyEqual>::ConstIterator StaticFrozenMap<Key, T, N, Hash, KeyEqual>::cbegin() const {
+                 return begin();
+             }
+
+             template <class Key, class T, std::size_t N, class Hash, class KeyEqual>
+             constexpr typename StaticFrozenMap<Key, T, N, Hash, KeyEqual>::ConstIterator StaticFrozenMap<Key, T, N, Hash, KeyEqual>::end() const {
+                 return entries + N;
+             }
+
+             template <class Key, class T, std::size_t N, class Hash, class KeyEqual>
+             constexpr typename StaticFrozenMap<Key, T, N, Hash, KeyEqual>::ConstIterator StaticFrozenMap<Key, T, N, Hash, KeyEqual>::cend() const {
+                 return end();
+             }
+
+             template <class Key, class T, std::size_t N, class Hash, class KeyEqual>
+             constexpr typename StaticFrozenMap<Key, T, N, Hash, KeyEqual>::ConstIterator StaticFrozenMap<Key, T, N, Hash, KeyEqual>::find(KeyType const& k) const {
+                 std::uint64_t h = Detail::FrozenMapInner::mix(static_cast <std::uint64_t> (Hash::operator ()(k)), seed);
+                 SizeType slot = Detail::FrozenMapInner::slotOf(h, displacements[Detail::FrozenMapInner::bucketOf(h, BUCKET_COUNT)], N);
+                 if (KeyEqual::operator ()(entries[slot].first, k)) {
+                     return entries + slot;
+                 }
+                 return end();
+             }
+
+             template <class Key, class T, std::size_t N>
+             constexpr StaticFrozenMap<Key, T, N> makeFrozenMap(Pair<Key, T> const (&values)[N]) {
+                 return StaticFrozenMap<Key, T, N>(values);
+             }
+         }
+     }
@@ -383,20 +383,39 @@
 
              template <class T, std::size_t Size>
              inline String StaticVector<T, Size>::toString() const {
-                 if (isEmpty()) {
-                     String res;
-                     res << '[' << ']';
-                     return res;
-                 } else {
-                     String res;
-                     res << '[' << data[0];
-                     res.reserve((res.getSize() + 2) * length);
+                 String res;
+                 toString(res);
+                 return res;
+             }
+
+             template <class T, std::size_t Size>
+             inline void StaticVector<T, Size>::toString(String& out) const {
+                 out.reserve(out.getSize() + estimateStringSize());
+                 StringSink sink(out);
+                 writeTo(sink);
+             }
+
+             template <class T, std::size_t Size>
+             template <class S>
+             inline void StaticVector<T, Size>::writeTo(S& sink) const {
+                 sink.write("[", 1);
+                 if (!isEmpty()) {
+                     format(sink, data[0]);
                      for (SizeType index = 1; index < length; index++) {
-                         res << ',' << ' ' << data[index];
+                         sink.write(", ", 2);
+                         format(sink, data[index]);
                      }
-                     res << ']';
-                     return res;
                  }
+                 sink.write("]", 1);
+             }
+
+             template <class T, std::size_t Size>
+             inline std::size_t StaticVector<T, Size>::estimateStringSize() const {
+                 std::size_t size = (isEmpty()) ? (2) : (2 * length);
+                 for (SizeType index = 0; index < length; index++) {
+                     size += Core::estimateStringSize(data[index]);
+                 }
+                 return size;
              }
 
          }
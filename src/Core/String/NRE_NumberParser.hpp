@@ -0,0 +1,114 @@
+
+    /**
+     * @file NRE_NumberParser.hpp
+     * @brief Declaration of Core's API's Object : NumberParser
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+    #pragma once
+
+    #include <system_error>
+    #include <type_traits>
+    #include <charconv>
+    #include <cstdint>
+    #include <cstring>
+    #include <limits>
+    #include <bit>
+
+    #if defined(__SSE2__)
+        #include <emmintrin.h>
+    #endif
+
+    /**
+     * @namespace NRE
+     * @brief The NearlyRealEngine's global namespace
+     */
+    namespace NRE {
+        /**
+         * @namespace Core
+         * @brief Core's API
+         */
+        namespace Core {
+
+            /**
+             * @struct ParseResult
+             * @brief The result of a number parsing, follow std::from_chars_result semantics
+             */
+            template <class T>
+            struct ParseResult {
+                const T* end;       /**< The first character not matching the number pattern */
+                std::errc error;    /**< std::errc() on success, invalid_argument if no number matched, result_out_of_range if the value doesn't fit */
+
+                /**
+                 * @return if the parsing succeed
+                 */
+                explicit operator bool() const {
+                    return error == std::errc();
+                }
+            };
+
+            /**
+             * Parse an integer from the given character range, locale independent and never allocating
+             * Follow std::from_chars semantics : no leading whitespace, no '+' sign, '-' only for signed types, no base prefix
+             * @param begin the first character
+             * @param end   the end of the range
+             * @param value the parsed value, left untouched on error
+             * @param base  the number base, between 2 and 36
+             * @return      the parsing result
+             */
+            template <class T, class K, typename std::enable_if_t<std::is_integral_v<K> && !std::is_same_v<K, bool>, int> = 0>
+            ParseResult<T> parseNumber(const T* begin, const T* end, K& value, int base = 10);
+            /**
+             * Parse a floating point from the given character range, locale independent and never allocating
+             * Follow std::from_chars semantics with the general format
+             * @param begin the first character
+             * @param end   the end of the range
+             * @param value the parsed value, left untouched on error
+             * @return      the parsing result
+             */
+            template <class T, class K, typename std::enable_if_t<std::is_floating_point_v<K>, int> = 0>
+            ParseResult<T> parseNumber(const T* begin, const T* end, K& value);
+
+            namespace NumberParserInner {
+                /**
+                 * Parse 8 digits at once using SWAR, the given pointer must have at least 8 readable characters
+                 * @param p      the first digit
+                 * @param result the parsed value, set only on success
+                 * @return       if the 8 characters were all digits
+                 */
+                bool parseEightDigits(const char* p, std::uint64_t& result);
+                /**
+                 * Parse 16 digits at once, using SSE2 if available, the given pointer must have at least 16 readable characters
+                 * @param p      the first digit
+                 * @param result the parsed value, set only on success
+                 * @return       if the 16 characters were all digits
+                 */
+                bool parseSixteenDigits(const char* p, std::uint64_t& result);
+                /**
+                 * Convert a character into its digit value
+                 * @param c the character to convert
+                 * @return  the digit value, or 36 if the character is not a digit in any base
+                 */
+                template <class T>
+                constexpr unsigned int toDigit(T c);
+                /**
+                 * Parse an unsigned magnitude, consuming every matching digit even on overflow
+                 * @param begin    the first character
+                 * @param end      the end of the range
+                 * @param base     the number base
+                 * @param result   the parsed magnitude
+                 * @param overflow set to true if the magnitude doesn't fit in 64 bits
+                 * @return         the first character not parsed
+                 */
+                template <class T>
+                const T* parseMagnitude(const T* begin, const T* end, unsigned int base, std::uint64_t& result, bool& overflow);
+
+                /** The maximum number of character copied when parsing a floating point from a non char range */
+                constexpr std::size_t MAX_FLOAT_LENGTH = 256;
+            }
+        }
+    }
+
+    #include "NRE_NumberParser.tpp"
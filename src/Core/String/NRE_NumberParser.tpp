@@ -0,0 +1,171 @@
+
+    /**
+     * @file NRE_NumberParser.tpp
+     * @brief Implementation of Core's API's Object : NumberParser
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+     namespace NRE {
+         namespace Core {
+             namespace NumberParserInner {
+
+                 inline bool parseEightDigits(const char* p, std::uint64_t& result) {
+                     std::uint64_t val;
+                     std::memcpy(&val, p, sizeof(val));
+                     if constexpr (std::endian::native == std::endian::big) {
+                         val = __builtin_bswap64(val);
+                     }
+
+                     // Each byte must be in [0x30, 0x39], checked on the high nibble of the byte and of the byte + 6
+                     if (((val & 0xF0F0F0F0F0F0F0F0) | (((val + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4)) != 0x3333333333333333) {
+                         return false;
+                     }
+
+                     constexpr std::uint64_t mask = 0x000000FF000000FF;
+                     constexpr std::uint64_t mul1 = 100 + (1000000ULL << 32);
+                     constexpr std::uint64_t mul2 = 1 + (10000ULL << 32);
+                     val -= 0x3030303030303030;
+                     val = (val * 10) + (val >> 8);
+                     val = (((val & mask) * mul1) + (((val >> 16) & mask) * mul2)) >> 32;
+                     result = static_cast <std::uint32_t> (val);
+                     return true;
+                 }
+
+                 inline bool parseSixteenDigits(const char* p, std::uint64_t& result) {
+                     #if defined(__SSE2__)
+                         const __m128i chars = _mm_loadu_si128(reinterpret_cast <const __m128i*> (p));
+                         const __m128i digits = _mm_sub_epi8(chars, _mm_set1_epi8('0'));
+                         const __m128i nine = _mm_set1_epi8(9);
+                         if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(digits, nine), nine)) != 0xFFFF) {
+                             return false;
+                         }
+
+                         // Reduce pairs, then quads, then octs of digits with multiply-add on 16 bits lanes
+                         const __m128i zero = _mm_setzero_si128();
+                         const __m128i tenOne = _mm_set_epi16(1, 10, 1, 10, 1, 10, 1, 10);
+                         const __m128i pairs = _mm_packs_epi32(_mm_madd_epi16(_mm_unpacklo_epi8(digits, zero), tenOne),
+                                                               _mm_madd_epi16(_mm_unpackhi_epi8(digits, zero), tenOne));
+                         const __m128i quads = _mm_madd_epi16(pairs, _mm_set_epi16(1, 100, 1, 100, 1, 100, 1, 100));
+                         const __m128i octs = _mm_madd_epi16(_mm_packs_epi32(quads, quads), _mm_set_epi16(1, 10000, 1, 10000, 1, 10000, 1, 10000));
+
+                         const std::uint64_t high = static_cast <std::uint32_t> (_mm_cvtsi128_si32(octs));
+                         const std::uint64_t low = static_cast <std::uint32_t> (_mm_cvtsi128_si32(_mm_srli_si128(octs, 4)));
+                         result = high * 100000000 + low;
+                         return true;
+                     #else
+                         std::uint64_t high, low;
+                         if (!parseEightDigits(p, high) || !parseEightDigits(p + 8, low)) {
+                             return false;
+                         }
+                         result = high * 100000000 + low;
+                         return true;
+                     #endif
+                 }
+
+                 template <class T>
+                 constexpr unsigned int toDigit(T c) {
+                     if (c >= T('0') && c <= T('9')) {
+                         return static_cast <unsigned int> (c - T('0'));
+                     }
+                     if (c >= T('a') && c <= T('z')) {
+                         return static_cast <unsigned int> (c - T('a')) + 10;
+                     }
+                     if (c >= T('A') && c <= T('Z')) {
+                         return static_cast <unsigned int> (c - T('A')) + 10;
+                     }
+                     return 36;
+                 }
+
+                 template <class T>
+                 inline const T* parseMagnitude(const T* begin, const T* end, unsigned int base, std::uint64_t& result, bool& overflow) {
+                     std::uint64_t acc = 0;
+                     const T* current = begin;
+
+                     if constexpr (std::is_same_v<T, char>) {
+                         if (base == 10) {
+                             std::uint64_t chunk;
+                             while (!overflow && end - current >= 16 && parseSixteenDigits(current, chunk)) {
+                                 overflow = __builtin_mul_overflow(acc, 10000000000000000ULL, &acc) || __builtin_add_overflow(acc, chunk, &acc);
+                                 current += 16;
+                             }
+                             while (!overflow && end - current >= 8 && parseEightDigits(current, chunk)) {
+                                 overflow = __builtin_mul_overflow(acc, 100000000ULL, &acc) || __builtin_add_overflow(acc, chunk, &acc);
+                                 current += 8;
+                             }
+                         }
+                     }
+
+                     for ( ; current != end; ++current) {
+                         unsigned int digit = toDigit(*current);
+                         if (digit >= base) {
+                             break;
+                         }
+                         if (!overflow) {
+                             overflow = __builtin_mul_overflow(acc, static_cast <std::uint64_t> (base), &acc) || __builtin_add_overflow(acc, static_cast <std::uint64_t> (digit), &acc);
+                         }
+                     }
+
+                     result = acc;
+                     return current;
+                 }
+             }
+
+             template <class T, class K, typename std::enable_if_t<std::is_integral_v<K> && !std::is_same_v<K, bool>, int>>
+             inline ParseResult<T> parseNumber(const T* begin, const T* end, K& value, int base) {
+                 static_assert(sizeof(K) <= sizeof(std::uint64_t), "NRE::Core::parseNumber only support integers up to 64 bits");
+                 if (base < 2 || base > 36) {
+                     return {begin, std::errc::invalid_argument};
+                 }
+
+                 const T* current = begin;
+                 bool negative = false;
+                 if constexpr (std::is_signed_v<K>) {
+                     if (current != end && *current == T('-')) {
+                         negative = true;
+                         ++current;
+                     }
+                 }
+
+                 std::uint64_t magnitude = 0;
+                 bool overflow = false;
+                 const T* last = NumberParserInner::parseMagnitude(current, end, static_cast <unsigned int> (base), magnitude, overflow);
+                 if (last == current) {
+                     return {begin, std::errc::invalid_argument};
+                 }
+
+                 std::uint64_t limit = static_cast <std::uint64_t> (std::numeric_limits<K>::max());
+                 if (negative) {
+                     ++limit;
+                 }
+                 if (overflow || magnitude > limit) {
+                     return {last, std::errc::result_out_of_range};
+                 }
+
+                 value = (negative) ? (static_cast <K> (0 - magnitude)) : (static_cast <K> (magnitude));
+                 return {last, std::errc()};
+             }
+
+             template <class T, class K, typename std::enable_if_t<std::is_floating_point_v<K>, int>>
+             inline ParseResult<T> parseNumber(const T* begin, const T* end, K& value) {
+                 if constexpr (std::is_same_v<T, char>) {
+                     std::from_chars_result res = std::from_chars(begin, end, value);
+                     return {res.ptr, res.ec};
+                 } else {
+                     // Narrow the ascii prefix on the stack, anything else can't be part of the number anyway
+                     char buffer[NumberParserInner::MAX_FLOAT_LENGTH];
+                     std::size_t length = 0;
+                     for (const T* current = begin; current != end && length < NumberParserInner::MAX_FLOAT_LENGTH; ++current) {
+                         if (static_cast <std::make_unsigned_t<T>> (*current) > 127) {
+                             break;
+                         }
+                         buffer[length] = static_cast <char> (*current);
+                         ++length;
+                     }
+                     std::from_chars_result res = std::from_chars(buffer, buffer + length, value);
+                     return {begin + (res.ptr - buffer), res.ec};
+                 }
+             }
+         }
+     }
@@ -17,6 +17,8 @@
      #include <cmath>
      #include <iostream>
 
+     #include "NRE_StringView.hpp"
+
      /**
      * @namespace NRE
      * @brief The NearlyRealEngine's global namespace
@@ -133,6 +135,11 @@
                          * @pre list don't contain string reference
                          */
                         BasicString(std::initializer_list<T> init);
+                        /**
+                         * Construct a string by copying the viewed characters
+                         * @param view the view to copy
+                         */
+                        explicit BasicString(BasicStringView<T> const& view);
 
                     //## Copy Constructor ##//
                         /**
@@ -447,7 +454,8 @@
                          */
                         template <class K, typename std::enable_if_t<std::is_base_of<Stringable<K>, K>::value, int> = 0>
                         BasicString& append(K const& o) {
-                            return append(o.toString());
+                            o.Stringable<K>::toString(*this);
+                            return *this;
                         }
                         /**
                          * Append the object to string
@@ -581,6 +589,12 @@
                          * @return      the reference of himself
                          */
                         BasicString& append(std::initializer_list<T> list);
+                        /**
+                         * Append all viewed character
+                         * @param  view the view to append
+                         * @return      the reference of himself
+                         */
+                        BasicString& append(BasicStringView<T> const& view);
                         /**
                          * Compare the given string to this, by first comparing size then memory
                          * @param  str the string to compare with this
@@ -809,6 +823,31 @@
                          * @return     if the string is contained
                          */
                         bool contains(BasicString const& str) const;
+                        /**
+                         * Parse the whole string as an integer
+                         * @param  base the number base, between 2 and 36
+                         * @return      the parsed value
+                         * @throw std::invalid_argument if the string isn't entirely an integer
+                         * @throw std::out_of_range     if the value doesn't fit in K
+                         */
+                        template <class K = int>
+                        K toInt(int base = 10) const;
+                        /**
+                         * Parse the whole string as a floating point
+                         * @return the parsed value
+                         * @throw std::invalid_argument if the string isn't entirely a floating point
+                         * @throw std::out_of_range     if the value doesn't fit in K
+                         */
+                        template <class K = double>
+                        K toFloat() const;
+                        /**
+                         * Try to parse the whole string as a number, never throw
+                         * @param  value the parsed value, left untouched on failure
+                         * @param  base  the number base for integers, ignored for floating points
+                         * @return       if the whole string has been parsed
+                         */
+                        template <class K>
+                        bool tryParse(K& value, int base = 10) const;
                         /**
                          * Search the first occurrence of the given string, start the search at the given position
                          * @param  str the string to search
@@ -1094,6 +1133,12 @@
                          */
                         bool operator>=(BasicString const& str) const;
 
+                    //## Conversion Operator ##//
+                        /**
+                         * @return a view on the whole string, invalidated by any reallocation
+                         */
+                        operator BasicStringView<T>() const;
+
                     //## Stream Operator ##//
                         /**
                          * Convert the object into a string representation
@@ -0,0 +1,159 @@
+
+    /**
+     * @file NRE_StringLiteral.hpp
+     * @brief Declaration of Core's API's Object : StringLiteral
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+     #pragma once
+
+     #include <cstddef>
+     #include <functional>
+
+     #include "NRE_StringView.hpp"
+     #include "../Hash/NRE_Hash.hpp"
+
+     /**
+     * @namespace NRE
+     * @brief The NearlyRealEngine's global namespace
+     */
+    namespace NRE {
+        /**
+         * @namespace Core
+         * @brief Core's API
+         */
+        namespace Core {
+
+            /**
+             * @class StringLiteral
+             * @brief A view on a string with static storage duration, carrying its hash computed at compile time
+             * The hash is equal to the one computed at runtime by std::hash on a String or a StringView with the same content
+             */
+            class StringLiteral {
+                public :    // Traits
+                    /** The object's size type */
+                    using SizeType  = std::size_t;
+                    /** STL compatibility */
+                    using size_type = SizeType;
+
+                private :   // Fields
+                    const char* data;   /**< The literal data */
+                    SizeType length;    /**< The literal length */
+                    std::size_t hash;   /**< The literal hash */
+
+                public :    // Methods
+                    //## Constructor ##//
+                        /**
+                         * No default constructor
+                         */
+                        StringLiteral() = delete;
+                        /**
+                         * Construct a literal on the count first character of str and hash it
+                         * @param str   the literal string, must outlive the object
+                         * @param count the number of character
+                         */
+                        constexpr StringLiteral(const char* str, SizeType count);
+                        /**
+                         * Construct a literal from a character array, the terminating null character is not part of the literal
+                         * @param str the literal string
+                         */
+                        template <std::size_t N>
+                        constexpr StringLiteral(const char (&str)[N]);
+
+                    //## Getter ##//
+                        /**
+                         * @return the literal data, null terminated when built from a string literal
+                         */
+                        constexpr const char* getData() const;
+                        /**
+                         * @return the literal size
+                         */
+                        constexpr SizeType getSize() const;
+                        /**
+                         * @return the literal hash, equal to std::hash<String> on the same content
+                         */
+                        constexpr std::size_t getHash() const;
+
+                    //## Methods ##//
+                        /**
+                         * @return a view on the literal
+                         */
+                        constexpr StringView getView() const;
+
+                    //## Convertor ##//
+                        /**
+                         * @return a view on the literal
+                         */
+                        constexpr operator StringView() const;
+
+                    //## Comparison Operator ##//
+                        /**
+                         * Equality test between this and str, compare hashes before characters
+                         * @param str the other literal to compare with this
+                         * @return    the test result
+                         */
+                        constexpr bool operator==(StringLiteral const& str) const;
+                        /**
+                         * Inequality test between this and str
+                         * @param str the other literal to compare with this
+                         * @return    the test result
+                         */
+                        constexpr bool operator!=(StringLiteral const& str) const;
+            };
+
+            /**
+             * @namespace Literals
+             * @brief Core's user defined literals
+             */
+            namespace Literals {
+                /**
+                 * Create a literal with its hash computed at compile time
+                 * @param str    the literal string
+                 * @param length the literal length
+                 * @return       the hashed literal
+                 */
+                consteval StringLiteral operator ""_nre(const char* str, std::size_t length);
+                /**
+                 * Compute a literal hash at compile time, usable as a switch case label
+                 * @param str    the literal string
+                 * @param length the literal length
+                 * @return       the literal hash, equal to std::hash<String> on the same content
+                 */
+                consteval std::size_t operator ""_hash(const char* str, std::size_t length);
+            }
+
+            /**
+             * Output stream operator for the object
+             * @param  stream the stream to add the object's string representation
+             * @param  o      the object to add in the stream
+             * @return        the modified stream
+             */
+            std::ostream& operator <<(std::ostream& stream, StringLiteral const& o);
+        }
+    }
+
+    /**
+    * @namespace std
+    * @brief The stl standard namespace
+    */
+    namespace std {
+        /**
+         * @class hash
+         * @brief Manage hashing for specialized version
+         */
+        template <>
+        class hash<NRE::Core::StringLiteral> {
+            public:
+                /**
+                 * Return the hash computed at the literal construction
+                 * @return the literal hash
+                 */
+                constexpr size_t operator()(NRE::Core::StringLiteral const& str) const {
+                    return str.getHash();
+                }
+        };
+    }
+
+    #include "NRE_StringLiteral.tpp"
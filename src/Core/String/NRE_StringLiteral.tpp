@@ -0,0 +1,65 @@
+
+    /**
+     * @file NRE_StringLiteral.tpp
+     * @brief Implementation of Core's API's Object : StringLiteral
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+     namespace NRE {
+         namespace Core {
+
+             constexpr StringLiteral::StringLiteral(const char* str, SizeType count) : data(str), length(count), hash(static_cast <std::size_t> (hashString(str, count))) {
+             }
+
+             template <std::size_t N>
+             constexpr StringLiteral::StringLiteral(const char (&str)[N]) : StringLiteral(str, N - 1) {
+             }
+
+             constexpr const char* StringLiteral::getData() const {
+                 return data;
+             }
+
+             constexpr StringLiteral::SizeType StringLiteral::getSize() const {
+                 return length;
+             }
+
+             constexpr std::size_t StringLiteral::getHash() const {
+                 return hash;
+             }
+
+             constexpr StringView StringLiteral::getView() const {
+                 return StringView(data, length);
+             }
+
+             constexpr StringLiteral::operator StringView() const {
+                 return getView();
+             }
+
+             constexpr bool StringLiteral::operator==(StringLiteral const& str) const {
+                 if (hash != str.hash || length != str.length) {
+                     return false;
+                 }
+                 return std::char_traits<char>::compare(data, str.data, length) == 0;
+             }
+
+             constexpr bool StringLiteral::operator!=(StringLiteral const& str) const {
+                 return !(*this == str);
+             }
+
+             namespace Literals {
+                 consteval StringLiteral operator ""_nre(const char* str, std::size_t length) {
+                     return StringLiteral(str, length);
+                 }
+
+                 consteval std::size_t operator ""_hash(const char* str, std::size_t length) {
+                     return static_cast <std::size_t> (hashString(str, length));
+                 }
+             }
+
+             inline std::ostream& operator <<(std::ostream& stream, StringLiteral const& o) {
+                 return stream.write(o.getData(), static_cast <std::streamsize> (o.getSize()));
+             }
+         }
+     }
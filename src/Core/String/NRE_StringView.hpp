@@ -0,0 +1,349 @@
+
+    /**
+     * @file NRE_StringView.hpp
+     * @brief Declaration of Core's API's Object : StringView
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+     #pragma once
+
+     #include <stdexcept>
+     #include <string>
+     #include <iostream>
+     #include <iterator>
+     #include <algorithm>
+
+     #include "NRE_NumberParser.hpp"
+     #include "../Hash/NRE_Hash.hpp"
+
+     /**
+     * @namespace NRE
+     * @brief The NearlyRealEngine's global namespace
+     */
+    namespace NRE {
+        /**
+         * @namespace Core
+         * @brief Core's API
+         */
+        namespace Core {
+
+            /**
+             * @class BasicStringView
+             * @brief A non owning view on a contiguous character range, not necessarily null terminated
+             */
+            template <class T>
+            class BasicStringView {
+                static_assert(std::is_integral<T>::value, "You can't use BasicStringView with non-integral types");
+
+                public :    // Traits
+                    /** The viewed character type */
+                    using ValueType             = T;
+                    /** The object's size type */
+                    using SizeType              = std::size_t;
+                    /** The object's difference type */
+                    using DifferenceType        = std::ptrdiff_t;
+                    /** The viewed type const reference */
+                    using ConstReference        = ValueType const&;
+                    /** The viewed type const pointer */
+                    using ConstPointer          = const ValueType*;
+                    /** Immuable random access iterator */
+                    using ConstIterator         = ConstPointer;
+                    /** Immuable reverse random access iterator */
+                    using ConstReverseIterator  = std::reverse_iterator<ConstIterator>;
+                    /** STL compatibility */
+                    using value_type            = ValueType;
+                    /** STL compatibility */
+                    using size_type             = SizeType;
+                    /** STL compatibility */
+                    using difference_type       = DifferenceType;
+                    /** STL compatibility */
+                    using const_reference       = ConstReference;
+                    /** STL compatibility */
+                    using const_pointer         = ConstPointer;
+                    /** STL compatibility */
+                    using const_iterator        = ConstIterator;
+                    /** STL compatibility */
+                    using const_reverse_iterator= ConstReverseIterator;
+
+                private :   // Fields
+                    ConstPointer data;  /**< The viewed data */
+                    SizeType length;    /**< The view length */
+
+                public :    // Methods
+                    //## Constructor ##//
+                        /**
+                         * Construct an empty view
+                         */
+                        constexpr BasicStringView();
+                        /**
+                         * Construct a view on the count first character of str
+                         * @param str   the viewed string
+                         * @param count the number of viewed character
+                         */
+                        constexpr BasicStringView(ConstPointer str, SizeType count);
+                        /**
+                         * Construct a view on str, str need to be terminated by a null character
+                         * @param str the viewed string
+                         */
+                        constexpr BasicStringView(ConstPointer str);
+
+                    //## Getter ##//
+                        /**
+                         * Access a particular element with bound checking
+                         * @param  index the element index
+                         * @return       the corresponding element
+                         */
+                        ConstReference get(SizeType index) const;
+                        /**
+                         * @return the viewed data, not necessarily null terminated
+                         */
+                        constexpr ConstPointer getData() const;
+                        /**
+                         * @return the first element
+                         */
+                        constexpr ConstReference getFront() const;
+                        /**
+                         * @return the last element
+                         */
+                        constexpr ConstReference getLast() const;
+                        /**
+                         * @return the view size
+                         */
+                        constexpr SizeType getSize() const;
+                        /**
+                         * @return the view size
+                         */
+                        constexpr SizeType getLength() const;
+                        /**
+                         * @return if the view is empty
+                         */
+                        constexpr bool isEmpty() const;
+
+                    //## Iterator Access ##//
+                        /**
+                         * @return a const iterator on the first element
+                         */
+                        constexpr ConstIterator begin() const;
+                        /**
+                         * @return a const iterator on the first element
+                         */
+                        constexpr ConstIterator cbegin() const;
+                        /**
+                         * @return a const iterator on the end of the view
+                         */
+                        constexpr ConstIterator end() const;
+                        /**
+                         * @return a const iterator on the end of the view
+                         */
+                        constexpr ConstIterator cend() const;
+                        /**
+                         * @return a const reverse iterator on the first element
+                         */
+                        ConstReverseIterator rbegin() const;
+                        /**
+                         * @return a const reverse iterator on the end of the view
+                         */
+                        ConstReverseIterator rend() const;
+
+                    //## Methods ##//
+                        /**
+                         * Shrink the view by moving its start forward
+                         * @param count the number of character to remove
+                         */
+                        constexpr void removePrefix(SizeType count);
+                        /**
+                         * Shrink the view by moving its end backward
+                         * @param count the number of character to remove
+                         */
+                        constexpr void removeSuffix(SizeType count);
+                        /**
+                         * Create a view on the given range
+                         * @param  pos   the start index
+                         * @param  count the number of character to take, clamped to the view end
+                         * @return       the sub view
+                         */
+                        BasicStringView substr(SizeType pos, SizeType count = NOT_FOUND) const;
+                        /**
+                         * Compare the given view to this, by first comparing size then memory
+                         * @param  str the view to compare with this
+                         * @return     <0 if this is lesser than str, >0 if this is greater than str, 0 if equals
+                         */
+                        int compare(BasicStringView const& str) const;
+                        /**
+                         * Check if the view starts with the given one
+                         * @param  str the prefix to check
+                         * @return     if the view starts with the prefix
+                         */
+                        bool startsWith(BasicStringView const& str) const;
+                        /**
+                         * Check if the view starts with the given character
+                         * @param  value the prefix to check
+                         * @return       if the view starts with the prefix
+                         */
+                        bool startsWith(ValueType value) const;
+                        /**
+                         * Check if the view ends with the given one
+                         * @param  str the suffix to check
+                         * @return     if the view ends with the suffix
+                         */
+                        bool endsWith(BasicStringView const& str) const;
+                        /**
+                         * Check if the view ends with the given character
+                         * @param  value the suffix to check
+                         * @return       if the view ends with the suffix
+                         */
+                        bool endsWith(ValueType value) const;
+                        /**
+                         * Search the first occurrence of the given character, start the search at the given position
+                         * @param  value the character to search
+                         * @param  pos   the search start
+                         * @return       the position of the found character, NOT_FOUND if no occurrence found
+                         */
+                        SizeType find(ValueType value, SizeType pos = 0) const;
+                        /**
+                         * Search the first occurrence of the given view, start the search at the given position
+                         * @param  str the view to search
+                         * @param  pos the search start
+                         * @return     the position of the found view, NOT_FOUND if no occurrence found
+                         */
+                        SizeType find(BasicStringView const& str, SizeType pos = 0) const;
+                        /**
+                         * Test if the view contains the given view
+                         * @param  str the view to test
+                         * @return     if the view is contained
+                         */
+                        bool contains(BasicStringView const& str) const;
+                        /**
+                         * Parse the whole view as an integer
+                         * @param  base the number base, between 2 and 36
+                         * @return      the parsed value
+                         * @throw std::invalid_argument if the view isn't entirely an integer
+                         * @throw std::out_of_range     if the value doesn't fit in K
+                         */
+                        template <class K = int>
+                        K toInt(int base = 10) const;
+                        /**
+                         * Parse the whole view as a floating point
+                         * @return the parsed value
+                         * @throw std::invalid_argument if the view isn't entirely a floating point
+                         * @throw std::out_of_range     if the value doesn't fit in K
+                         */
+                        template <class K = double>
+                        K toFloat() const;
+                        /**
+                         * Try to parse the whole view as a number, never throw
+                         * @param  value the parsed value, left untouched on failure
+                         * @param  base  the number base for integers, ignored for floating points
+                         * @return       if the whole view has been parsed
+                         */
+                        template <class K>
+                        bool tryParse(K& value, int base = 10) const;
+
+                    //## Access Operator ##//
+                        /**
+                         * Access a particular element without bound checking
+                         * @param  index the element index
+                         * @return       the corresponding element
+                         */
+                        constexpr ConstReference operator[](SizeType index) const;
+
+                    //## Comparison Operator ##//
+                        /**
+                         * Equality test between this and str
+                         * @param str the other view to compare with this
+                         * @return    the test result
+                         */
+                        constexpr bool operator==(BasicStringView const& str) const;
+                        /**
+                         * Inequality test between this and str
+                         * @param str the other view to compare with this
+                         * @return    the test result
+                         */
+                        constexpr bool operator!=(BasicStringView const& str) const;
+                        /**
+                         * Inferiority test between this and str, in lexicographic order
+                         * @param str the other view to compare with this
+                         * @return    the test result
+                         */
+                        bool operator<(BasicStringView const& str) const;
+
+                public :     // Static
+                    static constexpr SizeType NOT_FOUND = -1;   /**< The not found marker value */
+            };
+
+            /** View on simple caracter */
+            using StringView        = BasicStringView<char>;
+            /** View on wide caracter */
+            using WideStringView    = BasicStringView<wchar_t>;
+
+            /**
+             * @class StringHash
+             * @brief Transparent string hash, hash any string like object without building a String, equal to std::hash<String>
+             */
+            class StringHash {
+                public :    // Traits
+                    /** Allow heterogeneous lookup in hash tables */
+                    using is_transparent = void;
+
+                public :    // Methods
+                    /**
+                     * Compute the hash of the given string
+                     * @param str the string to hash
+                     * @return    the computed hash
+                     */
+                    std::size_t operator()(StringView const& str) const;
+            };
+
+            /**
+             * @class StringEqual
+             * @brief Transparent string equality, compare any string like objects without building a String
+             */
+            class StringEqual {
+                public :    // Traits
+                    /** Allow heterogeneous lookup in hash tables */
+                    using is_transparent = void;
+
+                public :    // Methods
+                    /**
+                     * Equality test between two strings
+                     * @param a the first string
+                     * @param b the second string
+                     * @return  the test result
+                     */
+                    bool operator()(StringView const& a, StringView const& b) const;
+            };
+
+            /**
+             * Output stream operator for the object
+             * @param  stream the stream to add the object's string representation
+             * @param  o      the object to add in the stream
+             * @return        the modified stream
+             */
+            template <class T>
+            std::ostream& operator <<(std::ostream& stream, BasicStringView<T> const& o);
+        }
+    }
+
+    /**
+    * @namespace std
+    * @brief The stl standard namespace
+    */
+    namespace std {
+        /**
+         * @class hash
+         * @brief Manage hashing for specialized version
+         */
+        template <>
+        class hash<NRE::Core::StringView> {
+            public:
+                /**
+                 * Compute a hash for a string view, equal to the hash of the viewed string
+                 * @return the computed hash
+                 */
+                size_t operator()(NRE::Core::StringView const& str) const;
+        };
+    }
+
+    #include "NRE_StringView.tpp"
@@ -0,0 +1,257 @@
+
+    /**
+     * @file NRE_StringView.tpp
+     * @brief Implementation of Core's API's Object : StringView
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+     namespace NRE {
+         namespace Core {
+
+             template <class T>
+             constexpr BasicStringView<T>::BasicStringView() : data(nullptr), length(0) {
+             }
+
+             template <class T>
+             constexpr BasicStringView<T>::BasicStringView(ConstPointer str, SizeType count) : data(str), length(count) {
+             }
+
+             template <class T>
+             constexpr BasicStringView<T>::BasicStringView(ConstPointer str) : data(str), length(std::char_traits<T>::length(str)) {
+             }
+
+             template <class T>
+             inline typename BasicStringView<T>::ConstReference BasicStringView<T>::get(SizeType index) const {
+                 if (index >= length) {
+                     throw std::out_of_range("Accessing NRE::Core::StringView element : " + std::to_string(index) + " while view length is " + std::to_string(length) + ".");
+                 }
+                 return data[index];
+             }
+
+             template <class T>
+             constexpr typename BasicStringView<T>::ConstPointer BasicStringView<T>::getData() const {
+                 return data;
+             }
+
+             template <class T>
+             constexpr typename BasicStringView<T>::ConstReference BasicStringView<T>::getFront() const {
+                 return data[0];
+             }
+
+             template <class T>
+             constexpr typename BasicStringView<T>::ConstReference BasicStringView<T>::getLast() const {
+                 return data[length - 1];
+             }
+
+             template <class T>
+             constexpr typename BasicStringView<T>::SizeType BasicStringView<T>::getSize() const {
+                 return length;
+             }
+
+             template <class T>
+             constexpr typename BasicStringView<T>::SizeType BasicStringView<T>::getLength() const {
+                 return length;
+             }
+
+             template <class T>
+             constexpr bool BasicStringView<T>::isEmpty() const {
+                 return length == 0;
+             }
+
+             template <class T>
+             constexpr typename BasicStringView<T>::ConstIterator BasicStringView<T>::begin() const {
+                 return data;
+             }
+
+             template <class T>
+             constexpr typename BasicStringView<T>::ConstIterator BasicStringView<T>::cbegin() const {
+                 return begin();
+             }
+
+             template <class T>
+             constexpr typename BasicStringView<T>::ConstIterator BasicStringView<T>::end() const {
+                 return data + length;
+             }
+
+             template <class T>
+             constexpr typename BasicStringView<T>::ConstIterator BasicStringView<T>::cend() const {
+                 return end();
+             }
+
+             template <class T>
+             inline typename BasicStringView<T>::ConstReverseIterator BasicStringView<T>::rbegin() const {
+                 return ConstReverseIterator(data + length);
+             }
+
+             template <class T>
+             inline typename BasicStringView<T>::ConstReverseIterator BasicStringView<T>::rend() const {
+                 return ConstReverseIterator(data);
+             }
+
+             template <class T>
+             constexpr void BasicStringView<T>::removePrefix(SizeType count) {
+                 data += count;
+                 length -= count;
+             }
+
+             template <class T>
+             constexpr void BasicStringView<T>::removeSuffix(SizeType count) {
+                 length -= count;
+             }
+
+             template <class T>
+             inline BasicStringView<T> BasicStringView<T>::substr(SizeType pos, SizeType count) const {
+                 if (pos > length) {
+                     throw std::out_of_range("Creating NRE::Core::StringView sub view after the view end.");
+                 }
+                 return BasicStringView(data + pos, std::min(count, length - pos));
+             }
+
+             template <class T>
+             inline int BasicStringView<T>::compare(BasicStringView const& str) const {
+                 if (length != str.length) {
+                     if (length < str.length) {
+                         return -1;
+                     } else {
+                         return 1;
+                     }
+                 }
+                 return std::char_traits<T>::compare(data, str.data, length);
+             }
+
+             template <class T>
+             inline bool BasicStringView<T>::startsWith(BasicStringView const& str) const {
+                 return length >= str.length && std::char_traits<T>::compare(data, str.data, str.length) == 0;
+             }
+
+             template <class T>
+             inline bool BasicStringView<T>::startsWith(ValueType value) const {
+                 return length >= 1 && data[0] == value;
+             }
+
+             template <class T>
+             inline bool BasicStringView<T>::endsWith(BasicStringView const& str) const {
+                 return length >= str.length && std::char_traits<T>::compare(data + length - str.length, str.data, str.length) == 0;
+             }
+
+             template <class T>
+             inline bool BasicStringView<T>::endsWith(ValueType value) const {
+                 return length >= 1 && data[length - 1] == value;
+             }
+
+             template <class T>
+             inline typename BasicStringView<T>::SizeType BasicStringView<T>::find(ValueType value, SizeType pos) const {
+                 if (pos >= length) {
+                     return NOT_FOUND;
+                 }
+                 ConstPointer found = std::char_traits<T>::find(data + pos, length - pos, value);
+                 return (found == nullptr) ? (NOT_FOUND) : (static_cast <SizeType> (found - data));
+             }
+
+             template <class T>
+             inline typename BasicStringView<T>::SizeType BasicStringView<T>::find(BasicStringView const& str, SizeType pos) const {
+                 if (str.length == 0) {
+                     return (pos <= length) ? (pos) : (NOT_FOUND);
+                 }
+                 for (SizeType current = pos; current + str.length <= length; current++) {
+                     if (data[current] == str.data[0] && std::char_traits<T>::compare(data + current, str.data, str.length) == 0) {
+                         return current;
+                     }
+                 }
+                 return NOT_FOUND;
+             }
+
+             template <class T>
+             inline bool BasicStringView<T>::contains(BasicStringView const& str) const {
+                 return find(str) != NOT_FOUND;
+             }
+
+             template <class T>
+             template <class K>
+             inline K BasicStringView<T>::toInt(int base) const {
+                 K value = 0;
+                 ParseResult<T> res = parseNumber(begin(), end(), value, base);
+                 if (res.error == std::errc::result_out_of_range) {
+                     throw std::out_of_range("Parsing NRE::Core::StringView : integer value out of range.");
+                 }
+                 if (res.error != std::errc() || res.end != end()) {
+                     throw std::invalid_argument("Parsing NRE::Core::StringView : not a valid integer.");
+                 }
+                 return value;
+             }
+
+             template <class T>
+             template <class K>
+             inline K BasicStringView<T>::toFloat() const {
+                 K value = 0;
+                 ParseResult<T> res = parseNumber(begin(), end(), value);
+                 if (res.error == std::errc::result_out_of_range) {
+                     throw std::out_of_range("Parsing NRE::Core::StringView : floating point value out of range.");
+                 }
+                 if (res.error != std::errc() || res.end != end()) {
+                     throw std::invalid_argument("Parsing NRE::Core::StringView : not a valid floating point.");
+                 }
+                 return value;
+             }
+
+             template <class T>
+             template <class K>
+             inline bool BasicStringView<T>::tryParse(K& value, int base) const {
+                 K parsed = 0;
+                 ParseResult<T> res;
+                 if constexpr (std::is_floating_point_v<K>) {
+                     (void) base;
+                     res = parseNumber(begin(), end(), parsed);
+                 } else {
+                     res = parseNumber(begin(), end(), parsed, base);
+                 }
+                 if (res.error != std::errc() || res.end != end()) {
+                     return false;
+                 }
+                 value = parsed;
+                 return true;
+             }
+
+             template <class T>
+             constexpr typename BasicStringView<T>::ConstReference BasicStringView<T>::operator[](SizeType index) const {
+                 return data[index];
+             }
+
+             template <class T>
+             constexpr bool BasicStringView<T>::operator==(BasicStringView const& str) const {
+                 return length == str.length && std::char_traits<T>::compare(data, str.data, length) == 0;
+             }
+
+             template <class T>
+             constexpr bool BasicStringView<T>::operator!=(BasicStringView const& str) const {
+                 return !(*this == str);
+             }
+
+             template <class T>
+             inline bool BasicStringView<T>::operator<(BasicStringView const& str) const {
+                 int res = std::char_traits<T>::compare(data, str.data, std::min(length, str.length));
+                 return res < 0 || (res == 0 && length < str.length);
+             }
+
+             inline std::size_t StringHash::operator()(StringView const& str) const {
+                 return static_cast <std::size_t> (hashString(str.getData(), str.getSize()));
+             }
+
+             inline bool StringEqual::operator()(StringView const& a, StringView const& b) const {
+                 return a == b;
+             }
+
+             template <class T>
+             std::ostream& operator <<(std::ostream& stream, BasicStringView<T> const& o) {
+                 return stream.write(o.getData(), static_cast <std::streamsize> (o.getSize()));
+             }
+         }
+     }
+
+     namespace std {
+         inline size_t hash<NRE::Core::StringView>::operator()(NRE::Core::StringView const& str) const {
+             return static_cast <size_t> (NRE::Core::hashString(str.getData(), str.getSize()));
+         }
+     }
@@ -0,0 +1,139 @@
+
+    /**
+     * @file NRE_StringPool.hpp
+     * @brief Declaration of Core's API's Object : StringPool
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+     #pragma once
+
+     #include <shared_mutex>
+     #include <mutex>
+     #include <stdexcept>
+
+     #include "../Id/NRE_Id.hpp"
+     #include "../String/NRE_String.hpp"
+     #include "../Vector/NRE_Vector.hpp"
+     #include "../UnorderedMap/NRE_UnorderedMap.hpp"
+     #include "../Interfaces/Uncopyable/NRE_Uncopyable.hpp"
+
+     /**
+     * @namespace NRE
+     * @brief The NearlyRealEngine's global namespace
+     */
+    namespace NRE {
+        /**
+         * @namespace Core
+         * @brief Core's API
+         */
+        namespace Core {
+
+            /**
+             * @class StringPool
+             * @brief Thread safe string interning table, map each distinct string to a compact Id
+             *
+             * Interned characters are copied once into an arena and never move, so a resolved view
+             * stays valid as long as the pool lives. Ids are attributed sequentially from 0.
+             */
+            class StringPool : public Uncopyable<StringPool> {
+                public :    // Traits
+                    /** The object's size type */
+                    using SizeType  = std::size_t;
+
+                private :   // Fields
+                    mutable std::shared_mutex mutex;    /**< Protect the table, shared for lookups, exclusive for new strings */
+                    UnorderedMap<StringView, Id> ids;   /**< Map an interned string to its id */
+                    Vector<StringView> views;           /**< Map an id to its interned string */
+                    Vector<char*> blocks;               /**< The arena blocks */
+                    SizeType blockUsed;                 /**< The number of used characters in the last block */
+                    SizeType blockCapacity;             /**< The last block capacity */
+
+                public :    // Methods
+                    //## Constructor ##//
+                        /**
+                         * Construct an empty pool
+                         */
+                        StringPool();
+
+                    //## Move Constructor ##//
+                        /**
+                         * Move pool into this, pool must not be used concurrently
+                         * @param pool the pool to move
+                         */
+                        StringPool(StringPool && pool);
+
+                    //## Deconstructor ##//
+                        /**
+                         * StringPool Deconstructor
+                         */
+                        ~StringPool();
+
+                    //## Getter ##//
+                        /**
+                         * @return the number of interned strings
+                         */
+                        SizeType getSize() const;
+                        /**
+                         * @return if no string has been interned
+                         */
+                        bool isEmpty() const;
+
+                    //## Methods ##//
+                        /**
+                         * Intern the given string, copying it only if it has never been seen
+                         * @param  str the string to intern
+                         * @return     the string id
+                         */
+                        Id intern(StringView const& str);
+                        /**
+                         * Search the id of an already interned string, never insert
+                         * @param  str the string to search
+                         * @return     the string id, or INVALID_ID if not interned
+                         */
+                        Id find(StringView const& str) const;
+                        /**
+                         * Test if the given string has been interned
+                         * @param  str the string to test
+                         * @return     if the string is interned
+                         */
+                        bool contains(StringView const& str) const;
+                        /**
+                         * Resolve an id back to its string, the view is null terminated and valid for the pool lifetime
+                         * @param  id the id to resolve
+                         * @return    the interned string
+                         * @throw std::out_of_range if the id has not been attributed by this pool
+                         */
+                        StringView resolve(Id id) const;
+
+                    //## Assignment Operator ##//
+                        /**
+                         * Move assignment of pool into this, pool must not be used concurrently
+                         * @param pool the pool to move into this
+                         * @return     the reference of himself
+                         */
+                        StringPool& operator =(StringPool && pool);
+
+                private :   // Methods
+                    /**
+                     * Copy the given string into the arena, the lock must be exclusively held
+                     * @param  str the string to store
+                     * @return     a view on the stored copy
+                     */
+                    StringView store(StringView const& str);
+                    /**
+                     * Free all arena blocks
+                     */
+                    void release();
+
+                public :    // Static
+                    static constexpr Id INVALID_ID = static_cast <Id> (-1);  /**< The id returned for a not interned string */
+
+                private :   // Static
+                    static constexpr SizeType BLOCK_SIZE = 4096;            /**< The arena block size, larger strings get their own block */
+            };
+        }
+    }
+
+    #include "NRE_StringPool.tpp"
@@ -0,0 +1,129 @@
+
+    /**
+     * @file NRE_StringPool.tpp
+     * @brief Implementation of Core's API's Object : StringPool
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+     namespace NRE {
+         namespace Core {
+
+             inline StringPool::StringPool() : blockUsed(0), blockCapacity(0) {
+             }
+
+             inline StringPool::StringPool(StringPool && pool) : ids(std::move(pool.ids)), views(std::move(pool.views)), blocks(std::move(pool.blocks)), blockUsed(pool.blockUsed), blockCapacity(pool.blockCapacity) {
+                 pool.blocks = Vector<char*>();
+                 pool.blockUsed = 0;
+                 pool.blockCapacity = 0;
+             }
+
+             inline StringPool::~StringPool() {
+                 release();
+             }
+
+             inline StringPool::SizeType StringPool::getSize() const {
+                 std::shared_lock<std::shared_mutex> lock(mutex);
+                 return views.getSize();
+             }
+
+             inline bool StringPool::isEmpty() const {
+                 return getSize() == 0;
+             }
+
+             inline Id StringPool::intern(StringView const& str) {
+                 {
+                     std::shared_lock<std::shared_mutex> lock(mutex);
+                     auto it = ids.find(str);
+                     if (it != ids.end()) {
+                         return it->second;
+                     }
+                 }
+                 std::unique_lock<std::shared_mutex> lock(mutex);
+                 // Another thread may have interned it between the two locks
+                 auto it = ids.find(str);
+                 if (it != ids.end()) {
+                     return it->second;
+                 }
+                 if (views.getSize() >= static_cast <SizeType> (INVALID_ID)) {
+                     throw std::length_error("NRE::Core::StringPool has attributed all available ids.");
+                 }
+                 Id id = static_cast <Id> (views.getSize());
+                 StringView stored = store(str);
+                 views.pushBack(stored);
+                 ids.emplace(stored, id);
+                 return id;
+             }
+
+             inline Id StringPool::find(StringView const& str) const {
+                 std::shared_lock<std::shared_mutex> lock(mutex);
+                 auto it = ids.find(str);
+                 if (it != ids.end()) {
+                     return it->second;
+                 }
+                 return INVALID_ID;
+             }
+
+             inline bool StringPool::contains(StringView const& str) const {
+                 return find(str) != INVALID_ID;
+             }
+
+             inline StringView StringPool::resolve(Id id) const {
+                 std::shared_lock<std::shared_mutex> lock(mutex);
+                 if (static_cast <SizeType> (id) >= views.getSize()) {
+                     throw std::out_of_range("Resolving non attributed id in NRE::Core::StringPool.");
+                 }
+                 return views[id];
+             }
+
+             inline StringPool& StringPool::operator =(StringPool && pool) {
+                 if (this != &pool) {
+                     release();
+                     ids = std::move(pool.ids);
+                     views = std::move(pool.views);
+                     blocks = std::move(pool.blocks);
+                     blockUsed = pool.blockUsed;
+                     blockCapacity = pool.blockCapacity;
+                     pool.blocks = Vector<char*>();
+                     pool.blockUsed = 0;
+                     pool.blockCapacity = 0;
+                 }
+                 return *this;
+             }
+
+             inline StringView StringPool::store(StringView const& str) {
+                 SizeType needed = str.getSize() + 1;
+                 char* dst;
+                 if (needed > BLOCK_SIZE / 4) {
+                     // Large strings get a dedicated block, inserted before the current one to keep filling it
+                     dst = static_cast <char*> (::operator new (needed));
+                     if (blocks.isEmpty()) {
+                         blocks.pushBack(dst);
+                     } else {
+                         blocks.insert(blocks.end() - 1, dst);
+                     }
+                 } else {
+                     if (blockCapacity - blockUsed < needed) {
+                         blocks.pushBack(static_cast <char*> (::operator new (BLOCK_SIZE)));
+                         blockUsed = 0;
+                         blockCapacity = BLOCK_SIZE;
+                     }
+                     dst = blocks.getLast() + blockUsed;
+                     blockUsed += needed;
+                 }
+                 std::memcpy(dst, str.getData(), str.getSize());
+                 dst[str.getSize()] = '\0';
+                 return StringView(dst, str.getSize());
+             }
+
+             inline void StringPool::release() {
+                 for (char* block : blocks) {
+                     ::operator delete(block);
+                 }
+                 blocks.clear();
+                 blockUsed = 0;
+                 blockCapacity = 0;
+             }
+         }
+     }
@@ -91,6 +91,15 @@
             concept Dereferenceable = requires(T t) {
                 { *t } -> Referenceable;
             };
+        
+            /**
+             * @interface Transparent
+             * @brief Define a functor accepting heterogeneous arguments, marked by an is_transparent member type
+             */
+            template <class T>
+            concept Transparent = requires {
+                typename T::is_transparent;
+            };
         }
         namespace Core {
             
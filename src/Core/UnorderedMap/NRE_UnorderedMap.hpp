@@ -24,8 +24,12 @@
         namespace Core {
     
             /** Hide UnorderedMap detail implementation and provide default allocator */
-            template <class Key, class T, class Allocator = Memory::Allocator<Pair<Key, T>>, bool StoreHash = false, class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key>>
-            using UnorderedMap = Detail::UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual>;
+            template <class Key, class T, class Allocator = Memory::Allocator<Pair<Key, T>>, bool StoreHash = false, class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key>, class Mix = DefaultHashMix<Key, Hash>>
+            using UnorderedMap = Detail::UnorderedMap<Key, T, Allocator, StoreHash, Hash, KeyEqual, Mix>;
+
+            /** UnorderedMap backed by a Swiss table, probing 16 control bytes at once */
+            template <class Key, class T, class Allocator = Memory::Allocator<Pair<Key, T>>, class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key>, class Mix = DefaultHashMix<Key, Hash>>
+            using SwissMap = Detail::UnorderedMap<Key, T, Allocator, false, Hash, KeyEqual, Mix, Detail::SwissTable>;
         }
     }
     
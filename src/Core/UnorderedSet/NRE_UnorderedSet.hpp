@@ -0,0 +1,30 @@
+    
+    /**
+     * @file Core/UnorderedSet/NRE_UnorderedSet.hpp
+     * @brief Declaration of Core's API's Container : UnorderedSet
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+    
+    #pragma once
+    
+    #include <Memory/Allocator/NRE_Allocator.hpp>
+    #include "../Detail/UnorderedSet/NRE_UnorderedSet.hpp"
+    
+    /**
+    * @namespace NRE
+    * @brief The NearlyRealEngine's global namespace
+    */
+    namespace NRE {
+        /**
+         * @namespace Core
+         * @brief Core's API
+         */
+        namespace Core {
+    
+            /** Hide UnorderedSet detail implementation and provide default allocator */
+            template <class Key, class Allocator = Memory::Allocator<Key>, bool StoreHash = false, class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key>, class Mix = DefaultHashMix<Key, Hash>>
+            using UnorderedSet = Detail::UnorderedSet<Key, Allocator, StoreHash, Hash, KeyEqual, Mix>;
+        }
+    }
@@ -12,21 +12,43 @@
     #include "../Core/Interfaces/NRE_StaticInterface.hpp"
     #include "../Core/Interfaces/Uncopyable/NRE_Uncopyable.hpp"
     #include "../Core/Interfaces/Stringable/NRE_Stringable.hpp"
+    #include "../Core/Interfaces/Sink/NRE_Sink.hpp"
     #include "../Core/Interfaces/Iterator/NRE_IteratorBase.hpp"
 
     #include "../Core/Array/NRE_Array.hpp"
     #include "../Core/StaticVector/NRE_StaticVector.hpp"
     #include "../Core/Vector/NRE_Vector.hpp"
+    #include "../Core/Hash/NRE_Hash.hpp"
+    #include "../Core/Hash/NRE_SeededHash.hpp"
+    #include "../Core/Hash/NRE_HashedKey.hpp"
+    #include "../Core/Hash/NRE_HashMix.hpp"
+    #include "../Core/String/NRE_StringView.hpp"
     #include "../Core/String/NRE_String.hpp"
+    #include "../Core/String/NRE_StringLiteral.hpp"
     #include "../Core/ForwardList/NRE_ForwardList.hpp"
 
     #include "../Core/Detail/HashTable/NRE_HashTable.hpp"
+    #include "../Core/Detail/SwissTable/NRE_SwissTable.hpp"
     #include "../Core/Detail/ForwardList/NRE_ForwardList.hpp"
     #include "../Core/Detail/Vector/NRE_Vector.hpp"
     #include "../Core/Detail/UnorderedMap/NRE_UnorderedMap.hpp"
+    #include "../Core/Detail/UnorderedSet/NRE_UnorderedSet.hpp"
+    #include "../Core/Detail/IndexMap/NRE_IndexMap.hpp"
+    #include "../Core/Detail/FrozenMap/NRE_FrozenMap.hpp"
 
     #include "../Core/Pair/NRE_Pair.hpp"
     #include "../Core/UnorderedMap/NRE_UnorderedMap.hpp"
+    #include "../Core/UnorderedSet/NRE_UnorderedSet.hpp"
+    #include "../Core/ConcurrentMap/NRE_ConcurrentMap.hpp"
+    #include "../Core/IndexMap/NRE_IndexMap.hpp"
+    #include "../Core/FrozenMap/NRE_FrozenMap.hpp"
+    #include "../Core/StaticFrozenMap/NRE_StaticFrozenMap.hpp"
+    #include "../Core/StringPool/NRE_StringPool.hpp"
+    #include "../Core/Rope/NRE_Rope.hpp"
+    #include "../Core/Sink/NRE_StringSink.hpp"
+    #include "../Core/Sink/NRE_FixedBufferSink.hpp"
+    #include "../Core/Sink/NRE_OStreamSink.hpp"
+    #include "../Core/Sink/NRE_FileSink.hpp"
     
     #include "../Core/Stack/NRE_Stack.hpp"
 
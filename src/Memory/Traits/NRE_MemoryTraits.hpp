@@ -10,6 +10,10 @@
     #pragma once
 
     #include "../../Concept/NRE_IteratorConcept.hpp"
+
+    #if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+        #include <xmmintrin.h>
+    #endif
     
     /**
     * @namespace NRE
@@ -22,6 +26,20 @@
          */
         namespace Memory {
             
+            /**
+             * Hint the processor to load the cache line holding the given address, without any effect on the program
+             * @param p the address to prefetch
+             */
+            inline void prefetch(const void* p) {
+                #if defined(__GNUC__) || defined(__clang__)
+                    __builtin_prefetch(p);
+                #elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+                    _mm_prefetch(static_cast <const char*> (p), _MM_HINT_T0);
+                #else
+                    (void) p;
+                #endif
+            }
+
             /**
              * Construct an object at a given address with given arguments
              * @param p    the memory address to construct the object
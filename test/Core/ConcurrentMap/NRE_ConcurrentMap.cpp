@@ -0,0 +1,92 @@
+
+    /**
+     * @file NRE_ConcurrentMap.cpp
+     * @brief Test of Core's API's Container : ConcurrentMap
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+    #include "../../../src/Header/NRE_Core.hpp"
+    #include <Header/NRE_Tester.hpp>
+    #include <thread>
+    #include <atomic>
+
+    using namespace NRE::Core;
+    using namespace NRE::Tester;
+
+    TEST(ConcurrentMap, Ctr) {
+        ConcurrentMap<int, int> map(10);
+        assertEquals(this, map.getShardCount(), static_cast <std::size_t> (16));
+        assertTrue(this, map.isEmpty());
+        assertEquals(this, map.getSize(), static_cast <std::size_t> (0));
+    }
+
+    TEST(ConcurrentMap, Operations) {
+        ConcurrentMap<std::string, int> map;
+        assertTrue(this, map.insert(Pair<std::string, int>("A", 1)));
+        assertTrue(this, !map.insert(Pair<std::string, int>("A", 2)));
+        assertTrue(this, map.upsert("B", 2));
+        assertTrue(this, !map.upsert("B", 3));
+        assertEquals(this, map.get("B"), 3);
+        assertTrue(this, !map.upsert("A", 0, [](int& value) { value += 10; }));
+        assertEquals(this, map.get("A"), 11);
+        int found = 0;
+        assertTrue(this, map.findAndApply("A", [&found](int const& value) { found = value; }));
+        assertEquals(this, found, 11);
+        assertTrue(this, !map.findAndApply("C", [&found](int const&) { found = -1; }));
+        assertEquals(this, found, 11);
+        assertTrue(this, !map.eraseIf("A", [](int const& value) { return value < 10; }));
+        assertTrue(this, map.eraseIf("A", [](int const& value) { return value > 10; }));
+        assertEquals(this, map.getCount("A"), static_cast <std::size_t> (0));
+        assertEquals(this, map.erase("B"), static_cast <std::size_t> (1));
+        assertTrue(this, map.isEmpty());
+        bool thrown = false;
+        try {
+            static_cast <void> (map.get("B"));
+        } catch (std::out_of_range const&) {
+            thrown = true;
+        }
+        assertTrue(this, thrown);
+    }
+
+    TEST(ConcurrentMap, Concurrent) {
+        ConcurrentMap<int, int> map;
+        map.reserve(1000);
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 8; t++) {
+            threads.emplace_back([&map]() {
+                for (int i = 0; i < 1000; i++) {
+                    map.upsert(i, 1, [](int& value) { ++value; });
+                    map.findAndApply(i / 2, [](int const&) {});
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        assertEquals(this, map.getSize(), static_cast <std::size_t> (1000));
+        std::atomic<long> total(0);
+        std::atomic<std::size_t> count(0);
+        map.forEach([&](Pair<int, int> const& value) {
+            total += value.second;
+            ++count;
+        }, 4);
+        assertEquals(this, count.load(), static_cast <std::size_t> (1000));
+        assertEquals(this, total.load(), 8000L);
+        assertEquals(this, map.eraseIf([](Pair<int, int> const& value) { return value.first % 2 == 0; }), static_cast <std::size_t> (500));
+        assertEquals(this, map.getSize(), static_cast <std::size_t> (500));
+        bool thrown = false;
+        try {
+            map.forEach([](Pair<int, int> const& value) {
+                if (value.first == 1) {
+                    throw std::runtime_error("stop");
+                }
+            });
+        } catch (std::runtime_error const&) {
+            thrown = true;
+        }
+        assertTrue(this, thrown);
+        map.clear();
+        assertTrue(this, map.isEmpty());
+    }
@@ -0,0 +1,101 @@
+
+    /**
+     * @file NRE_FrozenMap.cpp
+     * @brief Test of Core's API's Container : FrozenMap
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+    #include "../../../src/Header/NRE_Core.hpp"
+    #include <Header/NRE_Tester.hpp>
+
+    using namespace NRE;
+    using namespace NRE::Core;
+    using namespace NRE::Tester;
+
+    TEST(FrozenMap, Ctr) {
+        Core::FrozenMap<std::string, int> map;
+        assertEquals(this, map.getSize(), static_cast <std::size_t> (0));
+        assertTrue(this, map.isEmpty());
+        assertTrue(this, map.find("A") == map.end());
+        assertEquals(this, map.toString(), String("{}"));
+        bool thrown = false;
+        try {
+            static_cast <void> (map.get("A"));
+        } catch (std::out_of_range const&) {
+            thrown = true;
+        }
+        assertTrue(this, thrown);
+    }
+
+    TEST(FrozenMap, CtrList) {
+        Core::FrozenMap<std::string, int> map({{"A", 1}, {"B", 2}, {"C", 3}, {"A", 4}});
+        assertEquals(this, map.getSize(), static_cast <std::size_t> (3));
+        assertEquals(this, map.get("A"), 1);
+        assertEquals(this, map.get("B"), 2);
+        assertEquals(this, map.get("C"), 3);
+        assertEquals(this, map.getCount("D"), static_cast <std::size_t> (0));
+        String str(map.toString());
+        assertTrue(str.contains("(A, 1)"));
+        assertTrue(str.contains("(C, 3)"));
+
+        Core::FrozenMap<std::string, int> copy(map);
+        assertEquals(this, copy, map);
+        Core::FrozenMap<std::string, int> moved(std::move(map));
+        assertEquals(this, moved, copy);
+    }
+
+    TEST(FrozenMap, Lookup) {
+        Core::Vector<Pair<int, int>> values;
+        for (int i = 0; i < 10000; i++) {
+            values.emplaceBack(i * 13, i);
+        }
+        Core::FrozenMap<int, int> map(values.begin(), values.end());
+        assertEquals(this, map.getSize(), static_cast <std::size_t> (10000));
+        assertTrue(this, map.getBucketCount() <= 10000 / 4 + 1);
+        assertEquals(this, map.getMemoryUsage(), 10000 * sizeof(Pair<int, int>) + map.getBucketCount() * sizeof(std::uint32_t));
+        for (int i = 0; i < 10000; i++) {
+            assertEquals(this, map.get(i * 13), i);
+            assertEquals(this, map.getCount(i * 13 + 1), static_cast <std::size_t> (0));
+        }
+        std::size_t sum = 0;
+        for (auto& it : map) {
+            sum += static_cast <std::size_t> (it.second);
+        }
+        assertEquals(this, sum, static_cast <std::size_t> (9999 * 10000 / 2));
+    }
+
+    TEST(FrozenMap, HashCollision) {
+        struct ConstantHash {
+            std::size_t operator()(int) const {
+                return 0;
+            }
+        };
+        bool thrown = false;
+        try {
+            Core::FrozenMap<int, int, Memory::Allocator<Pair<int, int>>, ConstantHash> map({{1, 1}, {2, 2}});
+        } catch (std::invalid_argument const&) {
+            thrown = true;
+        }
+        assertTrue(this, thrown);
+        Core::FrozenMap<int, int, Memory::Allocator<Pair<int, int>>, ConstantHash> map({{1, 1}, {1, 2}});
+        assertEquals(this, map.get(1), 1);
+    }
+
+    TEST(FrozenMap, Static) {
+        static constexpr auto map = makeFrozenMap<StringView, int>({{"red", 0xFF0000}, {"green", 0x00FF00}, {"blue", 0x0000FF}, {"white", 0xFFFFFF}, {"black", 0x000000}});
+        static_assert(map.getSize() == 5);
+        static_assert(map.get("green") == 0x00FF00);
+        static_assert(map.getCount("cyan") == 0);
+        assertEquals(this, map.get("blue"), 0x0000FF);
+        assertTrue(this, map.find("yellow") == map.end());
+
+        constexpr auto numbers = makeFrozenMap<int, char>({{10, 'a'}, {20, 'b'}, {30, 'c'}, {-5, 'd'}});
+        static_assert(numbers.get(-5) == 'd');
+        int sum = 0;
+        for (auto& it : numbers) {
+            sum += it.first;
+        }
+        assertEquals(this, sum, 55);
+    }
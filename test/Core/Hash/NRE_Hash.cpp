@@ -0,0 +1,107 @@
+
+    /**
+     * @file NRE_Hash.cpp
+     * @brief Test of Core's API's Object : Hash
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+    #include "../../../src/Header/NRE_Core.hpp"
+    #include <Header/NRE_Tester.hpp>
+
+    using namespace NRE::Core;
+    using namespace NRE::Tester;
+
+    TEST(Hash, Deterministic) {
+        const char* data = "The quick brown fox jumps over the lazy dog";
+        assertEquals(this, hashBytes(data, 43), hashBytes(data, 43));
+        assertEquals(this, hashBytes(data, 43, 7), hashBytes(data, 43, 7));
+        assertTrue(this, hashBytes(data, 43) != hashBytes(data, 43, 7));
+    }
+
+    TEST(Hash, EveryLength) {
+        // Cover the empty, 1-3, 4-16, 17-47 and 48+ bytes paths, each length must give a distinct hash
+        char data[128];
+        for (int i = 0; i < 128; i++) {
+            data[i] = static_cast <char> ('a' + i % 26);
+        }
+        std::vector<std::uint64_t> hashes;
+        for (std::size_t length = 0; length <= 128; length++) {
+            hashes.push_back(hashBytes(data, length));
+        }
+        std::sort(hashes.begin(), hashes.end());
+        assertTrue(this, std::adjacent_find(hashes.begin(), hashes.end()) == hashes.end());
+    }
+
+    TEST(Hash, SingleBitChange) {
+        char data[64] = {};
+        std::uint64_t base = hashBytes(data, sizeof(data));
+        for (std::size_t i = 0; i < sizeof(data); i++) {
+            data[i] = 1;
+            assertTrue(this, hashBytes(data, sizeof(data)) != base);
+            data[i] = 0;
+        }
+    }
+
+    TEST(Hash, StringView) {
+        std::hash<StringView> hashView;
+        std::hash<String> hashString;
+        assertEquals(this, hashView(StringView("Hello World", 5)), hashString(String("Hello")));
+        assertEquals(this, hashView(StringView("Hello")), static_cast <std::size_t> (hashBytes("Hello", 5)));
+    }
+
+    TEST(Hash, SeededHash) {
+        SeededHash<String> first(1);
+        SeededHash<String> second(2);
+        assertEquals(this, first.getSeed(), static_cast <std::uint64_t> (1));
+        assertEquals(this, first(String("Key")), static_cast <std::size_t> (hashBytes("Key", 3, 1)));
+        assertTrue(this, first(String("Key")) != second(String("Key")));
+        SeededHash<int> integer(3);
+        int value = 42;
+        assertEquals(this, integer(42), static_cast <std::size_t> (hashBytes(&value, sizeof(int), 3)));
+    }
+
+    TEST(Hash, RandomSeed) {
+        SeededHash<StringView> first = SeededHash<StringView>::withRandomSeed();
+        SeededHash<StringView> second = SeededHash<StringView>::withRandomSeed();
+        assertTrue(this, first.getSeed() != second.getSeed());
+    }
+
+    TEST(Hash, SeededTable) {
+        UnorderedMap<String, int, NRE::Memory::Allocator<Pair<String, int>>, false, SeededHash<String>> map(16, SeededHash<String>::withRandomSeed());
+        map.insert({String("A"), 1});
+        map.insert({String("B"), 2});
+        assertEquals(this, map[String("A")], 1);
+        assertEquals(this, map[String("B")], 2);
+    }
+
+    TEST(Hash, CompileTime) {
+        using namespace NRE::Core::Literals;
+        constexpr StringLiteral short_ = "Key"_nre;
+        constexpr StringLiteral long_ = "A literal long enough to go through the forty eight bytes rounds"_nre;
+        static_assert("Key"_hash == short_.getHash());
+        static_assert(StringLiteral("Key") == short_);
+        std::hash<String> hashString;
+        assertEquals(this, short_.getHash(), hashString(String("Key")));
+        assertEquals(this, long_.getHash(), hashString(String(long_.getData())));
+        assertEquals(this, ""_hash, hashString(String("")));
+        assertEquals(this, std::hash<StringLiteral>()(short_), std::hash<StringView>()(short_));
+    }
+
+    TEST(Hash, Switch) {
+        using namespace NRE::Core::Literals;
+        auto dispatch = [](String const& name) {
+            switch (std::hash<String>()(name)) {
+                case "first"_hash :
+                    return 1;
+                case "second"_hash :
+                    return 2;
+                default :
+                    return 0;
+            }
+        };
+        assertEquals(this, dispatch(String("first")), 1);
+        assertEquals(this, dispatch(String("second")), 2);
+        assertEquals(this, dispatch(String("third")), 0);
+    }
@@ -10,6 +10,9 @@
     #include "../../../src/Header/NRE_Core.hpp"
     #include <Header/NRE_Memory.hpp>
     #include <Header/NRE_Tester.hpp>
+    #include <filesystem>
+    #include <cstdlib>
+    #include <cstdio>
 
     using namespace NRE::Core;
     using namespace NRE::Core::Detail;
@@ -285,3 +288,728 @@
         assertTrue(str2.contains("(C, 3)"));
         assertTrue(str2.contains("(D, 4)"));
     }
+
+    TEST(HashTable, EstimateStringSize) {
+        HashTable<std::string, int, Allocator<Pair<std::string, int>>> table({{"A", 1}, {"BB", -22}, {"CCC", 333}}, 0, std::hash<std::string>(), std::equal_to<std::string>());
+        assertEquals(this, table.estimateStringSize(), table.toString().getSize());
+        String out;
+        table.toString(out);
+        assertEquals(this, out, table.toString());
+    }
+
+    namespace {
+        struct CountingHash {
+            int* calls;
+            std::size_t operator()(std::string const& k) const {
+                ++*calls;
+                return std::hash<std::string>()(k);
+            }
+            std::uint64_t getSeed() const {
+                return 0;
+            }
+        };
+    }
+
+    TEST(HashTable, PrehashedLookup) {
+        int calls = 0;
+        CountingHash hasher{&calls};
+        HashTable<std::string, int, Allocator<Pair<std::string, int>>, false, CountingHash> first(0, hasher);
+        HashTable<std::string, int, Allocator<Pair<std::string, int>>, false, CountingHash> second(0, hasher);
+        std::string key("Key");
+        HashedKey<std::string> hashed(key, hasher);
+        assertEquals(this, calls, 1);
+
+        assertTrue(this, first.emplaceHashed(hashed.getHash(), key, 1).second);
+        assertTrue(this, second.emplaceHashed(hashed.getHash(), key, 2).second);
+        assertFalse(this, first.emplaceHashed(hashed.getHash(), key, 3).second);
+        assertEquals(this, first.find(hashed)->second, 1);
+        assertEquals(this, second.find(key, hashed.getHash())->second, 2);
+        assertEquals(this, first.getCount(hashed), static_cast <std::size_t> (1));
+        assertEquals(this, second.erase(hashed), static_cast <std::size_t> (1));
+        assertTrue(this, second.find(hashed) == second.end());
+        assertTrue(this, second.tryEmplace(hashed, 4).second);
+        assertFalse(this, second.tryEmplace(hashed, 5).second);
+        assertEquals(this, second.find(hashed)->second, 4);
+        assertEquals(this, calls, 1);
+
+        assertTrue(this, first.find(key) == first.find(hashed));
+        assertEquals(this, calls, 2);
+    }
+
+    namespace {
+        struct Heavy {
+            static inline int constructed = 0;
+            int value;
+            Heavy() : value(0) {
+                ++constructed;
+            }
+            Heavy(int v) : value(v) {
+                ++constructed;
+            }
+            Heavy(Heavy const& h) = default;
+            Heavy(Heavy && h) = default;
+            Heavy& operator =(Heavy const& h) = default;
+            Heavy& operator =(Heavy && h) = default;
+        };
+    }
+
+    TEST(HashTable, TryEmplace) {
+        HashTable<std::string, Heavy, Allocator<Pair<std::string, Heavy>>> table;
+        Heavy::constructed = 0;
+        assertTrue(this, table.tryEmplace("A", 1).second);
+        assertEquals(this, Heavy::constructed, 1);
+
+        std::string key("A");
+        auto res = table.tryEmplace(std::move(key), 2);
+        assertFalse(this, res.second);
+        assertEquals(this, res.first->second.value, 1);
+        assertEquals(this, key, std::string("A"));
+        assertEquals(this, Heavy::constructed, 1);
+
+        table["A"].value = 3;
+        assertEquals(this, Heavy::constructed, 1);
+        assertEquals(this, table["B"].value, 0);
+        assertEquals(this, Heavy::constructed, 2);
+        assertEquals(this, table.getSize(), static_cast <std::size_t> (2));
+    }
+
+    TEST(HashTable, InsertOrAssign) {
+        HashTable<std::string, int, Allocator<Pair<std::string, int>>> table;
+        assertTrue(this, table.insertOrAssign("A", 1).second);
+        auto res = table.insertOrAssign("A", 2);
+        assertFalse(this, res.second);
+        assertEquals(this, res.first->second, 2);
+        assertEquals(this, table.get("A"), 2);
+        assertEquals(this, table.getSize(), static_cast <std::size_t> (1));
+    }
+
+    TEST(HashTable, MixAlignedKeys) {
+        // Identity hashed multiples of 1024 would share the same few buckets once masked
+        HashTable<std::size_t, int, Allocator<Pair<std::size_t, int>>> table;
+        for (std::size_t i = 0; i < 1000; i++) {
+            table.insert(Pair<std::size_t, int>(i * 1024, static_cast <int> (i)));
+        }
+        std::vector<std::size_t> buckets;
+        for (std::size_t i = 0; i < 1000; i++) {
+            assertEquals(this, table.get(i * 1024), static_cast <int> (i));
+            buckets.push_back(table.getBucket(i * 1024));
+        }
+        std::sort(buckets.begin(), buckets.end());
+        std::size_t distinct = static_cast <std::size_t> (std::unique(buckets.begin(), buckets.end()) - buckets.begin());
+        assertTrue(this, distinct > 500);
+        assertTrue(this, table.getBucketCount() <= 2048);
+    }
+
+    TEST(HashTable, MixPolicy) {
+        static_assert(std::is_same_v<DefaultHashMix<int, std::hash<int>>, XorShiftMix>);
+        static_assert(std::is_same_v<DefaultHashMix<int*, std::hash<int*>>, XorShiftMix>);
+        static_assert(std::is_same_v<DefaultHashMix<String, std::hash<String>>, IdentityMix>);
+        HashTable<int, int, Allocator<Pair<int, int>>, false, std::hash<int>, std::equal_to<int>, FibonacciMix> table;
+        for (int i = 0; i < 256; i++) {
+            table[i << 12] = i;
+        }
+        assertEquals(this, table.getSize(), static_cast <std::size_t> (256));
+        int key = 255 << 12;
+        HashedKey<int> hashed(key, table.getHash());
+        assertEquals(this, table.find(hashed)->second, 255);
+        assertEquals(this, FibonacciMix::mix(0), static_cast <std::size_t> (0));
+        assertTrue(this, XorShiftMix::mix(1024) != XorShiftMix::mix(2048));
+    }
+
+    TEST(HashTable, FindBatch) {
+        HashTable<int, int, Allocator<Pair<int, int>>> table;
+        for (int i = 0; i < 1000; i++) {
+            table[i] = i * 3;
+        }
+        std::vector<int> keys;
+        for (int i = 0; i < 100; i++) {
+            keys.push_back(i * 17);
+        }
+        std::vector<HashTable<int, int, Allocator<Pair<int, int>>>::Iterator> found;
+        table.findBatch(keys.begin(), keys.end(), std::back_inserter(found));
+        assertEquals(this, found.size(), keys.size());
+        for (std::size_t i = 0; i < keys.size(); i++) {
+            if (keys[i] < 1000) {
+                assertEquals(this, found[i]->second, keys[i] * 3);
+            } else {
+                assertTrue(this, found[i] == table.end());
+            }
+        }
+        std::vector<HashTable<int, int, Allocator<Pair<int, int>>>::ConstIterator> constFound;
+        HashTable<int, int, Allocator<Pair<int, int>>> const& constTable = table;
+        constTable.findBatch(keys.begin(), keys.begin(), std::back_inserter(constFound));
+        assertTrue(this, constFound.empty());
+    }
+
+    namespace {
+        template <class Table, class KeyIterator>
+        concept BatchSearchable = requires (Table& t, KeyIterator it, std::back_insert_iterator<std::vector<typename Table::Iterator>> out) {
+            t.findBatch(it, it, out);
+        };
+    }
+
+    TEST(HashTable, FindBatchRehashing) {
+        using Table = HashTable<int, int, Allocator<Pair<int, int>>>;
+        static_assert(BatchSearchable<Table, std::vector<int>::iterator>);
+        static_assert(!BatchSearchable<Table, std::istream_iterator<int>>);
+        Table table(64);
+        table.setRehashStep(1);
+        int inserted = 0;
+        while (!table.isRehashing()) {
+            table[inserted] = inserted * 3;
+            ++inserted;
+        }
+        std::vector<int> keys;
+        for (int i = 0; i < inserted + 10; i++) {
+            keys.push_back(i);
+        }
+        std::vector<Table::Iterator> found;
+        table.findBatch(keys.begin(), keys.end(), std::back_inserter(found));
+        assertEquals(this, found.size(), keys.size());
+        for (std::size_t i = 0; i < keys.size(); i++) {
+            if (keys[i] < inserted) {
+                assertEquals(this, found[i]->second, keys[i] * 3);
+            } else {
+                assertTrue(this, found[i] == table.end());
+            }
+        }
+    }
+
+    TEST(HashTable, IncrementalRehashEndAlias) {
+        using Table = HashTable<int, int, Allocator<Pair<int, int>>>;
+        Table table(64);
+        table.setRehashStep(1);
+        int inserted = 0;
+        while (!table.isRehashing()) {
+            table[inserted] = inserted;
+            ++inserted;
+        }
+        Table::Iterator end = table.end();
+        Table::Iterator aliased(end.getCurrent(), table.begin().getFollowing());
+        assertTrue(this, table.begin().getFollowing() != nullptr);
+        assertTrue(this, aliased != end);
+        assertTrue(this, Table::Iterator(end.getCurrent()) == end);
+    }
+
+    TEST(HashTable, IncrementalRehashPace) {
+        HashTable<int, int, Allocator<Pair<int, int>>> table(64);
+        table.setRehashStep(1);
+        int inserted = 0;
+        while (!table.isRehashing()) {
+            table[inserted] = inserted;
+            ++inserted;
+        }
+        std::size_t bucketCount = table.getBucketCount();
+        while (table.isRehashing() && table.getBucketCount() == bucketCount) {
+            table[inserted] = inserted;
+            ++inserted;
+        }
+        assertFalse(this, table.isRehashing());
+        assertEquals(this, table.getBucketCount(), bucketCount);
+        for (int i = 0; i < inserted; i++) {
+            assertEquals(this, table.get(i), i);
+        }
+    }
+
+    TEST(HashTable, IncrementalRehash) {
+        HashTable<int, int, Allocator<Pair<int, int>>> table;
+        table.setRehashStep(4);
+        assertEquals(this, table.getRehashStep(), static_cast <std::size_t> (4));
+        bool rehashed = false;
+        for (int i = 0; i < 2000; i++) {
+            table[i] = i;
+            if (table.isRehashing()) {
+                rehashed = true;
+                assertEquals(this, table.get(i / 2), i / 2);
+                std::size_t count = 0;
+                for (auto it = table.begin(); it != table.end(); ++it) {
+                    ++count;
+                }
+                assertEquals(this, count, table.getSize());
+            }
+        }
+        assertTrue(this, rehashed);
+        for (int i = 0; i < 2000; i++) {
+            assertEquals(this, table.get(i), i);
+        }
+        for (int i = 0; i < 2000; i += 2) {
+            assertEquals(this, table.erase(i), static_cast <std::size_t> (1));
+        }
+        while (!table.isRehashing()) {
+            table[static_cast <int> (table.getSize()) + 10000] = 0;
+        }
+        auto it = table.begin();
+        while (it != table.end()) {
+            if (it->first % 3 == 0) {
+                it = table.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        for (auto& pair : table) {
+            assertTrue(this, pair.first % 3 != 0);
+        }
+        HashTable<int, int, Allocator<Pair<int, int>>> copy(table);
+        table.finishRehash();
+        assertTrue(this, !table.isRehashing());
+        assertEquals(this, table.getSize(), copy.getSize());
+        for (auto& pair : copy) {
+            assertEquals(this, table.get(pair.first), pair.second);
+        }
+        table.setRehashStep(0);
+        table.erase(table.cbegin(), table.cend());
+        assertTrue(this, table.isEmpty());
+    }
+
+    TEST(HashTable, MemoryUsage) {
+        assertEquals(this, sizeof(HashTableInner::BucketEntry<Pair<std::uint32_t, std::uint32_t>, true>), static_cast <std::size_t> (16));
+        assertEquals(this, sizeof(HashTableInner::BucketEntry<Pair<std::uint16_t, std::uint16_t>, false>), static_cast <std::size_t> (6));
+        HashTable<std::uint32_t, std::uint32_t, Allocator<Pair<std::uint32_t, std::uint32_t>>, true> table;
+        for (std::uint32_t i = 0; i < 1000; i++) {
+            table[i] = i;
+        }
+        assertTrue(this, table.getMemoryUsage() >= sizeof(table) + table.getBucketCount() * 16);
+        for (std::uint32_t i = 0; i < 1000; i++) {
+            assertEquals(this, table.get(i), i);
+        }
+        auto it = table.begin();
+        for (std::size_t i = 0; i < 1000; i++) {
+            ++it;
+        }
+        assertTrue(this, it == table.end());
+    }
+
+    TEST(HashTable, StoredHashLargeRehash) {
+        int calls = 0;
+        CountingHash hasher{&calls};
+        HashTable<std::string, int, Allocator<Pair<std::string, int>>, true, CountingHash> table(0, hasher);
+        for (int i = 0; i < 100000; i++) {
+            table.emplace(std::to_string(i), i);
+        }
+        assertTrue(this, table.getBucketCount() > static_cast <std::size_t> (65536));
+        assertEquals(this, calls, 100000);
+        for (int i = 0; i < 100000; i++) {
+            assertEquals(this, table.get(std::to_string(i)), i);
+        }
+    }
+
+    TEST(HashTable, SparseIteration) {
+        HashTable<int, int, Allocator<Pair<int, int>>> table;
+        for (int i = 0; i < 100000; i++) {
+            table[i] = i;
+        }
+        std::size_t bucketCount = table.getBucketCount();
+        auto it = table.begin();
+        while (it != table.end()) {
+            if (it->first % 1000 != 0) {
+                it = table.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        assertEquals(this, table.getBucketCount(), bucketCount);
+        assertEquals(this, table.getSize(), static_cast <std::size_t> (100));
+        std::size_t count = 0;
+        for (auto& value : table) {
+            assertEquals(this, value.first % 1000, 0);
+            assertEquals(this, value.second, value.first);
+            count++;
+        }
+        assertEquals(this, count, static_cast <std::size_t> (100));
+        table.erase(table.cbegin(), table.cend());
+        assertTrue(this, table.begin() == table.end());
+        table[7] = 7;
+        assertEquals(this, table.begin()->first, 7);
+        table.clear();
+        assertTrue(this, table.begin() == table.end());
+        HashTable<int, int, Allocator<Pair<int, int>>> copy;
+        copy[1] = 1;
+        copy[2] = 2;
+        table = copy;
+        copy.clear();
+        count = 0;
+        for (auto& value : table) {
+            count += static_cast <std::size_t> (value.second);
+        }
+        assertEquals(this, count, static_cast <std::size_t> (3));
+    }
+
+    TEST(HashTable, Shrink) {
+        HashTable<int, int, Allocator<Pair<int, int>>> table;
+        for (int i = 0; i < 10000; i++) {
+            table[i] = i;
+        }
+        std::size_t peak = table.getBucketCount();
+        for (int i = 100; i < 10000; i++) {
+            table.erase(i);
+        }
+        assertEquals(this, table.getBucketCount(), peak);
+        table.shrinkToFit();
+        assertTrue(this, table.getBucketCount() < peak);
+        assertTrue(this, table.getLoadFactor() <= table.getMaxLoadFactor());
+        for (int i = 0; i < 100; i++) {
+            assertEquals(this, table.get(i), i);
+        }
+
+        bool thrown = false;
+        try {
+            table.setMinLoadFactor(table.getMaxLoadFactor());
+        } catch (std::out_of_range const&) {
+            thrown = true;
+        }
+        assertTrue(this, thrown);
+        table.setMinLoadFactor(0.1f);
+        for (int i = 100; i < 10000; i++) {
+            table[i] = i;
+        }
+        peak = table.getBucketCount();
+        for (int i = 9999; i >= 50; i--) {
+            assertEquals(this, table.erase(i), static_cast <std::size_t> (1));
+            assertTrue(this, table.getLoadFactor() >= 0.1f || table.getBucketCount() == 1);
+        }
+        assertTrue(this, table.getBucketCount() < peak);
+        assertEquals(this, table.getSize(), static_cast <std::size_t> (50));
+        for (int i = 0; i < 50; i++) {
+            assertEquals(this, table.get(i), i);
+        }
+        table.setMaxLoadFactor(0.2f);
+        assertTrue(this, table.getMinLoadFactor() <= 0.05f);
+    }
+
+    TEST(HashTable, Compact) {
+        HashTable<int, int, Allocator<Pair<int, int>>> table(64);
+        table.setMaxLoadFactor(0.95f);
+        for (int i = 0; i < 60; i++) {
+            table[i] = i;
+        }
+        std::size_t bucketCount = table.getBucketCount();
+        auto it = table.cbegin();
+        std::advance(it, 30);
+        table.erase(it, table.cend());
+        table.compact();
+        assertEquals(this, table.getBucketCount(), bucketCount);
+        assertEquals(this, table.getSize(), static_cast <std::size_t> (30));
+        std::size_t count = 0;
+        for (auto& value : table) {
+            assertEquals(this, table.get(value.first), value.second);
+            count++;
+        }
+        assertEquals(this, count, static_cast <std::size_t> (30));
+
+        table.setRehashStep(1);
+        for (int i = 100; i < 1000; i++) {
+            table[i] = i;
+        }
+        assertTrue(this, table.isRehashing());
+        table.compact();
+        assertTrue(this, !table.isRehashing());
+        for (auto& value : table) {
+            assertEquals(this, table.get(value.first), value.second);
+        }
+    }
+
+    TEST(HashTable, Statistics) {
+        HashTable<int, int, Allocator<Pair<int, int>>> table;
+        for (int i = 0; i < 1000; i++) {
+            table[i] = i;
+        }
+        for (int i = 0; i < 2000; i++) {
+            static_cast <void> (table.find(i));
+        }
+        auto stats = table.getStatistics();
+        assertEquals(this, stats.size, static_cast <std::size_t> (1000));
+        assertEquals(this, stats.bucketCount, table.getBucketCount());
+        std::size_t total = 0;
+        for (std::size_t count : stats.distanceHistogram) {
+            total += count;
+        }
+        assertEquals(this, total, static_cast <std::size_t> (1000));
+        assertTrue(this, stats.averageDistance <= static_cast <double> (stats.maxDistance));
+        assertTrue(this, stats.distanceHistogram[std::min(stats.maxDistance, decltype(stats)::HISTOGRAM_SIZE - 1)] > 0);
+        if constexpr (HashTableInner::COLLECT_STATISTICS) {
+            assertEquals(this, stats.lookupCount, static_cast <std::size_t> (2000));
+            assertEquals(this, stats.hitCount, static_cast <std::size_t> (1000));
+            assertEquals(this, stats.getHitRatio(), 0.5);
+            assertTrue(this, stats.rehashCount > 0);
+            assertTrue(this, stats.getAverageProbeLength() >= 1.0);
+            table.resetStatistics();
+            assertEquals(this, table.getStatistics().lookupCount, static_cast <std::size_t> (0));
+        } else {
+            assertEquals(this, stats.lookupCount, static_cast <std::size_t> (0));
+            assertEquals(this, stats.rehashCount, static_cast <std::size_t> (0));
+        }
+    }
+
+    TEST(HashTable, Snapshot) {
+        HashTable<int, int, Allocator<Pair<int, int>>> table;
+        for (int i = 0; i < 1000; i++) {
+            table[i] = i * 2;
+        }
+        for (int i = 0; i < 1000; i += 3) {
+            table.erase(i);
+        }
+        std::FILE* file = std::tmpfile();
+        table.save(fileno(file));
+        std::rewind(file);
+
+        HashTable<int, int, Allocator<Pair<int, int>>> loaded({{-1, -1}});
+        loaded.load(fileno(file));
+        std::fclose(file);
+        assertEquals(this, loaded.getSize(), table.getSize());
+        for (auto& it : table) {
+            assertEquals(this, loaded.get(it.first), it.second);
+        }
+        assertEquals(this, loaded.getBucketCount(), table.getBucketCount());
+        assertEquals(this, loaded.getMaxLoadFactor(), table.getMaxLoadFactor());
+        for (int i = 0; i < 1000; i++) {
+            assertEquals(this, loaded.getCount(i), static_cast <std::size_t> ((i % 3 == 0) ? (0) : (1)));
+        }
+        std::size_t iterated = 0;
+        for (auto it = loaded.begin(); it != loaded.end(); ++it) {
+            iterated++;
+        }
+        assertEquals(this, iterated, table.getSize());
+        loaded[2000] = 0;
+        assertEquals(this, loaded.getSize(), table.getSize() + 1);
+    }
+
+    TEST(HashTable, SnapshotMapped) {
+        using SeededTable = HashTable<int, int, Allocator<Pair<int, int>>, false, SeededHash<int>>;
+        SeededTable table(0, SeededHash<int>(42));
+        for (int i = 0; i < 1000; i++) {
+            table[i * 7] = i;
+        }
+        std::string path = (std::filesystem::temp_directory_path() / "NRE_HashTable_SnapshotMapped_XXXXXX").string();
+        int descriptor = mkstemp(path.data());
+        assertTrue(this, descriptor != -1);
+        table.save(descriptor);
+        close(descriptor);
+
+        SeededTable same(0, SeededHash<int>(42));
+        same.mapFrom(path.c_str());
+        assertEquals(this, same.getSize(), table.getSize());
+        for (auto& it : table) {
+            assertEquals(this, same.get(it.first), it.second);
+        }
+        assertEquals(this, same.getBucketCount(), table.getBucketCount());
+
+        SeededTable reseeded(0, SeededHash<int>(7));
+        reseeded.mapFrom(path.c_str());
+        assertEquals(this, reseeded.getSize(), table.getSize());
+        for (int i = 0; i < 1000; i++) {
+            assertEquals(this, reseeded.get(i * 7), i);
+        }
+
+        std::FILE* file = std::fopen(path.c_str(), "wb");
+        assertTrue(this, file != nullptr);
+        char garbage[128] = {};
+        std::fwrite(garbage, 1, sizeof(garbage), file);
+        std::fclose(file);
+        bool thrown = false;
+        try {
+            same.mapFrom(path.c_str());
+        } catch (std::runtime_error const&) {
+            thrown = true;
+        }
+        std::remove(path.c_str());
+        assertTrue(this, thrown);
+        assertEquals(this, same.getSize(), table.getSize());
+        assertEquals(this, same.get(7), 1);
+    }
+
+    TEST(HashTable, ParallelInsert) {
+        NRE::Core::Vector<Pair<int, int>> values;
+        for (int i = 0; i < 100000; i++) {
+            values.emplaceBack((i * 7919) % 60000, i);
+        }
+        HashTable<int, int, Allocator<Pair<int, int>>> serial;
+        serial.insert(values.begin(), values.end());
+        HashTable<int, int, Allocator<Pair<int, int>>> parallel;
+        parallel.insertParallel(values.begin(), values.end(), 4);
+        assertEquals(this, parallel.getSize(), serial.getSize());
+        std::size_t count = 0;
+        for (auto& it : parallel) {
+            assertEquals(this, it.second, serial.get(it.first));
+            count++;
+        }
+        assertEquals(this, count, serial.getSize());
+
+        HashTable<int, int, Allocator<Pair<int, int>>, true> stored;
+        stored.insertParallel(values.begin(), values.end(), 3);
+        assertEquals(this, stored.getSize(), serial.getSize());
+        for (auto& it : serial) {
+            assertEquals(this, stored.get(it.first), it.second);
+        }
+
+        parallel.insertParallel(values.begin(), values.begin() + 10, 4);
+        assertEquals(this, parallel.getSize(), serial.getSize());
+        parallel.clear();
+        parallel.insertParallel(values.begin(), values.begin() + 10, 4);
+        assertEquals(this, parallel.getSize(), static_cast <std::size_t> (10));
+    }
+
+    namespace {
+        struct ClusterHash {
+            std::size_t operator()(int k) const {
+                return static_cast <std::size_t> (k / 256) * 4096;
+            }
+        };
+    }
+
+    TEST(HashTable, ParallelInsertSpill) {
+        NRE::Core::Vector<Pair<int, int>> values;
+        for (int i = 0; i < 80000; i++) {
+            values.emplaceBack(i % 50000, i);
+        }
+        HashTable<int, int, Allocator<Pair<int, int>>, false, ClusterHash, std::equal_to<int>, IdentityMix> serial;
+        serial.insert(values.begin(), values.end());
+        HashTable<int, int, Allocator<Pair<int, int>>, false, ClusterHash, std::equal_to<int>, IdentityMix> parallel;
+        parallel.insertParallel(values.begin(), values.end(), 8);
+        assertEquals(this, parallel.getSize(), serial.getSize());
+        for (int i = 0; i < 50000; i++) {
+            assertEquals(this, parallel.get(i), serial.get(i));
+        }
+        assertEquals(this, parallel.getCount(50000), static_cast <std::size_t> (0));
+    }
+
+    TEST(HashTable, ParallelInsertDuplicates) {
+        std::size_t size = 50000;
+        std::uniform_int_distribution<int> keys(0, static_cast <int> (size) * 2);
+        for (unsigned seed = 0; seed < 32; seed++) {
+            std::mt19937 generator(seed);
+            NRE::Core::Vector<Pair<int, int>> values;
+            for (std::size_t i = 0; i < size; i++) {
+                values.emplaceBack(keys(generator), static_cast <int> (i));
+            }
+            HashTable<int, int, Allocator<Pair<int, int>>> serial;
+            for (auto& value : values) {
+                serial.insert(value);
+            }
+            HashTable<int, int, Allocator<Pair<int, int>>> parallel;
+            parallel.insertParallel(values.begin(), values.end(), 6);
+            assertEquals(this, parallel.getSize(), serial.getSize());
+            for (auto& it : serial) {
+                assertEquals(this, parallel.get(it.first), it.second);
+            }
+        }
+    }
+
+    namespace {
+        struct ShiftedHash {
+            std::size_t operator()(int k) const {
+                return std::hash<int>()(k) * 31 + 7;
+            }
+        };
+
+        struct SaltedHash {
+            std::size_t salt;
+            std::size_t operator()(int k) const {
+                return std::hash<int>()(k) ^ salt;
+            }
+        };
+    }
+
+    TEST(HashTable, ExtractInsertNode) {
+        int calls = 0;
+        CountingHash hasher{&calls};
+        using CountingTable = HashTable<std::string, int, Allocator<Pair<std::string, int>>, true, CountingHash>;
+        CountingTable source(0, hasher);
+        CountingTable destination(0, hasher);
+        for (int i = 0; i < 100; i++) {
+            source.emplace(std::to_string(i), i);
+        }
+        destination.emplace("7", -7);
+        assertEquals(this, calls, 101);
+
+        CountingTable::NodeType node = source.extract(std::string("5"));
+        assertFalse(this, node.isEmpty());
+        assertEquals(this, node.getKey(), std::string("5"));
+        node.getMapped() = 50;
+        assertEquals(this, source.getCount("5"), static_cast <std::size_t> (0));
+        calls = 0;
+        Pair<CountingTable::Iterator, bool> res = destination.insert(std::move(node));
+        assertTrue(this, res.second);
+        assertEquals(this, res.first->second, 50);
+        assertTrue(this, node.isEmpty());
+        assertEquals(this, calls, 0);
+
+        node = source.extract(source.find("7"));
+        assertFalse(this, destination.insert(std::move(node)).second);
+        assertEquals(this, node.getValue().second, 7);
+        assertEquals(this, destination.get("7"), -7);
+        assertTrue(this, source.extract(std::string("5")).isEmpty());
+        assertFalse(this, destination.insert(CountingTable::NodeType()).second);
+
+        while (!source.isEmpty()) {
+            destination.insert(source.extract(source.cbegin()));
+        }
+        assertEquals(this, destination.getSize(), static_cast <std::size_t> (100));
+        for (int i = 0; i < 100; i++) {
+            assertEquals(this, destination.get(std::to_string(i)), (i == 5) ? (50) : ((i == 7) ? (-7) : (i)));
+        }
+
+        HashTable<int, int, Allocator<Pair<int, int>>, true> plain;
+        HashTable<int, int, Allocator<Pair<int, int>>, true, ShiftedHash> shifted;
+        for (int i = 0; i < 100; i++) {
+            plain[i] = i;
+        }
+        while (!plain.isEmpty()) {
+            shifted.insert(plain.extract(plain.cbegin()));
+        }
+        assertEquals(this, shifted.getSize(), static_cast <std::size_t> (100));
+        for (int i = 0; i < 100; i++) {
+            assertEquals(this, shifted.getCount(i), static_cast <std::size_t> (1));
+        }
+    }
+
+    TEST(HashTable, Merge) {
+        int calls = 0;
+        CountingHash hasher{&calls};
+        using CountingTable = HashTable<std::string, int, Allocator<Pair<std::string, int>>, true, CountingHash>;
+        CountingTable source(0, hasher);
+        CountingTable destination(0, hasher);
+        for (int i = 0; i < 1000; i++) {
+            source.emplace(std::to_string(i), i);
+        }
+        for (int i = 0; i < 1000; i += 10) {
+            destination.emplace(std::to_string(i), -i);
+        }
+        calls = 0;
+        destination.merge(source);
+        assertEquals(this, calls, 0);
+        assertEquals(this, destination.getSize(), static_cast <std::size_t> (1000));
+        assertEquals(this, source.getSize(), static_cast <std::size_t> (100));
+        for (int i = 0; i < 1000; i++) {
+            assertEquals(this, destination.get(std::to_string(i)), (i % 10 == 0) ? (-i) : (i));
+            assertEquals(this, source.getCount(std::to_string(i)), static_cast <std::size_t> ((i % 10 == 0) ? (1) : (0)));
+        }
+
+        using SeededTable = HashTable<int, int, Allocator<Pair<int, int>>, true, SeededHash<int>>;
+        SeededTable seeded(0, SeededHash<int>(42));
+        SeededTable reseeded(0, SeededHash<int>(7));
+        SeededTable large(200000, SeededHash<int>(42));
+        for (int i = 0; i < 5000; i++) {
+            seeded[i] = i;
+        }
+        reseeded.setRehashStep(4);
+        reseeded.merge(seeded);
+        assertTrue(this, seeded.isEmpty());
+        large.merge(reseeded);
+        assertTrue(this, reseeded.isEmpty());
+        assertEquals(this, large.getSize(), static_cast <std::size_t> (5000));
+        for (int i = 0; i < 5000; i++) {
+            assertEquals(this, large.get(i), i);
+        }
+
+        using SaltedTable = HashTable<int, int, Allocator<Pair<int, int>>, true, SaltedHash>;
+        SaltedTable salted(0, SaltedHash{0x5A5A});
+        SaltedTable resalted(0, SaltedHash{0xA5A5});
+        for (int i = 0; i < 1000; i++) {
+            salted[i] = i;
+        }
+        resalted.merge(salted);
+        assertTrue(this, salted.isEmpty());
+        for (int i = 0; i < 1000; i++) {
+            assertEquals(this, resalted.getCount(i), static_cast <std::size_t> (1));
+        }
+    }
@@ -0,0 +1,117 @@
+
+    /**
+     * @file NRE_IndexMap.cpp
+     * @brief Test of Core's API's Container : IndexMap
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+    #include "../../../src/Header/NRE_Core.hpp"
+    #include <Header/NRE_Tester.hpp>
+
+    using namespace NRE;
+    using namespace NRE::Core;
+    using namespace NRE::Tester;
+
+    TEST(IndexMap, Ctr) {
+        Core::IndexMap<std::string, int> map;
+        assertEquals(this, map.getSize(), static_cast <std::size_t> (0));
+        assertTrue(this, map.isEmpty());
+        assertEquals(this, map.toString(), String("{}"));
+        bool thrown = false;
+        try {
+            static_cast <void> (map.get("A"));
+        } catch (std::out_of_range const&) {
+            thrown = true;
+        }
+        assertTrue(this, thrown);
+    }
+
+    TEST(IndexMap, InsertionOrder) {
+        Core::IndexMap<std::string, int> map({{"C", 3}, {"A", 1}, {"B", 2}, {"A", 4}});
+        assertEquals(this, map.getSize(), static_cast <std::size_t> (3));
+        assertEquals(this, map.toString(), String("{(C, 3), (A, 1), (B, 2)}"));
+        map["D"] = 4;
+        map.insertOrAssign("C", 5);
+        assertTrue(this, map.tryEmplace("A", 6).second == false);
+        assertTrue(this, map.emplace("E", 7).second);
+        assertEquals(this, map.toString(), String("{(C, 5), (A, 1), (B, 2), (D, 4), (E, 7)}"));
+        assertEquals(this, map.getIndex("B"), static_cast <std::size_t> (2));
+        assertEquals(this, map.getIndex("F"), map.getSize());
+        assertEquals(this, map.getEntry(3).first, std::string("D"));
+
+        Core::IndexMap<std::string, int> copy(map);
+        assertEquals(this, copy, map);
+        Core::IndexMap<std::string, int> moved(std::move(map));
+        assertEquals(this, moved, copy);
+        assertTrue(this, map.isEmpty());
+        map["Z"] = 0;
+        assertEquals(this, map.get("Z"), 0);
+    }
+
+    TEST(IndexMap, Growth) {
+        Core::IndexMap<int, int> map;
+        for (int i = 0; i < 10000; i++) {
+            assertTrue(this, map.insert(Pair<int, int>(i * 7, i)).second);
+        }
+        assertEquals(this, map.getSize(), static_cast <std::size_t> (10000));
+        int i = 0;
+        for (auto& it : map) {
+            assertEquals(this, it.first, i * 7);
+            i++;
+        }
+        for (i = 0; i < 10000; i++) {
+            assertEquals(this, map.get(i * 7), i);
+            assertEquals(this, map.getCount(i * 7 + 1), static_cast <std::size_t> (0));
+        }
+        assertTrue(this, map.getMemoryUsage() >= 10000 * (sizeof(Pair<int, int>) + sizeof(std::size_t) + sizeof(std::uint32_t)));
+    }
+
+    TEST(IndexMap, Erase) {
+        Core::IndexMap<int, int> map;
+        for (int i = 0; i < 1000; i++) {
+            map[i] = i;
+        }
+        assertEquals(this, map.erase(0), static_cast <std::size_t> (1));
+        assertEquals(this, map.erase(0), static_cast <std::size_t> (0));
+        assertEquals(this, map.begin()->first, 999);
+        auto it = map.begin();
+        while (it != map.end()) {
+            if (it->first % 2 == 0) {
+                it = map.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        assertEquals(this, map.getSize(), static_cast <std::size_t> (500));
+        for (int i = 0; i < 1000; i++) {
+            assertEquals(this, map.getCount(i), static_cast <std::size_t> (i % 2));
+            if (i % 2 == 1) {
+                assertEquals(this, map.get(i), i);
+            }
+        }
+        map.clear();
+        assertTrue(this, map.isEmpty());
+        assertTrue(this, map.find(1) == map.end());
+    }
+
+    TEST(IndexMap, ShiftErase) {
+        Core::IndexMap<int, int> map;
+        for (int i = 0; i < 100; i++) {
+            map[i] = i;
+        }
+        for (int i = 0; i < 100; i += 3) {
+            assertEquals(this, map.shiftErase(i), static_cast <std::size_t> (1));
+        }
+        assertEquals(this, map.shiftErase(0), static_cast <std::size_t> (0));
+        int last = -1;
+        for (auto& it : map) {
+            assertTrue(this, it.first > last);
+            assertTrue(this, it.first % 3 != 0);
+            last = it.first;
+        }
+        for (int i = 0; i < 100; i++) {
+            assertEquals(this, map.getCount(i), static_cast <std::size_t> ((i % 3 == 0) ? (0) : (1)));
+        }
+    }
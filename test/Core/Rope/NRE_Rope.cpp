@@ -0,0 +1,112 @@
+
+    /**
+     * @file NRE_Rope.cpp
+     * @brief Test of Core's API's Object : Rope
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+    #include "../../../src/Header/NRE_Core.hpp"
+    #include <Header/NRE_Tester.hpp>
+    #include <sstream>
+
+    using namespace NRE::Core;
+    using namespace NRE::Tester;
+
+    TEST(Rope, DefaultCtr) {
+        Rope rope;
+        assertTrue(this, rope.isEmpty());
+        assertEquals(this, rope.getChunkCount(), static_cast <std::size_t> (0));
+        assertEquals(this, rope.flatten(), String(""));
+    }
+
+    TEST(Rope, Append) {
+        Rope rope;
+        rope.append(StringView("Hello"));
+        rope.append(String(" World"));
+        assertEquals(this, rope.getSize(), static_cast <std::size_t> (11));
+        assertEquals(this, rope.flatten(), String("Hello World"));
+    }
+
+    TEST(Rope, AppendGather) {
+        Rope rope;
+        for (int i = 0; i < 100; i++) {
+            rope << 'a';
+        }
+        assertEquals(this, rope.getChunkCount(), static_cast <std::size_t> (1));
+        assertEquals(this, rope.flatten(), String(100, 'a'));
+    }
+
+    TEST(Rope, AppendLarge) {
+        Rope rope;
+        String large(10000, 'b');
+        const char* data = large.getCData();
+        rope.append(std::move(large));
+        assertEquals(this, rope.begin()->getData(), data);
+    }
+
+    TEST(Rope, Prepend) {
+        Rope rope("World");
+        rope.prepend(StringView(" "));
+        rope.prepend(String("Hello"));
+        rope << " !";
+        assertEquals(this, rope.flatten(), String("Hello World !"));
+        assertEquals(this, rope.getChunkCount(), static_cast <std::size_t> (3));
+    }
+
+    TEST(Rope, AppendRope) {
+        Rope rope("ab");
+        Rope other("cd");
+        other.prepend(StringView("_"));
+        rope.append(other);
+        rope.prepend(other);
+        rope.append(rope);
+        assertEquals(this, rope.flatten(), String("_cdab_cd_cdab_cd"));
+    }
+
+    TEST(Rope, SliceShare) {
+        Rope rope("Hello");
+        rope.append(String(" World"));
+        Rope slice = rope.slice(3, 5);
+        assertEquals(this, slice.flatten(), String("lo Wo"));
+        assertEquals(this, slice.begin()->getData(), rope.begin()->getData() + 3);
+        rope << "!";
+        assertEquals(this, slice.flatten(), String("lo Wo"));
+        assertEquals(this, rope.flatten(), String("Hello World!"));
+        assertEquals(this, rope.slice(6).flatten(), String("World!"));
+    }
+
+    TEST(Rope, ChunkIterator) {
+        Rope rope(String("B"));
+        rope.prepend(String("A"));
+        rope.append(String(5000, 'C'));
+        String res;
+        for (StringView const& chunk : rope) {
+            res << chunk.getSize() << ";";
+        }
+        assertEquals(this, res, String("1;1;5000;"));
+    }
+
+    TEST(Rope, Get) {
+        Rope rope("abc");
+        rope.prepend(StringView("xy"));
+        assertEquals(this, rope.get(0), 'x');
+        assertEquals(this, rope.get(2), 'a');
+        assertEquals(this, rope.get(4), 'c');
+    }
+
+    TEST(Rope, Stream) {
+        Rope rope;
+        rope << "Value : " << 42 << String(" ok");
+        std::stringstream stream;
+        stream << rope;
+        assertEquals(this, stream.str(), std::string("Value : 42 ok"));
+    }
+
+    TEST(Rope, AppendTo) {
+        Rope rope("world");
+        String str("hello ");
+        rope.appendTo(str);
+        assertEquals(this, str, String("hello world"));
+    }
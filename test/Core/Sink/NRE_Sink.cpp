@@ -0,0 +1,89 @@
+
+    /**
+     * @file NRE_Sink.cpp
+     * @brief Test of Core's API's Interface : Sink
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+    #include "../../../src/Header/NRE_Core.hpp"
+    #include <Header/NRE_Tester.hpp>
+    #include <sstream>
+    #include <cstdio>
+
+    using namespace NRE::Core;
+    using namespace NRE::Tester;
+
+    TEST(Sink, StringSink) {
+        String str("Values : ");
+        StringSink sink(str);
+        sink << 42 << ' ' << -7 << ' ' << true << ' ' << 1.5 << ' ' << "end";
+        assertEquals(this, str, String("Values : 42 -7 true 1.500000 end"));
+    }
+
+    TEST(Sink, SameAsString) {
+        Vector<Pair<int, float>> vec({{1, 0.5f}, {-2, 1000.25f}});
+        String str;
+        StringSink sink(str);
+        sink << vec;
+        assertEquals(this, str, vec.toString());
+    }
+
+    TEST(Sink, FixedBufferSink) {
+        char buffer[8];
+        FixedBufferSink sink(buffer);
+        sink << 1234;
+        assertFalse(this, sink.isTruncated());
+        assertTrue(this, sink.getView() == StringView("1234"));
+        sink << "56789";
+        assertTrue(this, sink.isTruncated());
+        assertEquals(this, sink.getSize(), static_cast <std::size_t> (8));
+        assertTrue(this, sink.getView() == StringView("12345678"));
+        sink.clear();
+        sink << 'a';
+        assertTrue(this, sink.getView() == StringView("a"));
+    }
+
+    TEST(Sink, OStreamSink) {
+        std::stringstream stream;
+        {
+            OStreamSink sink(stream);
+            sink << "Hello " << 10u;
+            assertEquals(this, stream.str(), std::string(""));
+        }
+        assertEquals(this, stream.str(), std::string("Hello 10"));
+    }
+
+    TEST(Sink, OStreamSinkLarge) {
+        Vector<int> vec;
+        for (int i = 0; i < 5000; i++) {
+            vec.pushBack(i);
+        }
+        std::stringstream stream;
+        stream << vec;
+        assertEquals(this, stream.str(), std::string(vec.toString().getCData()));
+    }
+
+    TEST(Sink, FileSink) {
+        std::FILE* file = std::tmpfile();
+        {
+            FileSink sink(fileno(file));
+            sink << String("Line ") << 1 << '\n';
+        }
+        std::rewind(file);
+        char buffer[16] = {};
+        std::size_t read = std::fread(buffer, 1, sizeof(buffer) - 1, file);
+        std::fclose(file);
+        assertEquals(this, read, static_cast <std::size_t> (7));
+        assertEquals(this, std::string(buffer), std::string("Line 1\n"));
+    }
+
+    TEST(Sink, Rope) {
+        Rope rope("Hello");
+        rope.append(String(" World"));
+        char buffer[32];
+        FixedBufferSink sink(buffer);
+        sink << rope;
+        assertTrue(this, sink.getView() == StringView("Hello World"));
+    }
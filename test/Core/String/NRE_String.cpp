@@ -1082,6 +1082,72 @@
 
     TEST(String, Hash) {
         std::hash<String> hashUtil;
-        std::hash<std::string> hashStl;
-        assertEquals(this, hashUtil(String("Hello")), hashStl(std::string("Hello")));
+        assertEquals(this, hashUtil(String("Hello")), static_cast <std::size_t> (hashBytes("Hello", 5)));
+        assertTrue(this, hashUtil(String("Hello")) != hashUtil(String("hello")));
+    }
+
+    TEST(String, ViewCtr) {
+        StringView view("Hello World", 5);
+        String str(view);
+        assertEquals(this, str, String("Hello"));
+    }
+
+    TEST(String, AppendView) {
+        String str("Hello");
+        str.append(StringView(" World !", 6));
+        assertEquals(this, str, String("Hello World"));
+    }
+
+    TEST(String, ToView) {
+        String str("Hello");
+        StringView view = str;
+        assertEquals(this, view.getSize(), static_cast <std::size_t> (5));
+        assertTrue(this, view == StringView("Hello"));
+    }
+
+    TEST(String, ToInt) {
+        assertEquals(this, String("0").toInt(), 0);
+        assertEquals(this, String("-42").toInt(), -42);
+        assertEquals(this, String("123456789").toInt(), 123456789);
+        assertEquals(this, String("ff").toInt(16), 255);
+        assertEquals(this, String("18446744073709551615").toInt<unsigned long long>(), std::numeric_limits<unsigned long long>::max());
+        assertEquals(this, String("-9223372036854775808").toInt<long long>(), std::numeric_limits<long long>::min());
+        assertEquals(this, String("00000000000000001234567890123").toInt<long long>(), 1234567890123LL);
+    }
+
+    TEST(String, ToIntError) {
+        bool invalid = false;
+        try {
+            static_cast <void> (String("12a").toInt());
+        } catch (std::invalid_argument const&) {
+            invalid = true;
+        }
+        assertTrue(this, invalid);
+        bool outOfRange = false;
+        try {
+            static_cast <void> (String("99999999999999999999999").toInt<long long>());
+        } catch (std::out_of_range const&) {
+            outOfRange = true;
+        }
+        assertTrue(this, outOfRange);
+    }
+
+    TEST(String, ToFloat) {
+        assertEquals(this, String("1.5").toFloat(), 1.5);
+        assertEquals(this, String("-2.25e2").toFloat<float>(), -225.0f);
+    }
+
+    TEST(String, TryParse) {
+        int value = 7;
+        assertFalse(this, String("").tryParse(value));
+        assertFalse(this, String("+1").tryParse(value));
+        assertEquals(this, value, 7);
+        unsigned char byte = 7;
+        assertFalse(this, String("300").tryParse(byte));
+        assertEquals(this, byte, static_cast <unsigned char> (7));
+        assertTrue(this, String("-12").tryParse(value));
+        assertEquals(this, value, -12);
+        double d = 0;
+        assertTrue(this, String("0.125").tryParse(d));
+        assertEquals(this, d, 0.125);
     }
@@ -0,0 +1,97 @@
+
+    /**
+     * @file NRE_StringPool.cpp
+     * @brief Test of Core's API's Object : StringPool
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+    #include "../../../src/Header/NRE_Core.hpp"
+    #include <Header/NRE_Tester.hpp>
+    #include <thread>
+
+    using namespace NRE::Core;
+    using namespace NRE::Tester;
+
+    TEST(StringPool, DefaultCtr) {
+        StringPool pool;
+        assertTrue(this, pool.isEmpty());
+        assertEquals(this, pool.getSize(), static_cast <std::size_t> (0));
+    }
+
+    TEST(StringPool, Intern) {
+        StringPool pool;
+        NRE::Id a = pool.intern("Texture");
+        NRE::Id b = pool.intern(String("Mesh"));
+        NRE::Id c = pool.intern(StringView("Texture/Diffuse", 7));
+        assertEquals(this, a, c);
+        assertTrue(this, a != b);
+        assertEquals(this, pool.getSize(), static_cast <std::size_t> (2));
+    }
+
+    TEST(StringPool, Resolve) {
+        StringPool pool;
+        String name("Shader");
+        NRE::Id id = pool.intern(name);
+        name.append("Modified");
+        assertTrue(this, pool.resolve(id) == StringView("Shader"));
+        assertEquals(this, pool.resolve(id).getData()[6], '\0');
+        bool thrown = false;
+        try {
+            static_cast <void> (pool.resolve(id + 1));
+        } catch (std::out_of_range const&) {
+            thrown = true;
+        }
+        assertTrue(this, thrown);
+    }
+
+    TEST(StringPool, Find) {
+        StringPool pool;
+        NRE::Id id = pool.intern("Sound");
+        assertEquals(this, pool.find("Sound"), id);
+        assertEquals(this, pool.find("Music"), StringPool::INVALID_ID);
+        assertTrue(this, pool.contains("Sound"));
+        assertFalse(this, pool.contains("Music"));
+        assertEquals(this, pool.getSize(), static_cast <std::size_t> (1));
+    }
+
+    TEST(StringPool, LargeString) {
+        StringPool pool;
+        String large(5000, 'x');
+        NRE::Id small = pool.intern("small");
+        NRE::Id big = pool.intern(large);
+        NRE::Id other = pool.intern("other");
+        assertTrue(this, pool.resolve(big) == StringView(large));
+        assertTrue(this, pool.resolve(small) == StringView("small"));
+        assertTrue(this, pool.resolve(other) == StringView("other"));
+    }
+
+    TEST(StringPool, Concurrent) {
+        StringPool pool;
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; t++) {
+            threads.emplace_back([&pool]() {
+                for (int i = 0; i < 1000; i++) {
+                    String str("Key");
+                    str << i;
+                    pool.intern(str);
+                }
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+        assertEquals(this, pool.getSize(), static_cast <std::size_t> (1000));
+        for (int i = 0; i < 1000; i++) {
+            String str("Key");
+            str << i;
+            assertTrue(this, pool.resolve(pool.find(str)) == StringView(str));
+        }
+    }
+
+    TEST(StringPool, ViewHash) {
+        std::hash<String> hashString;
+        std::hash<StringView> hashView;
+        assertEquals(this, hashView(StringView("Hello World", 5)), hashString(String("Hello")));
+    }
@@ -0,0 +1,109 @@
+
+    /**
+     * @file NRE_StringView.cpp
+     * @brief Test of Core's API's Object : StringView
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+    #include "../../../src/Header/NRE_Core.hpp"
+    #include <Header/NRE_Tester.hpp>
+    #include <sstream>
+
+    using namespace NRE::Core;
+    using namespace NRE::Tester;
+
+    TEST(StringView, DefaultCtr) {
+        StringView view;
+        assertEquals(this, view.getSize(), static_cast <std::size_t> (0));
+        assertTrue(this, view.isEmpty());
+    }
+
+    TEST(StringView, PtrCtr) {
+        StringView view("Hello");
+        assertEquals(this, view.getSize(), static_cast <std::size_t> (5));
+        assertEquals(this, view.getFront(), 'H');
+        assertEquals(this, view.getLast(), 'o');
+    }
+
+    TEST(StringView, Get) {
+        StringView view("Hello", 3);
+        assertEquals(this, view.get(2), 'l');
+        bool thrown = false;
+        try {
+            static_cast <void> (view.get(3));
+        } catch (std::out_of_range const&) {
+            thrown = true;
+        }
+        assertTrue(this, thrown);
+    }
+
+    TEST(StringView, RemovePrefixSuffix) {
+        StringView view("Hello World");
+        view.removePrefix(2);
+        view.removeSuffix(3);
+        assertTrue(this, view == StringView("llo Wo"));
+    }
+
+    TEST(StringView, Substr) {
+        StringView view("Hello World");
+        assertTrue(this, view.substr(6) == StringView("World"));
+        assertTrue(this, view.substr(0, 5) == StringView("Hello"));
+    }
+
+    TEST(StringView, StartsEndsWith) {
+        StringView view("Hello World");
+        assertTrue(this, view.startsWith(StringView("Hello")));
+        assertTrue(this, view.startsWith('H'));
+        assertTrue(this, view.endsWith(StringView("World")));
+        assertTrue(this, view.endsWith('d'));
+        assertFalse(this, view.endsWith(StringView("Hello")));
+    }
+
+    TEST(StringView, Find) {
+        StringView view("Hello World");
+        assertEquals(this, view.find('o'), static_cast <std::size_t> (4));
+        assertEquals(this, view.find('o', 5), static_cast <std::size_t> (7));
+        assertEquals(this, view.find(StringView("World")), static_cast <std::size_t> (6));
+        assertEquals(this, view.find('z'), StringView::NOT_FOUND);
+        assertTrue(this, view.contains(StringView("lo W")));
+    }
+
+    TEST(StringView, Comparison) {
+        assertTrue(this, StringView("abc") == StringView("abc"));
+        assertTrue(this, StringView("abc") != StringView("abd"));
+        assertTrue(this, StringView("ab") < StringView("abc"));
+        assertTrue(this, StringView("abc") < StringView("b"));
+    }
+
+    TEST(StringView, ToIntNotTerminated) {
+        const char* data = "12345678901234567890";
+        assertEquals(this, StringView(data, 4).toInt(), 1234);
+        assertEquals(this, StringView(data, 18).toInt<long long>(), 123456789012345678LL);
+    }
+
+    TEST(StringView, ToIntBase) {
+        assertEquals(this, StringView("101").toInt(2), 5);
+        assertEquals(this, StringView("zz").toInt(36), 1295);
+        assertEquals(this, StringView("-7f").toInt<signed char>(16), static_cast <signed char> (-127));
+    }
+
+    TEST(StringView, ToFloat) {
+        assertEquals(this, StringView("3.25xyz", 4).toFloat(), 3.25);
+    }
+
+    TEST(StringView, TryParse) {
+        long long value = 1;
+        assertFalse(this, StringView("12 ").tryParse(value));
+        assertFalse(this, StringView("-").tryParse(value));
+        assertEquals(this, value, 1LL);
+        assertTrue(this, StringView("-9876543210").tryParse(value));
+        assertEquals(this, value, -9876543210LL);
+    }
+
+    TEST(StringView, Stream) {
+        std::stringstream stream;
+        stream << StringView("Hello World", 5);
+        assertEquals(this, stream.str(), std::string("Hello"));
+    }
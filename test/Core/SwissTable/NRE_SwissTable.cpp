@@ -0,0 +1,117 @@
+
+    /**
+     * @file NRE_SwissTable.cpp
+     * @brief Test of Core's API's Object : SwissTable
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+    #include "../../../src/Header/NRE_Core.hpp"
+    #include <Header/NRE_Memory.hpp>
+    #include <Header/NRE_Tester.hpp>
+
+    using namespace NRE::Core;
+    using namespace NRE::Core::Detail;
+    using namespace NRE::Memory;
+    using namespace NRE::Tester;
+
+    TEST(SwissTable, Ctr) {
+        SwissTable<std::string, int, Allocator<Pair<std::string, int>>> table;
+        assertEquals(this, table.getSize(), static_cast <std::size_t> (0));
+        assertEquals(this, table.getBucketCount(), static_cast <std::size_t> (0));
+        assertTrue(this, table.begin() == table.end());
+        assertTrue(this, table.find("A") == table.end());
+        assertEquals(this, table.toString(), String("{}"));
+    }
+
+    TEST(SwissTable, InsertFind) {
+        SwissTable<int, int, Allocator<Pair<int, int>>> table;
+        for (int i = 0; i < 1000; ++i) {
+            assertTrue(this, table.insert(Pair<int, int>(i, i * 2)).second);
+        }
+        assertTrue(this, table.insert(Pair<int, int>(10, 0)).second == false);
+        assertEquals(this, table.getSize(), static_cast <std::size_t> (1000));
+        assertTrue(this, table.getLoadFactor() <= table.getMaxLoadFactor());
+        for (int i = 0; i < 1000; ++i) {
+            assertEquals(this, table.get(i), i * 2);
+        }
+        assertTrue(this, table.find(1000) == table.end());
+        std::size_t count = 0;
+        for (auto& it : table) {
+            assertEquals(this, it.second, it.first * 2);
+            ++count;
+        }
+        assertEquals(this, count, static_cast <std::size_t> (1000));
+    }
+
+    TEST(SwissTable, EraseTombstones) {
+        SwissTable<int, int, Allocator<Pair<int, int>>> table(64);
+        std::size_t bucketCount = table.getBucketCount();
+        for (int round = 0; round < 50; ++round) {
+            for (int i = 0; i < 40; ++i) {
+                table.insert(Pair<int, int>(round * 40 + i, i));
+            }
+            for (int i = 0; i < 40; ++i) {
+                assertEquals(this, table.erase(round * 40 + i), static_cast <std::size_t> (1));
+            }
+        }
+        assertTrue(this, table.isEmpty());
+        assertTrue(this, table.begin() == table.end());
+        assertEquals(this, table.getBucketCount(), bucketCount);
+    }
+
+    TEST(SwissTable, EraseIterator) {
+        SwissTable<int, int, Allocator<Pair<int, int>>> table;
+        for (int i = 0; i < 100; ++i) {
+            table.insert(Pair<int, int>(i, i));
+        }
+        auto it = table.begin();
+        while (it != table.end()) {
+            if (it->first % 2 == 0) {
+                it = table.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        assertEquals(this, table.getSize(), static_cast <std::size_t> (50));
+        for (int i = 0; i < 100; ++i) {
+            assertEquals(this, table.getCount(i), static_cast <std::size_t> (i % 2));
+        }
+        table.erase(table.cbegin(), table.cend());
+        assertTrue(this, table.isEmpty());
+    }
+
+    TEST(SwissTable, CopyMove) {
+        SwissTable<std::string, int, Allocator<Pair<std::string, int>>> table({{"A", 1}, {"B", 2}, {"C", 3}});
+        table.erase("B");
+        SwissTable<std::string, int, Allocator<Pair<std::string, int>>> copy(table);
+        assertEquals(this, copy.getSize(), static_cast <std::size_t> (2));
+        assertEquals(this, copy.get("C"), 3);
+        SwissTable<std::string, int, Allocator<Pair<std::string, int>>> moved(std::move(table));
+        assertEquals(this, moved.getSize(), static_cast <std::size_t> (2));
+        assertTrue(this, table.isEmpty());
+        table = copy;
+        assertEquals(this, table.get("A"), 1);
+        moved.rehash(0);
+        assertEquals(this, moved.get("A"), 1);
+    }
+
+    TEST(SwissTable, SwissMap) {
+        SwissMap<String, int> map({{String("A"), 1}, {String("B"), 2}});
+        map[String("C")] = 3;
+        assertEquals(this, map.getSize(), static_cast <std::size_t> (3));
+        assertTrue(this, map.tryEmplace(String("A"), 10).second == false);
+        assertTrue(this, map.insertOrAssign(String("B"), 20).second == false);
+        assertEquals(this, map.get(String("B")), 20);
+        String key("C");
+        HashedKey<String> hashed(key, map.getHash());
+        assertEquals(this, map.find(hashed)->second, 3);
+        std::vector<String> keys({String("C"), String("D"), String("A")});
+        std::vector<SwissMap<String, int>::Iterator> found;
+        map.findBatch(keys.begin(), keys.end(), std::back_inserter(found));
+        assertEquals(this, found[0]->second, 3);
+        assertTrue(this, found[1] == map.end());
+        assertEquals(this, found[2]->second, 1);
+        assertEquals(this, map, SwissMap<String, int>({{String("A"), 1}, {String("B"), 20}, {String("C"), 3}}));
+    }
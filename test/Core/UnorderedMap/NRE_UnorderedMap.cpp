@@ -295,3 +295,34 @@
         Core::UnorderedMap<std::string, int> other({{"A", 1}, {"B", 3}, {"C", 3}});
         assertNotEquals(this, table, other);
     }
+
+    TEST(UnorderedMap, Prehashed) {
+        Core::UnorderedMap<String, int> names({{String("A"), 1}, {String("B"), 2}});
+        Core::UnorderedMap<String, int> ages({{String("A"), 30}});
+        String key("A");
+        HashedKey<String> hashed(key, names.getHash());
+        assertEquals(this, names.find(hashed)->second + ages.find(hashed)->second, 31);
+        assertEquals(this, ages.getCount(key, hashed.getHash()), static_cast <std::size_t> (1));
+        assertTrue(this, ages.emplaceHashed(hashed.getHash(), key, 31).second == false);
+        assertEquals(this, ages.erase(hashed), static_cast <std::size_t> (1));
+        assertTrue(this, ages.isEmpty());
+    }
+
+    TEST(UnorderedMap, Transparent) {
+        Core::UnorderedMap<String, int, Memory::Allocator<Pair<String, int>>, false, StringHash, StringEqual> routes({{String("/home"), 1}, {String("/login"), 2}});
+        const char* path = "/login?user=abc";
+        StringView route(path, 6);
+        assertEquals(this, routes.find(route)->second, 2);
+        assertEquals(this, routes.get("/home"), 1);
+        assertEquals(this, routes.getCount(StringView("/logout")), static_cast <std::size_t> (0));
+        assertTrue(this, routes.equalRange(route).first == routes.find(String("/login")));
+        bool thrown = false;
+        try {
+            static_cast <void> (routes.get(StringView("/admin")));
+        } catch (std::out_of_range const&) {
+            thrown = true;
+        }
+        assertTrue(this, thrown);
+        assertEquals(this, routes.erase(route), static_cast <std::size_t> (1));
+        assertEquals(this, routes.getSize(), static_cast <std::size_t> (1));
+    }
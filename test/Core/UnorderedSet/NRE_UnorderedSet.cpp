@@ -0,0 +1,122 @@
+
+    /**
+     * @file NRE_UnorderedSet.cpp
+     * @brief Test of Core's API's Container : UnorderedSet
+     * @author Louis ABEL
+     * @date 19/10/2026
+     * @copyright CC-BY-NC-SA
+     */
+
+    #include "../../../src/Header/NRE_Core.hpp"
+    #include <Header/NRE_Tester.hpp>
+
+    using namespace NRE;
+    using namespace NRE::Core;
+    using namespace NRE::Tester;
+
+    TEST(UnorderedSet, Ctr) {
+        Core::UnorderedSet<std::string> set;
+        assertEquals(this, set.getSize(), static_cast <std::size_t> (0));
+        assertTrue(this, set.isEmpty());
+        assertEquals(this, set.toString(), String("{}"));
+    }
+
+    TEST(UnorderedSet, CtrList) {
+        Core::UnorderedSet<std::string> set({"A", "B", "C", "A"});
+        assertEquals(this, set.getSize(), static_cast <std::size_t> (3));
+        String str(set.toString());
+        assertTrue(str.contains("A"));
+        assertTrue(str.contains("B"));
+        assertTrue(str.contains("C"));
+        Core::UnorderedSet<std::string> copy(set);
+        assertEquals(this, copy, set);
+        Core::UnorderedSet<std::string> moved(std::move(set));
+        assertEquals(this, moved, copy);
+        assertTrue(this, set.isEmpty());
+    }
+
+    TEST(UnorderedSet, InsertFindErase) {
+        Core::UnorderedSet<int> set;
+        for (int i = 0; i < 1000; i++) {
+            assertTrue(this, set.insert(i).second);
+        }
+        assertTrue(this, set.insert(10).second == false);
+        assertEquals(this, *set.emplace(1000).first, 1000);
+        assertEquals(this, set.getSize(), static_cast <std::size_t> (1001));
+        for (int i = 0; i <= 1000; i++) {
+            assertEquals(this, *set.find(i), i);
+        }
+        assertTrue(this, set.find(1001) == set.end());
+        assertEquals(this, set.erase(1000), static_cast <std::size_t> (1));
+        assertEquals(this, set.erase(1000), static_cast <std::size_t> (0));
+        auto it = set.begin();
+        while (it != set.end()) {
+            if (*it % 2 == 0) {
+                it = set.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        assertEquals(this, set.getSize(), static_cast <std::size_t> (500));
+        for (int i = 0; i < 1000; i++) {
+            assertEquals(this, set.getCount(i), static_cast <std::size_t> (i % 2));
+        }
+        set.erase(set.cbegin(), set.cend());
+        assertTrue(this, set.isEmpty());
+    }
+
+    TEST(UnorderedSet, KeysOnly) {
+        Core::UnorderedSet<std::uint32_t> set;
+        Core::UnorderedMap<std::uint32_t, bool> map;
+        for (std::uint32_t i = 0; i < 1000; i++) {
+            set.insert(i);
+            map[i] = true;
+        }
+        assertEquals(this, set.getBucketCount(), map.getBucketCount());
+        assertTrue(this, set.getMemoryUsage() < map.getMemoryUsage());
+    }
+
+    TEST(UnorderedSet, SetOperations) {
+        Core::UnorderedSet<int> a({1, 2, 3, 4, 5});
+        Core::UnorderedSet<int> b({4, 5, 6, 7});
+
+        Core::UnorderedSet<int> united(a);
+        united.unite(b);
+        assertEquals(this, united, Core::UnorderedSet<int>({1, 2, 3, 4, 5, 6, 7}));
+
+        Core::UnorderedSet<int> intersection(a);
+        intersection.intersect(b);
+        assertEquals(this, intersection, Core::UnorderedSet<int>({4, 5}));
+
+        Core::UnorderedSet<int> difference(a);
+        difference.subtract(b);
+        assertEquals(this, difference, Core::UnorderedSet<int>({1, 2, 3}));
+        Core::UnorderedSet<int> big(b);
+        big.subtract(Core::UnorderedSet<int>({6}));
+        assertEquals(this, big, Core::UnorderedSet<int>({4, 5, 7}));
+
+        assertTrue(this, intersection.isSubsetOf(a));
+        assertTrue(this, intersection.isSubsetOf(b));
+        assertTrue(this, !a.isSubsetOf(b));
+        assertTrue(this, a != b);
+
+        a.subtract(a);
+        assertTrue(this, a.isEmpty());
+    }
+
+    TEST(UnorderedSet, ExtractMerge) {
+        Core::UnorderedSet<int> a({1, 2, 3, 4, 5});
+        Core::UnorderedSet<int> b({4, 5, 6, 7});
+        Core::UnorderedSet<int>::NodeType node = a.extract(1);
+        assertEquals(this, node.getKey(), 1);
+        assertTrue(this, b.insert(std::move(node)).second);
+        assertTrue(this, node.isEmpty());
+        assertTrue(this, a.extract(1).isEmpty());
+
+        a.merge(b);
+        assertEquals(this, a, Core::UnorderedSet<int>({1, 2, 3, 4, 5, 6, 7}));
+        assertEquals(this, b, Core::UnorderedSet<int>({4, 5}));
+        node = a.extract(a.find(4));
+        assertFalse(this, b.insert(std::move(node)).second);
+        assertEquals(this, node.getValue(), 4);
+    }
@@ -332,3 +332,20 @@
         assertNotEquals(this, vec, other);
         assertNotEquals(this, vec, otherVec);
     }
+
+    TEST(Vector, EstimateStringSize) {
+        Vector<int> vec({0, -1, 22, 333, -4444});
+        assertEquals(this, vec.estimateStringSize(), vec.toString().getSize());
+        Vector<Pair<float, bool>> nested({{0.5f, true}, {-12.25f, false}, {1000.0f, true}});
+        assertEquals(this, nested.estimateStringSize(), nested.toString().getSize());
+    }
+
+    TEST(Vector, ToStringBuffer) {
+        Vector<int> vec({1, 2, 3});
+        String out("Vector : ");
+        vec.toString(out);
+        assertEquals(this, out, String("Vector : [1, 2, 3]"));
+        out.clear();
+        vec.toString(out);
+        assertEquals(this, out, String("[1, 2, 3]"));
+    }
@@ -14,7 +14,17 @@
     #include "Core/Vector/NRE_Vector.cpp"
     #include "Core/Observable/NRE_Observable.cpp"
     #include "Core/String/NRE_String.cpp"
+    #include "Core/StringView/NRE_StringView.cpp"
+    #include "Core/StringPool/NRE_StringPool.cpp"
+    #include "Core/Rope/NRE_Rope.cpp"
+    #include "Core/Sink/NRE_Sink.cpp"
+    #include "Core/Hash/NRE_Hash.cpp"
     #include "Core/ForwardList/NRE_ForwardList.cpp"
     #include "Core/Pair/NRE_Pair.cpp"
     #include "Core/HashTable/NRE_HashTable.cpp"
+    #include "Core/SwissTable/NRE_SwissTable.cpp"
     #include "Core/UnorderedMap/NRE_UnorderedMap.cpp"
+    #include "Core/UnorderedSet/NRE_UnorderedSet.cpp"
+    #include "Core/ConcurrentMap/NRE_ConcurrentMap.cpp"
+    #include "Core/IndexMap/NRE_IndexMap.cpp"
+    #include "Core/FrozenMap/NRE_FrozenMap.cpp"